@@ -43,6 +43,9 @@ set_property(CACHE PARAVIEW_BUILD_TESTING
 
 cmake_dependent_option(PARAVIEW_BUILD_VTK_TESTING "Enable VTK testing" OFF
   "PARAVIEW_BUILD_TESTING" OFF)
+cmake_dependent_option(PARAVIEW_BUILD_BENCHMARKS "Build benchmark executables next to the tests" OFF
+  "PARAVIEW_BUILD_TESTING" OFF)
+mark_as_advanced(PARAVIEW_BUILD_BENCHMARKS)
 option(PARAVIEW_BUILD_DEVELOPER_DOCUMENTATION "Generate ParaView C++/Python docs" "${doc_default}")
 
 option(PARAVIEW_PLUGIN_DISABLE_XML_DOCUMENTATION "Forcefully disable XML documentation generation" OFF)
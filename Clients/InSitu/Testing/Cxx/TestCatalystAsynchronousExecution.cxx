@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkAlgorithm.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkInSituInitializationHelper.h"
+#include "vtkInSituPipeline.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkSMSourceProxy.h"
+
+#include <catalyst.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Records the steps it executes, the thread it runs on, and the first value of
+// the "pressure" field it sees.
+class vtkTestRecordingPipeline : public vtkInSituPipeline
+{
+public:
+  static vtkTestRecordingPipeline* New();
+  vtkTypeMacro(vtkTestRecordingPipeline, vtkInSituPipeline);
+
+  bool Execute(int timestep, double time) override
+  {
+    auto producer = vtkInSituInitializationHelper::GetProducer("grid");
+    if (!producer)
+    {
+      return false;
+    }
+    producer->UpdatePipeline(time);
+    auto algorithm = vtkAlgorithm::SafeDownCast(producer->GetClientSideObject());
+    double value = -1.0;
+    for (auto ds : vtkCompositeDataSet::GetDataSets(algorithm->GetOutputDataObject(0)))
+    {
+      if (auto array = ds->GetPointData()->GetArray("pressure"))
+      {
+        value = array->GetComponent(0, 0);
+      }
+    }
+    std::this_thread::sleep_for(this->Delay);
+
+    this->TimeSteps.push_back(timestep);
+    this->Values.push_back(value);
+    this->Threads.push_back(std::this_thread::get_id());
+    return true;
+  }
+
+  void Reset()
+  {
+    this->TimeSteps.clear();
+    this->Values.clear();
+    this->Threads.clear();
+  }
+
+  std::chrono::milliseconds Delay{ 0 };
+  std::vector<int> TimeSteps;
+  std::vector<double> Values;
+  std::vector<std::thread::id> Threads;
+};
+vtkStandardNewMacro(vtkTestRecordingPipeline);
+
+// Passes a mesh whose pressure is the timestep, then overwrites the buffer as
+// a simulation would for its next step: the pipelines must see the values
+// passed to catalyst_execute.
+bool Execute(int timestep)
+{
+  const conduit_index_t numPts = 10;
+  std::vector<double> coords(numPts), pressure(numPts, static_cast<double>(timestep));
+  std::vector<conduit_int64> connectivity;
+  for (conduit_index_t cc = 0; cc < numPts; ++cc)
+  {
+    coords[cc] = static_cast<double>(cc);
+    if (cc > 0)
+    {
+      connectivity.push_back(cc - 1);
+      connectivity.push_back(cc);
+    }
+  }
+
+  conduit_cpp::Node exec_params;
+  auto state = exec_params["catalyst/state"];
+  state["timestep"].set(timestep);
+  state["time"].set(timestep * 0.1);
+  auto mesh = exec_params["catalyst/channels/grid/data"];
+  exec_params["catalyst/channels/grid/type"].set("mesh");
+  mesh["coordsets/coords/type"].set("explicit");
+  mesh["coordsets/coords/values/x"].set_external(coords.data(), numPts);
+  mesh["coordsets/coords/values/y"].set_external(coords.data(), numPts);
+  mesh["coordsets/coords/values/z"].set_external(coords.data(), numPts);
+  mesh["topologies/mesh/type"].set("unstructured");
+  mesh["topologies/mesh/coordset"].set("coords");
+  mesh["topologies/mesh/elements/shape"].set("line");
+  mesh["topologies/mesh/elements/connectivity"].set_external(
+    connectivity.data(), connectivity.size());
+  mesh["fields/pressure/association"].set("vertex");
+  mesh["fields/pressure/topology"].set("mesh");
+  mesh["fields/pressure/values"].set_external(pressure.data(), numPts);
+
+  const bool success = catalyst_execute(conduit_cpp::c_node(&exec_params)) == catalyst_status_ok;
+  std::fill(pressure.begin(), pressure.end(), -2.0);
+  return success;
+}
+
+bool Check(vtkTestRecordingPipeline* pipeline, const char* policy)
+{
+  bool success = !pipeline->TimeSteps.empty();
+  for (size_t cc = 0; cc < pipeline->TimeSteps.size(); ++cc)
+  {
+    success &= pipeline->Values[cc] == pipeline->TimeSteps[cc];
+    success &= cc == 0 || pipeline->TimeSteps[cc] > pipeline->TimeSteps[cc - 1];
+    success &= pipeline->Threads[cc] != std::this_thread::get_id();
+  }
+  if (!success)
+  {
+    cerr << "ERROR: unexpected executions with the " << policy << " policy:";
+    for (size_t cc = 0; cc < pipeline->TimeSteps.size(); ++cc)
+    {
+      cerr << " " << pipeline->TimeSteps[cc] << " (" << pipeline->Values[cc] << ")";
+    }
+    cerr << endl;
+  }
+  return success;
+}
+}
+
+int TestCatalystAsynchronousExecution(int argc, char* argv[])
+{
+  if (argc < 2)
+  {
+    cerr << "Usage: " << argv[0] << " <paraview catalyst implementation directory>" << endl;
+    return EXIT_FAILURE;
+  }
+
+  conduit_cpp::Node node;
+  node["catalyst_load/implementation"] = "paraview";
+  node["catalyst_load/search_paths/paraview"] = argv[1];
+  node["catalyst/asynchronous/enabled"].set(1);
+  node["catalyst/asynchronous/queue_size"].set(1);
+  node["catalyst/asynchronous/policy"].set("block");
+  if (catalyst_initialize(conduit_cpp::c_node(&node)) != catalyst_status_ok)
+  {
+    cerr << "ERROR: failed to initialize Catalyst." << endl;
+    return EXIT_FAILURE;
+  }
+  if (!vtkInSituInitializationHelper::GetAsynchronousExecution())
+  {
+    cerr << "ERROR: asynchronous execution is not enabled." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // the implementation shares the ParaView libraries with this test.
+  vtkNew<vtkTestRecordingPipeline> pipeline;
+  pipeline->SetName("record");
+  vtkInSituInitializationHelper::AddPipeline(pipeline);
+
+  // every step is executed, in order, on the execution thread.
+  bool success = true;
+  const int numSteps = 5;
+  pipeline->Delay = std::chrono::milliseconds(20);
+  for (int timestep = 0; timestep < numSteps; ++timestep)
+  {
+    success &= Execute(timestep);
+  }
+  vtkInSituInitializationHelper::WaitForPipelines();
+  if (!Check(pipeline, "block") || static_cast<int>(pipeline->TimeSteps.size()) != numSteps)
+  {
+    cerr << "ERROR: expected " << numSteps << " executions with the block policy, got "
+         << pipeline->TimeSteps.size() << "." << endl;
+    success = false;
+  }
+
+  // the first step is executed, the steps issued while the queue is full are
+  // dropped.
+  pipeline->Reset();
+  pipeline->Delay = std::chrono::milliseconds(200);
+  vtkInSituInitializationHelper::SetBackPressurePolicy(vtkInSituInitializationHelper::DROP);
+  for (int timestep = numSteps; timestep < 2 * numSteps; ++timestep)
+  {
+    success &= Execute(timestep);
+  }
+  vtkInSituInitializationHelper::WaitForPipelines();
+  if (!Check(pipeline, "drop") || pipeline->TimeSteps.front() != numSteps ||
+    static_cast<int>(pipeline->TimeSteps.size()) >= numSteps)
+  {
+    cerr << "ERROR: expected dropped executions with the drop policy, got "
+         << pipeline->TimeSteps.size() << " executions." << endl;
+    success = false;
+  }
+
+  conduit_cpp::Node finalize;
+  if (catalyst_finalize(conduit_cpp::c_node(&finalize)) != catalyst_status_ok)
+  {
+    cerr << "ERROR: failed to finalize Catalyst." << endl;
+    success = false;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,204 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkInSituInitializationHelper.h"
+#include "vtkInSituPipeline.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
+#include "vtkSMSourceProxy.h"
+
+#include <catalyst.hpp>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+// Updates the producer of the channel, so that its mesh is ingested.
+class vtkTestUpdateProducerPipeline : public vtkInSituPipeline
+{
+public:
+  static vtkTestUpdateProducerPipeline* New();
+  vtkTypeMacro(vtkTestUpdateProducerPipeline, vtkInSituPipeline);
+
+  bool Execute(int, double time) override
+  {
+    auto producer = vtkInSituInitializationHelper::GetProducer("grid");
+    if (producer)
+    {
+      producer->UpdatePipeline(time);
+    }
+    return producer != nullptr;
+  }
+};
+vtkStandardNewMacro(vtkTestUpdateProducerPipeline);
+
+// Simulation buffers: a polyline with point fields.
+struct Simulation
+{
+  explicit Simulation(conduit_index_t numPts)
+    : X(numPts)
+    , Y(numPts)
+    , Z(numPts)
+    , Pressure(numPts)
+    , Temperature(numPts)
+  {
+    for (conduit_index_t cc = 0; cc < numPts; ++cc)
+    {
+      this->X[cc] = static_cast<double>(cc);
+      if (cc > 0)
+      {
+        this->Connectivity.push_back(cc - 1);
+        this->Connectivity.push_back(cc);
+      }
+    }
+  }
+
+  void Step(int timestep)
+  {
+    for (size_t cc = 0; cc < this->X.size(); ++cc)
+    {
+      this->Y[cc] = timestep * 0.5;
+      this->Pressure[cc] = timestep + cc;
+      this->Temperature[cc] = timestep - 1.0 * cc;
+    }
+  }
+
+  std::vector<double> X, Y, Z, Pressure, Temperature;
+  std::vector<conduit_int64> Connectivity;
+};
+
+void AddField(conduit_cpp::Node fields, const char* name, std::vector<double>& values)
+{
+  auto field = fields[name];
+  field["association"].set("vertex");
+  field["topology"].set("mesh");
+  field["values"].set_external(values.data(), values.size());
+}
+
+bool Execute(Simulation& sim, int timestep, bool withTemperature)
+{
+  sim.Step(timestep);
+  conduit_cpp::Node exec_params;
+  auto state = exec_params["catalyst/state"];
+  state["timestep"].set(timestep);
+  state["time"].set(timestep * 0.1);
+
+  auto channel = exec_params["catalyst/channels/grid"];
+  channel["type"].set("mesh");
+  auto mesh = channel["data"];
+  mesh["coordsets/coords/type"].set("explicit");
+  mesh["coordsets/coords/values/x"].set_external(sim.X.data(), sim.X.size());
+  mesh["coordsets/coords/values/y"].set_external(sim.Y.data(), sim.Y.size());
+  mesh["coordsets/coords/values/z"].set_external(sim.Z.data(), sim.Z.size());
+  mesh["topologies/mesh/type"].set("unstructured");
+  mesh["topologies/mesh/coordset"].set("coords");
+  mesh["topologies/mesh/elements/shape"].set("line");
+  mesh["topologies/mesh/elements/connectivity"].set_external(
+    sim.Connectivity.data(), sim.Connectivity.size());
+  AddField(mesh["fields"], "pressure", sim.Pressure);
+  if (withTemperature)
+  {
+    AddField(mesh["fields"], "temperature", sim.Temperature);
+  }
+
+  return catalyst_execute(conduit_cpp::c_node(&exec_params)) == catalyst_status_ok;
+}
+
+// Records the channel verification summaries logged by each execute call.
+void RecordVerification(void* userData, const vtkLogger::Message& message)
+{
+  const std::string text = message.message;
+  if (text.find("channel verification:") != std::string::npos)
+  {
+    static_cast<std::vector<std::string>*>(userData)->push_back(text);
+  }
+}
+
+bool CheckVerification(const std::vector<std::string>& messages, size_t index, const char* expected)
+{
+  if (messages.size() <= index || messages[index].find(expected) == std::string::npos)
+  {
+    cerr << "ERROR: execute " << index << " did not report '" << expected << "'." << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestCatalystCachedVerification(int argc, char* argv[])
+{
+  if (argc < 2)
+  {
+    cerr << "Usage: " << argv[0] << " <paraview catalyst implementation directory>" << endl;
+    return EXIT_FAILURE;
+  }
+
+  conduit_cpp::Node node;
+  node["catalyst_load/implementation"] = "paraview";
+  node["catalyst_load/search_paths/paraview"] = argv[1];
+  node["catalyst/cache_verification"].set(1);
+  if (catalyst_initialize(conduit_cpp::c_node(&node)) != catalyst_status_ok)
+  {
+    cerr << "ERROR: failed to initialize Catalyst." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // the implementation shares the ParaView libraries with this test.
+  vtkNew<vtkTestUpdateProducerPipeline> pipeline;
+  pipeline->SetName("update_producer");
+  vtkInSituInitializationHelper::AddPipeline(pipeline);
+
+  // log the Catalyst messages to the callback only, not to the terminal.
+  const auto prevVerbosity = vtkPVLogger::GetCatalystVerbosity();
+  vtkPVLogger::SetCatalystVerbosity(vtkLogger::VERBOSITY_5);
+  std::vector<std::string> messages;
+  vtkLogger::AddCallback(
+    "TestCatalystCachedVerification", &RecordVerification, &messages, vtkLogger::VERBOSITY_5);
+
+  bool success = true;
+  Simulation sim(100);
+  std::vector<vtkInSituInitializationHelper::IngestionStatistics> statistics;
+  for (int timestep = 0; timestep < 3; ++timestep)
+  {
+    // the structure changes at the last step.
+    if (!Execute(sim, timestep, timestep == 2))
+    {
+      cerr << "ERROR: failed to execute Catalyst at step " << timestep << "." << endl;
+      success = false;
+    }
+    statistics.push_back(vtkInSituInitializationHelper::GetIngestionStatistics("grid"));
+  }
+
+  vtkLogger::RemoveCallback("TestCatalystCachedVerification");
+  vtkPVLogger::SetCatalystVerbosity(prevVerbosity);
+
+  success &= CheckVerification(messages, 0, "1 verified, 0 skipped");
+  success &= CheckVerification(messages, 1, "0 verified, 1 skipped");
+  success &= CheckVerification(messages, 2, "1 verified, 0 skipped");
+
+  // the values of the buffers change between the first two steps but not their
+  // sizes; the last step adds one more field.
+  std::vector<vtkTypeUInt64> totals;
+  for (const auto& stats : statistics)
+  {
+    totals.push_back(stats.BytesWrapped + stats.BytesCopied);
+  }
+  const vtkTypeUInt64 fieldBytes = sim.Temperature.size() * sizeof(double);
+  if (statistics[0].BytesWrapped == 0 || totals[1] != totals[0] ||
+    totals[2] != totals[1] + fieldBytes)
+  {
+    cerr << "ERROR: unexpected ingested bytes: " << totals[0] << ", " << totals[1] << ", "
+         << totals[2] << " (" << statistics[0].BytesWrapped << " wrapped at first step)." << endl;
+    success = false;
+  }
+
+  conduit_cpp::Node finalize;
+  if (catalyst_finalize(conduit_cpp::c_node(&finalize)) != catalyst_status_ok)
+  {
+    cerr << "ERROR: failed to finalize Catalyst." << endl;
+    success = false;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -39,6 +39,99 @@
 
 #include "catalyst_impl_paraview.h"
 
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace
+{
+// When enabled, blueprint verification of the `catalyst_execute` node and of
+// its channels is skipped as long as their structure matches the one of a node
+// that was already verified. The channels may be verified on the asynchronous
+// execution thread, hence the mutex.
+struct VerificationCache
+{
+  std::mutex Mutex;
+  bool Enabled = false;
+  std::map<std::string, std::size_t> Hashes;
+  vtkTypeUInt64 NumberOfVerifications = 0;
+  vtkTypeUInt64 NumberOfSkips = 0;
+};
+VerificationCache Verification;
+
+void reset_verification(bool enabled)
+{
+  std::lock_guard<std::mutex> lock(Verification.Mutex);
+  Verification.Enabled = enabled;
+  Verification.Hashes.clear();
+  Verification.NumberOfVerifications = 0;
+  Verification.NumberOfSkips = 0;
+}
+
+void hash_combine(std::size_t& seed, std::size_t value)
+{
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// Hash of the structure of a node tree: names, types and shapes of the nodes,
+// and string values. Numeric values are not part of the hash.
+std::size_t structure_hash(const conduit_cpp::Node& node)
+{
+  std::size_t seed = 0;
+  const conduit_datatype* dtype =
+    conduit_node_dtype(conduit_cpp::c_node(const_cast<conduit_cpp::Node*>(&node)));
+  hash_combine(seed, static_cast<std::size_t>(conduit_datatype_id(dtype)));
+  if (node.dtype().is_string())
+  {
+    hash_combine(seed, std::hash<std::string>{}(node.as_string()));
+  }
+  else
+  {
+    hash_combine(seed, static_cast<std::size_t>(conduit_datatype_number_of_elements(dtype)));
+    hash_combine(seed, static_cast<std::size_t>(conduit_datatype_offset(dtype)));
+    hash_combine(seed, static_cast<std::size_t>(conduit_datatype_stride(dtype)));
+  }
+  const conduit_index_t nchildren = node.number_of_children();
+  for (conduit_index_t cc = 0; cc < nchildren; ++cc)
+  {
+    const auto child = node.child(cc);
+    hash_combine(seed, std::hash<std::string>{}(child.name()));
+    hash_combine(seed, structure_hash(child));
+  }
+  return seed;
+}
+
+// Returns true if the structure of `node` was already verified for `key`.
+// Otherwise records its hash, to be discarded using `forget_verified` if
+// verification fails.
+bool is_verified(const std::string& key, const conduit_cpp::Node& node)
+{
+  std::lock_guard<std::mutex> lock(Verification.Mutex);
+  if (!Verification.Enabled)
+  {
+    ++Verification.NumberOfVerifications;
+    return false;
+  }
+  const std::size_t hash = structure_hash(node);
+  auto iter = Verification.Hashes.find(key);
+  if (iter != Verification.Hashes.end() && iter->second == hash)
+  {
+    ++Verification.NumberOfSkips;
+    return true;
+  }
+  Verification.Hashes[key] = hash;
+  ++Verification.NumberOfVerifications;
+  return false;
+}
+
+void forget_verified(const std::string& key)
+{
+  std::lock_guard<std::mutex> lock(Verification.Mutex);
+  Verification.Hashes.erase(key);
+}
+}
+
 static bool update_producer_mesh_blueprint(const std::string& channel_name,
   const conduit_node* node, const conduit_node* global_fields, bool multimesh,
   const conduit_node* assemblyNode, bool multiblock, bool amr)
@@ -261,6 +354,39 @@ enum catalyst_status catalyst_initialize_paraview(const conduit_node* params)
 #endif
   vtkInSituInitializationHelper::Initialize(comm);
 
+  if (cpp_params.has_path("catalyst/zero_copy"))
+  {
+    vtkInSituInitializationHelper::SetZeroCopyRequired(
+      cpp_params["catalyst/zero_copy"].to_int() != 0);
+  }
+
+  reset_verification(cpp_params.has_path("catalyst/cache_verification") &&
+    cpp_params["catalyst/cache_verification"].to_int() != 0);
+
+  if (cpp_params.has_path("catalyst/asynchronous"))
+  {
+    const auto asynchronous = cpp_params["catalyst/asynchronous"];
+    if (asynchronous.has_child("queue_size"))
+    {
+      vtkInSituInitializationHelper::SetMaximumNumberOfQueuedExecutions(
+        asynchronous["queue_size"].to_int());
+    }
+    if (asynchronous.has_child("policy"))
+    {
+      const std::string policy = asynchronous["policy"].as_string();
+      vtkInSituInitializationHelper::SetBackPressurePolicy(policy == "drop"
+          ? vtkInSituInitializationHelper::DROP
+          : (policy == "skip" ? vtkInSituInitializationHelper::SKIP
+                              : vtkInSituInitializationHelper::BLOCK));
+    }
+    if (asynchronous.has_child("skip_interval"))
+    {
+      vtkInSituInitializationHelper::SetSkipInterval(asynchronous["skip_interval"].to_int());
+    }
+    vtkInSituInitializationHelper::SetAsynchronousExecution(
+      asynchronous.has_child("enabled") && asynchronous["enabled"].to_int() != 0);
+  }
+
   if (cpp_params.has_path("catalyst/scripts"))
   {
     if (vtkInSituInitializationHelper::IsPythonSupported())
@@ -339,23 +465,14 @@ enum catalyst_status catalyst_initialize_paraview(const conduit_node* params)
 }
 
 //-----------------------------------------------------------------------------
-enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
+// Updates the producers of the channels passed to `catalyst_execute`. This is
+// called on the asynchronous execution thread when it is enabled.
+static void update_producers(const conduit_node* params)
 {
-  vtkVLogScopeFunction(PARAVIEW_LOG_CATALYST_VERBOSITY());
-
   const conduit_cpp::Node cpp_params = conduit_cpp::cpp_node(const_cast<conduit_node*>(params));
-  if (!cpp_params.has_path("catalyst"))
-  {
-    vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "Path 'catalyst' is not provided. Skipping.");
-    return pvcatalyst_err(invalid_node);
-  }
-
   const auto& root = cpp_params["catalyst"];
-  if (!vtkCatalystBlueprint::Verify("execute", root))
-  {
-    vtkLogF(ERROR, "invalid 'catalyst' node passed to 'catalyst_execute'. Execution failed.");
-    return pvcatalyst_err(invalid_node);
-  }
+  vtkTypeUInt64 verifications = 0;
+  vtkTypeUInt64 skips = 0;
 
   // catalyst/timestep or catalyst/cycle is used to indicate the timestep
   // catalyst/time is used to provide the time
@@ -399,8 +516,18 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
         ? channel_node["state/multiblock"].to_int()
         : output_multiblock;
 
-      if (type == "mesh")
+      const std::string verification_key = "channels/" + channel_name;
+      const bool verified = (type == "mesh" || type == "multimesh") &&
+        is_verified(verification_key, channel_node);
+      if (verified)
+      {
+        ++skips;
+        vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+          "structure of channel '%s' is unchanged; skipping verification.", channel_name.c_str());
+      }
+      else if (type == "mesh")
       {
+        ++verifications;
         conduit_cpp::Node info;
         is_valid = conduit_cpp::Blueprint::verify("mesh", data_node, info);
         if (!is_valid)
@@ -411,6 +538,7 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
       }
       else if (type == "multimesh")
       {
+        ++verifications;
         for (conduit_index_t didx = 0, dmax = data_node.number_of_children();
              didx < dmax && is_valid; ++didx)
         {
@@ -472,6 +600,7 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
 
       if (!is_valid)
       {
+        forget_verified(verification_key);
         continue; // skip this channel.
       }
 
@@ -517,7 +646,50 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
       "No 'catalyst/channels' found. No meshes will be processed.");
   }
 
-  vtkInSituInitializationHelper::ExecutePipelines(params);
+  std::lock_guard<std::mutex> lock(Verification.Mutex);
+  vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+    "channel verification: %llu verified, %llu skipped (total: %llu verified, %llu skipped)",
+    static_cast<unsigned long long>(verifications), static_cast<unsigned long long>(skips),
+    static_cast<unsigned long long>(Verification.NumberOfVerifications),
+    static_cast<unsigned long long>(Verification.NumberOfSkips));
+}
+
+//-----------------------------------------------------------------------------
+enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
+{
+  vtkVLogScopeFunction(PARAVIEW_LOG_CATALYST_VERBOSITY());
+
+  const conduit_cpp::Node cpp_params = conduit_cpp::cpp_node(const_cast<conduit_node*>(params));
+  if (!cpp_params.has_path("catalyst"))
+  {
+    vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "Path 'catalyst' is not provided. Skipping.");
+    return pvcatalyst_err(invalid_node);
+  }
+
+  const auto& root = cpp_params["catalyst"];
+  if (!is_verified("execute", root) && !vtkCatalystBlueprint::Verify("execute", root))
+  {
+    forget_verified("execute");
+    vtkLogF(ERROR, "invalid 'catalyst' node passed to 'catalyst_execute'. Execution failed.");
+    return pvcatalyst_err(invalid_node);
+  }
+
+  // recorded before the parameters are copied for asynchronous execution.
+  if (root.has_child("channels"))
+  {
+    const auto channels = root["channels"];
+    for (conduit_index_t i = 0; i < channels.number_of_children(); ++i)
+    {
+      const auto channel_node = channels.child(i);
+      if (channel_node.has_path("state/stable_buffers"))
+      {
+        vtkInSituInitializationHelper::SetBuffersStable(
+          channel_node.name(), channel_node["state/stable_buffers"].to_int() != 0);
+      }
+    }
+  }
+
+  vtkInSituInitializationHelper::ExecutePipelines(params, &update_producers);
 
   return catalyst_status_ok;
 }
@@ -535,6 +707,7 @@ enum catalyst_status catalyst_finalize_paraview(const conduit_node* params)
   }
 
   vtkInSituInitializationHelper::Finalize();
+  reset_verification(false);
 
   return catalyst_status_ok;
 }
@@ -557,6 +730,9 @@ enum catalyst_status catalyst_about_paraview(conduit_node* params)
 //-----------------------------------------------------------------------------
 enum catalyst_status catalyst_results_paraview(conduit_node* params)
 {
+  // the steerable proxies are updated by the pipelines.
+  vtkInSituInitializationHelper::WaitForPipelines();
+
   auto stub_error_status = catalyst_stub_results(params);
 
   if (stub_error_status != catalyst_status_ok)
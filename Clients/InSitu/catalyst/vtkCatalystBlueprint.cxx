@@ -240,6 +240,44 @@ bool verify(const std::string& protocol, const conduit_cpp::Node& n)
       return false;
     }
   }
+  if (n.has_child("zero_copy") && !n["zero_copy"].dtype().is_integer())
+  {
+    vtkLogF(ERROR, "'zero_copy' must be an integer.");
+    return false;
+  }
+  if (n.has_child("cache_verification") && !n["cache_verification"].dtype().is_integer())
+  {
+    vtkLogF(ERROR, "'cache_verification' must be an integer.");
+    return false;
+  }
+  if (n.has_child("asynchronous"))
+  {
+    const auto asynchronous = n["asynchronous"];
+    if (!asynchronous.dtype().is_object())
+    {
+      vtkLogF(ERROR, "'asynchronous' must be an 'object'.");
+      return false;
+    }
+    for (const char* name : { "enabled", "queue_size", "skip_interval" })
+    {
+      if (asynchronous.has_child(name) && !asynchronous[name].dtype().is_integer())
+      {
+        vtkLogF(ERROR, "'asynchronous/%s' must be an integer.", name);
+        return false;
+      }
+    }
+    if (asynchronous.has_child("policy"))
+    {
+      const auto policy = asynchronous["policy"];
+      if (!policy.dtype().is_string() ||
+        (policy.as_string() != "block" && policy.as_string() != "drop" &&
+          policy.as_string() != "skip"))
+      {
+        vtkLogF(ERROR, "'asynchronous/policy' must be 'block', 'drop' or 'skip'.");
+        return false;
+      }
+    }
+  }
   return true;
 }
 
@@ -385,6 +423,12 @@ bool verify(const std::string& protocol, const conduit_cpp::Node& n)
     return false;
   }
 
+  if (n.has_path("state/stable_buffers") && !n["state/stable_buffers"].dtype().is_integer())
+  {
+    vtkLogF(ERROR, "'state/stable_buffers' must be an integer.");
+    return false;
+  }
+
   auto type = n["type"].as_string();
   if (type == "mesh")
   {
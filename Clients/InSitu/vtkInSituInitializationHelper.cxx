@@ -1,15 +1,22 @@
 // SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
 // SPDX-License-Identifier: BSD-3-Clause
+#if VTK_MODULE_ENABLE_ParaView_PythonCatalyst
+#include "vtkPython.h" // must be first
+#endif
+
 #include "vtkInSituInitializationHelper.h"
 
 #include "vtkArrayDispatch.h"
 #include "vtkCPCxxHelper.h"
 #include "vtkCallbackCommand.h"
+#include "vtkCellArray.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkCompositeDataSet.h"
 #if VTK_MODULE_ENABLE_VTK_IOCatalystConduit
 #include "vtkConduitSource.h"
 #include <catalyst_conduit.hpp>
 #endif
-#include "vtkDataArrayAccessor.h"
+#include "vtkDataArrayRange.h"
 #include "vtkFieldData.h"
 #include "vtkInSituPipelinePython.h"
 #include "vtkMultiBlockDataSet.h"
@@ -20,6 +27,10 @@
 #include "vtkPVXMLElement.h"
 #include "vtkPartitionedDataSet.h"
 #include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkSOADataArrayTemplate.h"
 #include "vtkSMDoubleVectorProperty.h"
 #include "vtkSMIdTypeVectorProperty.h"
 #include "vtkSMIntVectorProperty.h"
@@ -30,13 +41,22 @@
 #include "vtkSMSourceProxy.h"
 #include "vtkSmartPointer.h"
 #include "vtkSteeringDataGenerator.h"
+#include "vtkTimeStamp.h"
+#include "vtkUnstructuredGrid.h"
 #include "vtksys/SystemTools.hxx"
 
 #include <algorithm>
 #include <cctype>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #if VTK_MODULE_ENABLE_ParaView_PythonCatalyst
 extern "C"
@@ -74,17 +94,45 @@ public:
   std::map<vtkSMProxy*, std::string> SteerableProxies;
   std::map<vtkSMProxy*, std::string> SteerableExtracts;
 
+  // The mutex protects the state below, up to the asynchronous execution
+  // state: it is written by the execution thread and may be read by the
+  // simulation thread.
+  std::mutex StateMutex;
   bool InExecutePipelines = false;
   bool InResultsPipelines = false;
   int TimeStep = 0;
   double Time = 0.0;
+  bool ZeroCopyRequired = false;
+  std::set<std::string> StableChannels;
+  std::map<std::string, vtkInSituInitializationHelper::IngestionStatistics> IngestionStatistics;
 #if VTK_MODULE_ENABLE_VTK_IOCatalystConduit
   // pointer arguments of the current catalyst call
   conduit_node* catalyst_params = nullptr;
 #endif
+
+  // Asynchronous execution. The mutex protects the queue, `Executing` and the
+  // back-pressure settings; the producers and pipelines are only used by the
+  // execution thread while it runs.
+  struct QueuedExecution
+  {
+    std::shared_ptr<conduit_node> Parameters;
+    std::function<void(const conduit_node*)> UpdateProducers;
+  };
+  bool AsynchronousExecution = false;
+  int MaximumNumberOfQueuedExecutions = 1;
+  int BackPressurePolicy = vtkInSituInitializationHelper::BLOCK;
+  int SkipInterval = 2;
+  int NumberOfSkippedExecutions = 0;
+  bool SynchronousFallbackReported = false;
+  std::deque<QueuedExecution> Queue;
+  bool Executing = false;
+  bool StopExecutionThread = false;
+  std::mutex QueueMutex;
+  std::condition_variable QueueCondition;
+  std::thread ExecutionThread;
 };
 
-template <typename PropertyType>
+template <typename PropertyType, typename ElementType>
 struct PropertyCopier
 {
   PropertyType* SMProperty = nullptr;
@@ -92,24 +140,22 @@ struct PropertyCopier
   template <typename ArrayType>
   void operator()(ArrayType* array)
   {
-    const vtkIdType numTuples = array->GetNumberOfTuples();
-    const int numComponents = array->GetNumberOfComponents();
-    this->SMProperty->SetNumberOfElements(static_cast<unsigned int>(numTuples * numComponents));
-    vtkDataArrayAccessor<ArrayType> accessor(array);
-    for (vtkIdType cc = 0; cc < numTuples; ++cc)
+    // set all the elements at once, instead of one modification per element.
+    const auto range = vtk::DataArrayValueRange(array);
+    std::vector<ElementType> values;
+    values.reserve(range.size());
+    for (const auto value : range)
     {
-      for (int comp = 0; comp < numComponents; ++comp)
-      {
-        this->SMProperty->SetElement(cc * numComponents + comp, accessor.Get(cc, comp));
-      }
+      values.push_back(static_cast<ElementType>(value));
     }
+    this->SMProperty->SetElements(values.data(), static_cast<unsigned int>(values.size()));
   }
 };
 
-template <typename T>
+template <typename T, typename ElementType>
 void SetPropertyValue(T* prop, vtkDataArray* array)
 {
-  PropertyCopier<T> copier;
+  PropertyCopier<T, ElementType> copier;
   copier.SMProperty = prop;
   using Dispatcher = vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::AllTypes>;
   if (!Dispatcher::Execute(array, copier))
@@ -118,6 +164,242 @@ void SetPropertyValue(T* prop, vtkDataArray* array)
   }
 }
 
+#if VTK_MODULE_ENABLE_VTK_IOCatalystConduit
+namespace
+{
+// Address ranges of the numeric leaves of a conduit node tree.
+using BufferRanges = std::vector<std::pair<const char*, const char*>>;
+
+void CollectBuffers(conduit_node* node, BufferRanges& buffers)
+{
+  const conduit_index_t nchildren = conduit_node_number_of_children(node);
+  for (conduit_index_t cc = 0; cc < nchildren; ++cc)
+  {
+    CollectBuffers(conduit_node_child(node, cc), buffers);
+  }
+  const conduit_datatype* dtype = conduit_node_dtype(node);
+  const conduit_index_t count = conduit_datatype_number_of_elements(dtype);
+  if (nchildren == 0 && conduit_datatype_is_number(dtype) && count > 0)
+  {
+    const char* begin = static_cast<const char*>(conduit_node_element_ptr(node, 0));
+    buffers.emplace_back(begin,
+      begin + (count - 1) * conduit_datatype_stride(dtype) + conduit_datatype_element_bytes(dtype));
+  }
+}
+
+// Copies the `catalyst_execute` parameters for a queued execution. The data of
+// the stable channels is referenced instead, since the simulation keeps these
+// buffers for the pipelines. Returns the names of the channels whose data was
+// copied.
+std::vector<std::string> CopyParameters(const conduit_cpp::Node& params, conduit_cpp::Node& copy,
+  const std::set<std::string>& stableChannels)
+{
+  std::vector<std::string> copiedChannels;
+  const auto copyChild = [](const conduit_cpp::Node& src, conduit_cpp::Node& dst,
+                           bool external) {
+    auto node = dst[src.name()];
+    if (external)
+    {
+      conduit_node_set_external_node(
+        conduit_cpp::c_node(&node), const_cast<conduit_node*>(conduit_cpp::c_node(&src)));
+    }
+    else
+    {
+      conduit_node_set_node(
+        conduit_cpp::c_node(&node), const_cast<conduit_node*>(conduit_cpp::c_node(&src)));
+    }
+  };
+
+  for (conduit_index_t i = 0; i < params.number_of_children(); ++i)
+  {
+    const auto child = params.child(i);
+    if (child.name() != "catalyst" || !child.has_child("channels"))
+    {
+      copyChild(child, copy, false);
+      continue;
+    }
+    auto catalyst = copy["catalyst"];
+    for (conduit_index_t j = 0; j < child.number_of_children(); ++j)
+    {
+      const auto catalystChild = child.child(j);
+      if (catalystChild.name() != "channels")
+      {
+        copyChild(catalystChild, catalyst, false);
+        continue;
+      }
+      auto channels = catalyst["channels"];
+      for (conduit_index_t k = 0; k < catalystChild.number_of_children(); ++k)
+      {
+        const auto channel = catalystChild.child(k);
+        if (stableChannels.count(channel.name()) == 0)
+        {
+          copyChild(channel, channels, false);
+          if (channel.has_child("data"))
+          {
+            copiedChannels.push_back(channel.name());
+          }
+          continue;
+        }
+        auto channelCopy = channels[channel.name()];
+        for (conduit_index_t l = 0; l < channel.number_of_children(); ++l)
+        {
+          const auto channelChild = channel.child(l);
+          copyChild(channelChild, channelCopy, channelChild.name() == "data");
+        }
+      }
+    }
+  }
+  return copiedChannels;
+}
+
+template <typename ValueType>
+bool AppendSOABuffers(vtkDataArray* array, std::vector<const void*>& pointers)
+{
+  auto soa = vtkSOADataArrayTemplate<ValueType>::FastDownCast(array);
+  if (!soa)
+  {
+    return false;
+  }
+  for (int comp = 0; comp < soa->GetNumberOfComponents(); ++comp)
+  {
+    pointers.push_back(soa->GetComponentArrayPointer(comp));
+  }
+  return true;
+}
+
+// Counts the bytes of the arrays of a mesh, depending on whether they
+// reference the simulation buffers or not.
+class IngestionCounter
+{
+public:
+  explicit IngestionCounter(const BufferRanges& buffers)
+    : Buffers(buffers)
+  {
+  }
+
+  void AddDataObject(vtkDataObject* dobj)
+  {
+    if (auto cd = vtkCompositeDataSet::SafeDownCast(dobj))
+    {
+      this->AddFieldData(cd->GetFieldData());
+      vtkSmartPointer<vtkCompositeDataIterator> iter;
+      iter.TakeReference(cd->NewIterator());
+      for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+      {
+        this->AddDataObject(iter->GetCurrentDataObject());
+      }
+      return;
+    }
+    if (!dobj)
+    {
+      return;
+    }
+    for (int type : { vtkDataObject::POINT, vtkDataObject::CELL, vtkDataObject::FIELD })
+    {
+      this->AddFieldData(dobj->GetAttributesAsFieldData(type));
+    }
+    if (auto ps = vtkPointSet::SafeDownCast(dobj))
+    {
+      this->AddArray(ps->GetPoints() ? ps->GetPoints()->GetData() : nullptr);
+    }
+    if (auto ug = vtkUnstructuredGrid::SafeDownCast(dobj))
+    {
+      this->AddCells(ug->GetCells());
+      this->AddArray(ug->GetCellTypesArray());
+    }
+    else if (auto pd = vtkPolyData::SafeDownCast(dobj))
+    {
+      this->AddCells(pd->GetVerts());
+      this->AddCells(pd->GetLines());
+      this->AddCells(pd->GetPolys());
+      this->AddCells(pd->GetStrips());
+    }
+    else if (auto rg = vtkRectilinearGrid::SafeDownCast(dobj))
+    {
+      this->AddArray(rg->GetXCoordinates());
+      this->AddArray(rg->GetYCoordinates());
+      this->AddArray(rg->GetZCoordinates());
+    }
+  }
+
+  vtkInSituInitializationHelper::IngestionStatistics Statistics;
+  std::vector<std::string> CopiedArrays;
+
+private:
+  void AddFieldData(vtkFieldData* fd)
+  {
+    for (int cc = 0, max = fd ? fd->GetNumberOfArrays() : 0; cc < max; ++cc)
+    {
+      this->AddArray(fd->GetArray(cc));
+    }
+  }
+
+  void AddCells(vtkCellArray* cells)
+  {
+    if (cells)
+    {
+      this->AddArray(cells->GetOffsetsArray());
+      this->AddArray(cells->GetConnectivityArray());
+    }
+  }
+
+  void AddArray(vtkDataArray* array)
+  {
+    if (!array || array->GetNumberOfValues() == 0 || !this->Visited.insert(array).second)
+    {
+      return;
+    }
+
+    std::vector<const void*> pointers;
+    if (array->HasStandardMemoryLayout())
+    {
+      pointers.push_back(array->GetVoidPointer(0));
+    }
+    else if (!(AppendSOABuffers<float>(array, pointers) ||
+               AppendSOABuffers<double>(array, pointers) ||
+               AppendSOABuffers<char>(array, pointers) ||
+               AppendSOABuffers<signed char>(array, pointers) ||
+               AppendSOABuffers<unsigned char>(array, pointers) ||
+               AppendSOABuffers<short>(array, pointers) ||
+               AppendSOABuffers<unsigned short>(array, pointers) ||
+               AppendSOABuffers<int>(array, pointers) ||
+               AppendSOABuffers<unsigned int>(array, pointers) ||
+               AppendSOABuffers<long>(array, pointers) ||
+               AppendSOABuffers<unsigned long>(array, pointers) ||
+               AppendSOABuffers<long long>(array, pointers) ||
+               AppendSOABuffers<unsigned long long>(array, pointers)))
+    {
+      // implicit arrays, or arrays with an unknown memory layout.
+      return;
+    }
+
+    const vtkTypeUInt64 bytes =
+      static_cast<vtkTypeUInt64>(array->GetNumberOfValues()) * array->GetDataTypeSize();
+    const bool wrapped =
+      std::all_of(pointers.begin(), pointers.end(), [this](const void* pointer) {
+        const char* address = static_cast<const char*>(pointer);
+        return std::any_of(this->Buffers.begin(), this->Buffers.end(),
+          [address](const std::pair<const char*, const char*>& range) {
+            return range.first <= address && address < range.second;
+          });
+      });
+    if (wrapped)
+    {
+      this->Statistics.BytesWrapped += bytes;
+    }
+    else
+    {
+      this->Statistics.BytesCopied += bytes;
+      this->CopiedArrays.emplace_back(array->GetName() ? array->GetName() : "(unnamed)");
+    }
+  }
+
+  const BufferRanges& Buffers;
+  std::set<vtkDataArray*> Visited;
+};
+}
+#endif
+
 int vtkInSituInitializationHelper::WasInitializedOnce;
 int vtkInSituInitializationHelper::WasFinalizedOnce;
 vtkInSituInitializationHelper::vtkInternals* vtkInSituInitializationHelper::Internals;
@@ -206,6 +488,8 @@ void vtkInSituInitializationHelper::Finalize()
     return;
   }
 
+  vtkInSituInitializationHelper::StopAsynchronousExecution();
+
   // finalize pipelines.
   const auto& internals = (*vtkInSituInitializationHelper::Internals);
   for (auto& item : internals.Pipelines)
@@ -386,8 +670,11 @@ bool vtkInSituInitializationHelper::ExecutePipelines(const conduit_node* params)
 #if VTK_MODULE_ENABLE_VTK_IOCatalystConduit
 
   auto& internals = (*vtkInSituInitializationHelper::Internals);
-  // store a pointer to the catalyst_execute parameters. This will be accessible from python.
-  internals.catalyst_params = const_cast<conduit_node*>(params);
+  {
+    // store a pointer to the catalyst_execute parameters. This will be accessible from python.
+    std::lock_guard<std::mutex> lock(internals.StateMutex);
+    internals.catalyst_params = const_cast<conduit_node*>(params);
+  }
 
   const conduit_cpp::Node& cpp_params = conduit_cpp::cpp_node(const_cast<conduit_node*>(params));
   const auto& root = cpp_params["catalyst"];
@@ -429,7 +716,12 @@ bool vtkInSituInitializationHelper::ExecutePipelines(const conduit_node* params)
     }
   }
 
-  return vtkInSituInitializationHelper::ExecutePipelines(timestep, time, pipelines, parameters);
+  vtkTimeStamp executeTime;
+  executeTime.Modified();
+  const bool status =
+    vtkInSituInitializationHelper::ExecutePipelines(timestep, time, pipelines, parameters);
+  vtkInSituInitializationHelper::UpdateIngestionStatistics(params, executeTime);
+  return status;
 #else
   vtkLogF(ERROR, "ParaView is compiled without Conduit support");
   (void)(params);
@@ -437,6 +729,197 @@ bool vtkInSituInitializationHelper::ExecutePipelines(const conduit_node* params)
 #endif
 }
 
+//----------------------------------------------------------------------------
+bool vtkInSituInitializationHelper::ExecutePipelines(const conduit_node* params,
+  const std::function<void(const conduit_node*)>& updateProducers)
+{
+#if VTK_MODULE_ENABLE_VTK_IOCatalystConduit
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    vtkLogF(ERROR, "'ExecutePipelines' cannot be called before 'Initialize'.");
+    return false;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  if (!internals.AsynchronousExecution ||
+    !vtkInSituInitializationHelper::CanExecuteAsynchronously())
+  {
+    // executions queued before falling back must be done first.
+    vtkInSituInitializationHelper::WaitForPipelines();
+    updateProducers(params);
+    return vtkInSituInitializationHelper::ExecutePipelines(params);
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(internals.QueueMutex);
+    const bool pending = internals.Executing || !internals.Queue.empty();
+    const bool full =
+      static_cast<int>(internals.Queue.size()) >= internals.MaximumNumberOfQueuedExecutions;
+    if (internals.BackPressurePolicy == vtkInSituInitializationHelper::DROP && full)
+    {
+      vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "execution queue is full; dropping execution.");
+      return true;
+    }
+    if (internals.BackPressurePolicy == vtkInSituInitializationHelper::SKIP)
+    {
+      internals.NumberOfSkippedExecutions = pending ? internals.NumberOfSkippedExecutions + 1 : 0;
+      if (pending && internals.NumberOfSkippedExecutions % internals.SkipInterval != 0)
+      {
+        vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "executions are pending; skipping execution.");
+        return true;
+      }
+    }
+    if (full)
+    {
+      vtkVLogScopeF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "waiting for a slot in execution queue");
+      internals.QueueCondition.wait(lock, [&internals]() {
+        return static_cast<int>(internals.Queue.size()) <
+          internals.MaximumNumberOfQueuedExecutions;
+      });
+    }
+  }
+
+  // copy the parameters, since the simulation may change its buffers as soon
+  // as this returns. The producers then reference the copy, or the simulation
+  // buffers for the stable channels.
+  std::set<std::string> stableChannels;
+  {
+    std::lock_guard<std::mutex> lock(internals.StateMutex);
+    stableChannels = internals.StableChannels;
+  }
+  vtkInternals::QueuedExecution execution;
+  execution.Parameters.reset(conduit_node_create(), conduit_node_destroy);
+  conduit_cpp::Node copy = conduit_cpp::cpp_node(execution.Parameters.get());
+  const std::vector<std::string> copiedChannels = ::CopyParameters(
+    conduit_cpp::cpp_node(const_cast<conduit_node*>(params)), copy, stableChannels);
+  execution.UpdateProducers = updateProducers;
+  if (internals.ZeroCopyRequired)
+  {
+    for (const auto& name : copiedChannels)
+    {
+      vtkLogF(WARNING,
+        "channel '%s': buffers were copied for asynchronous execution since they are not "
+        "stable.",
+        name.c_str());
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(internals.QueueMutex);
+  if (!internals.ExecutionThread.joinable())
+  {
+    internals.StopExecutionThread = false;
+    internals.ExecutionThread = std::thread(&vtkInSituInitializationHelper::ExecuteQueuedPipelines);
+  }
+  internals.Queue.push_back(std::move(execution));
+  internals.QueueCondition.notify_all();
+  return true;
+#else
+  vtkLogF(ERROR, "ParaView is compiled without Conduit support");
+  (void)(params);
+  (void)(updateProducers);
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::ExecuteQueuedPipelines()
+{
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  while (true)
+  {
+    vtkInternals::QueuedExecution execution;
+    {
+      std::unique_lock<std::mutex> lock(internals.QueueMutex);
+      internals.QueueCondition.wait(
+        lock, [&internals]() { return internals.StopExecutionThread || !internals.Queue.empty(); });
+      if (internals.Queue.empty())
+      {
+        return;
+      }
+      execution = std::move(internals.Queue.front());
+      internals.Queue.pop_front();
+      internals.Executing = true;
+    }
+    internals.QueueCondition.notify_all();
+
+    execution.UpdateProducers(execution.Parameters.get());
+    vtkInSituInitializationHelper::ExecutePipelines(execution.Parameters.get());
+
+    {
+      std::lock_guard<std::mutex> lock(internals.QueueMutex);
+      internals.Executing = false;
+    }
+    internals.QueueCondition.notify_all();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::WaitForPipelines()
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    return;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::unique_lock<std::mutex> lock(internals.QueueMutex);
+  internals.QueueCondition.wait(
+    lock, [&internals]() { return !internals.Executing && internals.Queue.empty(); });
+}
+
+//----------------------------------------------------------------------------
+bool vtkInSituInitializationHelper::CanExecuteAsynchronously()
+{
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  const bool hasPythonPipelines = std::any_of(internals.Pipelines.begin(),
+    internals.Pipelines.end(), [](const vtkInternals::PipelineInfo& item) {
+      return vtkInSituPipelinePython::SafeDownCast(item.Pipeline) != nullptr;
+    });
+  if (!hasPythonPipelines)
+  {
+    return true;
+  }
+
+  // Python pipelines acquire the GIL on the execution thread. A simulation
+  // calling `catalyst_execute` from Python holds it, and would wait for the
+  // execution thread that waits for the GIL.
+#if VTK_MODULE_ENABLE_ParaView_PythonCatalyst && defined(VTK_PYTHON_FULL_THREADSAFE)
+  const bool canExecute = !Py_IsInitialized() || !PyGILState_Check();
+  const char* reason = "the simulation holds the Python GIL";
+#else
+  const bool canExecute = false;
+  const char* reason = "VTK is not built with 'VTK_PYTHON_FULL_THREADSAFE'";
+#endif
+  if (!canExecute && !internals.SynchronousFallbackReported)
+  {
+    vtkLogF(WARNING,
+      "Python pipelines cannot be executed asynchronously since %s. "
+      "Pipelines will be executed synchronously.",
+      reason);
+    internals.SynchronousFallbackReported = true;
+  }
+  return canExecute;
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::StopAsynchronousExecution()
+{
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  if (!internals.ExecutionThread.joinable())
+  {
+    return;
+  }
+
+  // the queued executions are done before the thread exits.
+  {
+    std::lock_guard<std::mutex> lock(internals.QueueMutex);
+    internals.StopExecutionThread = true;
+  }
+  internals.QueueCondition.notify_all();
+  internals.ExecutionThread.join();
+}
+
+//----------------------------------------------------------------------------
 bool vtkInSituInitializationHelper::ExecutePipelines(int timestep, double time,
   const std::vector<std::string>& pipelines, const std::vector<std::string>& parameters)
 {
@@ -449,15 +932,18 @@ bool vtkInSituInitializationHelper::ExecutePipelines(int timestep, double time,
   }
 
   auto& internals = (*vtkInSituInitializationHelper::Internals);
-  if (internals.InExecutePipelines)
   {
-    vtkLogF(ERROR, "Recursive call to 'ExecutePipelines' not supported!");
-    return false;
-  }
+    std::lock_guard<std::mutex> lock(internals.StateMutex);
+    if (internals.InExecutePipelines)
+    {
+      vtkLogF(ERROR, "Recursive call to 'ExecutePipelines' not supported!");
+      return false;
+    }
 
-  internals.InExecutePipelines = true;
-  internals.TimeStep = timestep;
-  internals.Time = time;
+    internals.InExecutePipelines = true;
+    internals.TimeStep = timestep;
+    internals.Time = time;
+  }
 
   UpdateSteerableProxies();
 
@@ -495,6 +981,7 @@ bool vtkInSituInitializationHelper::ExecutePipelines(int timestep, double time,
     }
   }
 
+  std::lock_guard<std::mutex> lock(internals.StateMutex);
   internals.InExecutePipelines = false;
   return true;
 }
@@ -502,44 +989,49 @@ bool vtkInSituInitializationHelper::ExecutePipelines(int timestep, double time,
 bool vtkInSituInitializationHelper::GetResultsFromPipelines(conduit_node* catalyst_params)
 {
 #if VTK_MODULE_ENABLE_VTK_IOCatalystConduit
-  auto& internals = (*vtkInSituInitializationHelper::Internals);
-  if (internals.InExecutePipelines)
-  {
-    vtkLogF(ERROR, "Calling ExecutePipelines during GetResultsFromPipelines is not supported!");
-    return false;
-  }
-
-  if (internals.InResultsPipelines)
-  {
-    vtkLogF(ERROR, "Recursive call to 'GetResultsFromPipelines' not supported!");
-    return false;
-  }
-
-  internals.InResultsPipelines = true;
-
-  // store a pointer to the catalyst_results parameters. This will be accessible from python.
-  internals.catalyst_params = catalyst_params;
+  vtkInSituInitializationHelper::WaitForPipelines();
 
-  // By default we use the time & timestep information from the previous catalyst_execute run.
-  // However, a user may override it using the "catalyst/state/time" and "catalyst/state/timestep"
-  // paths
-  const conduit_cpp::Node& cpp_params = conduit_cpp::cpp_node(catalyst_params);
-  if (cpp_params.has_path("catalyst"))
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
   {
-    const auto& root = cpp_params["catalyst"];
-
-    if (root.has_path("state/timestep"))
+    std::lock_guard<std::mutex> lock(internals.StateMutex);
+    if (internals.InExecutePipelines)
     {
-      internals.TimeStep = root["state/timestep"].to_int64();
+      vtkLogF(ERROR, "Calling ExecutePipelines during GetResultsFromPipelines is not supported!");
+      return false;
     }
-    else if (root.has_path("state/cycle"))
+
+    if (internals.InResultsPipelines)
     {
-      internals.TimeStep = root["state/cycle"].to_int64();
+      vtkLogF(ERROR, "Recursive call to 'GetResultsFromPipelines' not supported!");
+      return false;
     }
 
-    if (root.has_path("state/time"))
+    internals.InResultsPipelines = true;
+
+    // store a pointer to the catalyst_results parameters. This will be accessible from python.
+    internals.catalyst_params = catalyst_params;
+
+    // By default we use the time & timestep information from the previous catalyst_execute run.
+    // However, a user may override it using the "catalyst/state/time" and
+    // "catalyst/state/timestep" paths
+    const conduit_cpp::Node& cpp_params = conduit_cpp::cpp_node(catalyst_params);
+    if (cpp_params.has_path("catalyst"))
     {
-      internals.Time = root["state/time"].to_float64();
+      const auto& root = cpp_params["catalyst"];
+
+      if (root.has_path("state/timestep"))
+      {
+        internals.TimeStep = root["state/timestep"].to_int64();
+      }
+      else if (root.has_path("state/cycle"))
+      {
+        internals.TimeStep = root["state/cycle"].to_int64();
+      }
+
+      if (root.has_path("state/time"))
+      {
+        internals.Time = root["state/time"].to_float64();
+      }
     }
   }
 
@@ -551,6 +1043,7 @@ bool vtkInSituInitializationHelper::GetResultsFromPipelines(conduit_node* cataly
     }
   }
 
+  std::lock_guard<std::mutex> lock(internals.StateMutex);
   internals.InResultsPipelines = false;
 
   return true;
@@ -695,15 +1188,15 @@ void vtkInSituInitializationHelper::UpdateSteerableProxies()
       {
         if (auto dp = vtkSMDoubleVectorProperty::SafeDownCast(property))
         {
-          SetPropertyValue<vtkSMDoubleVectorProperty>(dp, array);
+          SetPropertyValue<vtkSMDoubleVectorProperty, double>(dp, array);
         }
         else if (auto ip = vtkSMIntVectorProperty::SafeDownCast(property))
         {
-          SetPropertyValue<vtkSMIntVectorProperty>(ip, array);
+          SetPropertyValue<vtkSMIntVectorProperty, int>(ip, array);
         }
         else if (auto idp = vtkSMIdTypeVectorProperty::SafeDownCast(property))
         {
-          SetPropertyValue<vtkSMIdTypeVectorProperty>(idp, array);
+          SetPropertyValue<vtkSMIdTypeVectorProperty, vtkIdType>(idp, array);
         }
         else
         {
@@ -719,6 +1212,276 @@ void vtkInSituInitializationHelper::UpdateSteerableProxies()
 #endif
 }
 
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::UpdateIngestionStatistics(
+  const conduit_node* params, vtkMTimeType since)
+{
+#if VTK_MODULE_ENABLE_VTK_IOCatalystConduit
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::map<std::string, IngestionStatistics> statistics;
+  std::set<std::string> stableChannels;
+  {
+    std::lock_guard<std::mutex> lock(internals.StateMutex);
+    stableChannels = internals.StableChannels;
+  }
+
+  const conduit_cpp::Node& cpp_params = conduit_cpp::cpp_node(const_cast<conduit_node*>(params));
+  if (!cpp_params.has_path("catalyst/channels"))
+  {
+    std::lock_guard<std::mutex> lock(internals.StateMutex);
+    internals.IngestionStatistics.clear();
+    return;
+  }
+  auto channels = cpp_params["catalyst/channels"];
+  for (const auto& pair : internals.Producers)
+  {
+    auto algo = vtkConduitSource::SafeDownCast(pair.second->GetClientSideObject());
+    vtkDataObject* output = algo ? algo->GetOutputDataObject(0) : nullptr;
+    // only consider the meshes that were produced for this step.
+    if (!output || output->GetUpdateTime() <= since || !channels.has_child(pair.first))
+    {
+      continue;
+    }
+
+    auto channel = channels[pair.first];
+    BufferRanges buffers;
+    ::CollectBuffers(conduit_cpp::c_node(&channel), buffers);
+    IngestionCounter counter(buffers);
+    counter.AddDataObject(output);
+    statistics[pair.first] = counter.Statistics;
+
+    vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+      "channel '%s': %llu bytes wrapped, %llu bytes copied (buffers are %s).", pair.first.c_str(),
+      static_cast<unsigned long long>(counter.Statistics.BytesWrapped),
+      static_cast<unsigned long long>(counter.Statistics.BytesCopied),
+      stableChannels.count(pair.first) ? "stable" : "not stable");
+    if (internals.ZeroCopyRequired && !counter.CopiedArrays.empty())
+    {
+      std::string names;
+      for (const auto& name : counter.CopiedArrays)
+      {
+        names += (names.empty() ? "'" : ", '") + name + "'";
+      }
+      vtkLogF(WARNING, "channel '%s': %llu bytes were copied instead of being wrapped: %s.",
+        pair.first.c_str(), static_cast<unsigned long long>(counter.Statistics.BytesCopied),
+        names.c_str());
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(internals.StateMutex);
+  internals.IngestionStatistics.swap(statistics);
+#else
+  (void)params;
+  (void)since;
+#endif
+}
+
+//----------------------------------------------------------------------------
+vtkInSituInitializationHelper::IngestionStatistics
+vtkInSituInitializationHelper::GetIngestionStatistics(const std::string& channelName)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    vtkLogF(ERROR, "'GetIngestionStatistics' cannot be called before 'Initialize'.");
+    return IngestionStatistics();
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::lock_guard<std::mutex> lock(internals.StateMutex);
+  auto iter = internals.IngestionStatistics.find(channelName);
+  return iter != internals.IngestionStatistics.end() ? iter->second : IngestionStatistics();
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::SetZeroCopyRequired(bool required)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    vtkLogF(ERROR, "'SetZeroCopyRequired' cannot be called before 'Initialize'.");
+    return;
+  }
+
+  vtkInSituInitializationHelper::Internals->ZeroCopyRequired = required;
+}
+
+//----------------------------------------------------------------------------
+bool vtkInSituInitializationHelper::GetZeroCopyRequired()
+{
+  return vtkInSituInitializationHelper::Internals != nullptr &&
+    vtkInSituInitializationHelper::Internals->ZeroCopyRequired;
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::SetBuffersStable(const std::string& channelName, bool stable)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    vtkLogF(ERROR, "'SetBuffersStable' cannot be called before 'Initialize'.");
+    return;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::lock_guard<std::mutex> lock(internals.StateMutex);
+  if (stable)
+  {
+    internals.StableChannels.insert(channelName);
+  }
+  else
+  {
+    internals.StableChannels.erase(channelName);
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkInSituInitializationHelper::GetBuffersStable(const std::string& channelName)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    return false;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::lock_guard<std::mutex> lock(internals.StateMutex);
+  return internals.StableChannels.count(channelName) != 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::SetAsynchronousExecution(bool enabled)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    vtkLogF(ERROR, "'SetAsynchronousExecution' cannot be called before 'Initialize'.");
+    return;
+  }
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  auto controller = vtkMultiProcessController::GetGlobalController();
+  int provided = MPI_THREAD_SINGLE;
+  if (enabled && controller && controller->GetNumberOfProcesses() > 1 &&
+    MPI_Query_thread(&provided) == MPI_SUCCESS && provided < MPI_THREAD_MULTIPLE)
+  {
+    vtkLogF(WARNING,
+      "Asynchronous execution requires MPI to be initialized with 'MPI_THREAD_MULTIPLE'. "
+      "Pipelines will be executed synchronously.");
+    enabled = false;
+  }
+#endif
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  if (!enabled)
+  {
+    vtkInSituInitializationHelper::StopAsynchronousExecution();
+  }
+  internals.AsynchronousExecution = enabled;
+  internals.SynchronousFallbackReported = false;
+}
+
+//----------------------------------------------------------------------------
+bool vtkInSituInitializationHelper::GetAsynchronousExecution()
+{
+  return vtkInSituInitializationHelper::Internals != nullptr &&
+    vtkInSituInitializationHelper::Internals->AsynchronousExecution;
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::SetMaximumNumberOfQueuedExecutions(int count)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    vtkLogF(ERROR, "'SetMaximumNumberOfQueuedExecutions' cannot be called before 'Initialize'.");
+    return;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::lock_guard<std::mutex> lock(internals.QueueMutex);
+  internals.MaximumNumberOfQueuedExecutions = std::max(count, 1);
+}
+
+//----------------------------------------------------------------------------
+int vtkInSituInitializationHelper::GetMaximumNumberOfQueuedExecutions()
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    return 1;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::lock_guard<std::mutex> lock(internals.QueueMutex);
+  return internals.MaximumNumberOfQueuedExecutions;
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::SetBackPressurePolicy(int policy)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    vtkLogF(ERROR, "'SetBackPressurePolicy' cannot be called before 'Initialize'.");
+    return;
+  }
+  if (policy < vtkInSituInitializationHelper::BLOCK || policy > vtkInSituInitializationHelper::SKIP)
+  {
+    vtkLogF(ERROR, "Invalid back-pressure policy '%d'.", policy);
+    return;
+  }
+
+  // Whether an execution is dropped or skipped depends on the progress of the
+  // execution thread of each rank. The ranks would then execute different
+  // pipelines, and their collective operations would not match.
+  auto controller = vtkMultiProcessController::GetGlobalController();
+  if (policy != vtkInSituInitializationHelper::BLOCK && controller &&
+    controller->GetNumberOfProcesses() > 1)
+  {
+    vtkLogF(WARNING,
+      "Only the 'block' back-pressure policy is supported when running on more than one rank. "
+      "Using 'block'.");
+    policy = vtkInSituInitializationHelper::BLOCK;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::lock_guard<std::mutex> lock(internals.QueueMutex);
+  internals.BackPressurePolicy = policy;
+}
+
+//----------------------------------------------------------------------------
+int vtkInSituInitializationHelper::GetBackPressurePolicy()
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    return vtkInSituInitializationHelper::BLOCK;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::lock_guard<std::mutex> lock(internals.QueueMutex);
+  return internals.BackPressurePolicy;
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::SetSkipInterval(int interval)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    vtkLogF(ERROR, "'SetSkipInterval' cannot be called before 'Initialize'.");
+    return;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::lock_guard<std::mutex> lock(internals.QueueMutex);
+  internals.SkipInterval = std::max(interval, 1);
+}
+
+//----------------------------------------------------------------------------
+int vtkInSituInitializationHelper::GetSkipInterval()
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    return 2;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::lock_guard<std::mutex> lock(internals.QueueMutex);
+  return internals.SkipInterval;
+}
+
 //----------------------------------------------------------------------------
 void vtkInSituInitializationHelper::UpdateAllProducers(double time)
 {
@@ -750,6 +1513,7 @@ int vtkInSituInitializationHelper::GetTimeStep()
   }
 
   auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::lock_guard<std::mutex> lock(internals.StateMutex);
   if (!internals.InExecutePipelines && !internals.InResultsPipelines)
   {
     vtkLogF(ERROR,
@@ -770,6 +1534,7 @@ double vtkInSituInitializationHelper::GetTime()
   }
 
   auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::lock_guard<std::mutex> lock(internals.StateMutex);
   if (!internals.InExecutePipelines && !internals.InResultsPipelines)
   {
     vtkLogF(
@@ -791,6 +1556,7 @@ conduit_node* vtkInSituInitializationHelper::GetCatalystParameters()
   }
 
   auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::lock_guard<std::mutex> lock(internals.StateMutex);
   if (!internals.InExecutePipelines && !internals.InResultsPipelines)
   {
     vtkLogF(ERROR,
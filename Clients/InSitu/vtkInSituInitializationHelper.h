@@ -43,8 +43,9 @@ class vtkSMSourceProxy;
 struct conduit_node_impl;
 typedef struct conduit_node_impl conduit_node;
 
-#include <string> // for std::string
-#include <vector> // for std::vector
+#include <functional> // for std::function
+#include <string>     // for std::string
+#include <vector>     // for std::vector
 
 class VTKPVINSITU_EXPORT vtkInSituInitializationHelper : public vtkObject
 {
@@ -125,6 +126,79 @@ public:
   // When using this overload the conduit node will become available also via the catalyst script
   static bool ExecutePipelines(const conduit_node* catalyst_state);
 
+  /**
+   * Calls `updateProducers` with the `catalyst_execute` parameters to update the
+   * producers and then executes the pipelines, like `ExecutePipelines`. When
+   * asynchronous execution is enabled, the parameters, including the buffers they
+   * reference, are copied and both steps run later on the execution thread, so
+   * this returns as soon as the copy is queued. The data of the channels whose
+   * buffers are stable is referenced instead of copied (see `SetBuffersStable`).
+   */
+  static bool ExecutePipelines(const conduit_node* catalyst_params,
+    const std::function<void(const conduit_node*)>& updateProducers);
+
+  /**
+   * Waits until all the queued asynchronous executions are done. Does nothing
+   * when asynchronous execution is disabled.
+   */
+  static void WaitForPipelines();
+
+  /**
+   * Policies applied when asynchronous executions are requested faster than the
+   * pipelines execute.
+   *
+   * * BLOCK: wait for a slot in the queue.
+   * * DROP: discard the new execution if the queue is full.
+   * * SKIP: while executions are pending, only queue one execution out of
+   *   `SkipInterval` and discard the others. Waits for a slot in the queue if
+   *   it is full.
+   */
+  enum BackPressurePolicies
+  {
+    BLOCK = 0,
+    DROP,
+    SKIP
+  };
+
+  ///@{
+  /**
+   * Enable asynchronous execution of the pipelines by
+   * `ExecutePipelines(catalyst_params, updateProducers)`. The pipelines are then
+   * executed on a dedicated thread while the simulation continues. This
+   * requires `MPI_THREAD_MULTIPLE` when running on more than one rank and, for
+   * Python pipelines, a VTK built with `VTK_PYTHON_FULL_THREADSAFE` and a
+   * simulation that does not hold the Python GIL when calling
+   * `ExecutePipelines`; otherwise, the pipelines are executed synchronously.
+   * This can be set using `catalyst/asynchronous/enabled` in the
+   * `catalyst_initialize` parameters. Default is false.
+   */
+  static void SetAsynchronousExecution(bool enabled);
+  static bool GetAsynchronousExecution();
+  ///@}
+
+  ///@{
+  /**
+   * Maximum number of asynchronous executions waiting for the one in progress.
+   * This can be set using `catalyst/asynchronous/queue_size`. Default is 1.
+   */
+  static void SetMaximumNumberOfQueuedExecutions(int count);
+  static int GetMaximumNumberOfQueuedExecutions();
+  ///@}
+
+  ///@{
+  /**
+   * Set the back-pressure policy and the interval used by the SKIP policy. These
+   * can be set using `catalyst/asynchronous/policy` ("block", "drop" or "skip")
+   * and `catalyst/asynchronous/skip_interval`. Defaults are BLOCK and 2. Only
+   * BLOCK is supported when running on more than one rank, since all ranks must
+   * execute the same pipelines.
+   */
+  static void SetBackPressurePolicy(int policy);
+  static int GetBackPressurePolicy();
+  static void SetSkipInterval(int interval);
+  static int GetSkipInterval();
+  ///@}
+
   /**
    * Call Results() on all pipelines.
    */
@@ -170,6 +244,49 @@ public:
   static void UpdateSteerableParameters(
     vtkSMProxy* steerableProxy, const char* steerableSourceName);
 
+  /**
+   * Sizes, in bytes, of the arrays of the mesh produced for a channel during
+   * the last `ExecutePipelines` call. `BytesWrapped` counts the arrays that
+   * reference the buffers passed by the simulation without copying them, and
+   * `BytesCopied` the arrays allocated by ParaView, either copies of the
+   * simulation buffers or generated arrays such as cell offsets. Arrays that do
+   * not store values, such as implicit arrays, are not counted. Both are zero if
+   * the mesh was not updated by any pipeline.
+   */
+  struct IngestionStatistics
+  {
+    vtkTypeUInt64 BytesWrapped = 0;
+    vtkTypeUInt64 BytesCopied = 0;
+  };
+  static IngestionStatistics GetIngestionStatistics(const std::string& channelName);
+
+  ///@{
+  /**
+   * When set, a warning naming the arrays that were copied is reported for
+   * every channel whose mesh did not only wrap the simulation buffers, and for
+   * every channel whose buffers were copied to be executed asynchronously. This can
+   * be set using `catalyst/zero_copy` in the `catalyst_initialize` parameters.
+   * Default is false.
+   */
+  static void SetZeroCopyRequired(bool required);
+  static bool GetZeroCopyRequired();
+  ///@}
+
+  ///@{
+  /**
+   * Indicate whether the buffers passed by the simulation for a channel are
+   * stable, i.e. they stay allocated and unchanged until the queued
+   * asynchronous executions are done, for instance until `WaitForPipelines`
+   * returns. The data of a stable channel is then referenced by the queued
+   * executions instead of being copied. This has no effect when the pipelines
+   * are executed synchronously, since the data is never copied then. This can
+   * be set using `catalyst/channels/<name>/state/stable_buffers` in the
+   * `catalyst_execute` parameters. Default is false.
+   */
+  static void SetBuffersStable(const std::string& channelName, bool stable);
+  static bool GetBuffersStable(const std::string& channelName);
+  ///@}
+
 protected:
   vtkInSituInitializationHelper();
   ~vtkInSituInitializationHelper() override;
@@ -179,6 +296,10 @@ private:
   void operator=(const vtkInSituInitializationHelper&) = delete;
 
   static void UpdateSteerableProxies();
+  static void ExecuteQueuedPipelines();
+  static bool CanExecuteAsynchronously();
+  static void StopAsynchronousExecution();
+  static void UpdateIngestionStatistics(const conduit_node* params, vtkMTimeType since);
   static int GetAttributeTypeFromString(const std::string& associationString);
 
   static int WasInitializedOnce;
@@ -0,0 +1,88 @@
+import os
+import tempfile
+
+from paraview import servermanager
+import paraview.simple as smp
+
+
+# Make sure the test driver know that process has properly started
+print ("Process started")
+
+
+def getHost(url):
+   return url.split(':')[1][2:]
+
+
+def getPort(url):
+   return int(url.split(':')[2])
+
+
+def saveState(numberOfPipelines, filename):
+    smp.ResetSession()
+    for i in range(numberOfPipelines):
+        sphere = smp.Sphere(ThetaResolution=8 + i)
+        smp.Shrink(Input=sphere)
+    smp.SaveState(filename)
+
+
+def loadState(filename, transactional):
+    """Loads the state in a fresh session and returns the number of messages
+    sent to the server and the number of round trips it took."""
+    smp.ResetSession()
+    session = servermanager.ActiveConnection.Session
+    messages = session.GetNumberOfMessagesSent()
+    roundTrips = session.GetNumberOfRoundTrips()
+    servermanager.LoadState(filename, transactional=transactional)
+    messages = session.GetNumberOfMessagesSent() - messages
+    roundTrips = session.GetNumberOfRoundTrips() - roundTrips
+
+    shrinks = [p for p in smp.GetSources().values() if p.GetXMLName() == "ShrinkFilter"]
+    for shrink in shrinks:
+        shrink.UpdatePipeline()
+        assert shrink.GetDataInformation().GetNumberOfCells() > 0
+    return len(shrinks), messages, roundTrips
+
+
+def runTest():
+
+    options = servermanager.vtkRemotingCoreConfiguration.GetInstance()
+    url = options.GetServerURL()
+
+    smp.Connect(getHost(url), getPort(url))
+
+    small, large = 5, 50
+    directory = tempfile.mkdtemp()
+    smallState = os.path.join(directory, "small.pvsm")
+    largeState = os.path.join(directory, "large.pvsm")
+    saveState(small, smallState)
+    saveState(large, largeState)
+
+    count, messages, roundTrips = loadState(largeState, transactional=False)
+    assert count == large
+    print("non-transactional load of %d pipelines: %d messages, %d round trips" %
+          (large, messages, roundTrips))
+    # each source needs at least one reply from the server.
+    assert roundTrips >= 2 * large
+
+    count, smallMessages, smallRoundTrips = loadState(smallState, transactional=True)
+    assert count == small
+    count, largeMessages, largeRoundTrips = loadState(largeState, transactional=True)
+    assert count == large
+    print("transactional load of %d pipelines: %d messages, %d round trips" %
+          (small, smallMessages, smallRoundTrips))
+    print("transactional load of %d pipelines: %d messages, %d round trips" %
+          (large, largeMessages, largeRoundTrips))
+
+    # the extra sources must not cost a message or a round trip each.
+    extraSources = 2 * (large - small)
+    assert largeMessages - smallMessages < extraSources
+    assert largeRoundTrips - smallRoundTrips < extraSources
+
+    for filename in (smallState, largeState):
+        os.remove(filename)
+    os.rmdir(directory)
+
+    smp.Disconnect()
+
+
+runTest()
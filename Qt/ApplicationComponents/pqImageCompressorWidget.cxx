@@ -13,7 +13,8 @@ static const int NO_COMPRESSION = 0;
 static const int LZ4_COMPRESSION = 1;
 static const int SQUIRT_COMPRESSION = 2;
 static const int ZLIB_COMPRESSION = 3;
-static const int NVPIPE_COMPRESSION = 4;
+static const int TILED_LZ4_COMPRESSION = 4;
+static const int NVPIPE_COMPRESSION = 5;
 //-----------------------------------------------------------------------------
 
 class pqImageCompressorWidget::pqInternals
@@ -49,6 +50,7 @@ pqImageCompressorWidget::pqImageCompressorWidget(
   this->connect(ui.zlibColorSpace, SIGNAL(valueChanged(int)), SIGNAL(compressorConfigChanged()));
   this->connect(ui.zlibLevel, SIGNAL(valueChanged(int)), SIGNAL(compressorConfigChanged()));
   this->connect(ui.zlibStripAlpha, SIGNAL(stateChanged(int)), SIGNAL(compressorConfigChanged()));
+  this->connect(ui.tiledDeltaMode, SIGNAL(stateChanged(int)), SIGNAL(compressorConfigChanged()));
 
 #if VTK_MODULE_ENABLE_ParaView_nvpipe
   ui.compressionType->addItem("NvPipe");
@@ -93,6 +95,14 @@ void pqImageCompressorWidget::setCompressorConfig(const QString& value)
                     "\\s+"     // space
                     "([0-9]+)" // num-of-bits.
                     "$");
+  QRegExp tiledLZ4RegExp("^vtkTiledLZ4Compressor"
+                         "\\s+"     // space
+                         "0"        // 0
+                         "\\s+"     // space
+                         "([0-9]+)" // num-of-bits.
+                         "\\s+"     // space
+                         "([01])"   // delta mode (0 or 1).
+                         "$");
   QRegExp nvpipeRegExp("^vtkNvPipeCompressor"
                        "\\s+"     // space
                        "0"        // 0
@@ -122,6 +132,14 @@ void pqImageCompressorWidget::setCompressorConfig(const QString& value)
     ui.zlibColorSpace->setValue(numBits);
     ui.zlibStripAlpha->setCheckState(stripAlpha ? Qt::Checked : Qt::Unchecked);
   }
+  else if (tiledLZ4RegExp.exactMatch(value))
+  {
+    int numBits = tiledLZ4RegExp.cap(1).toInt();
+    bool deltaMode = (tiledLZ4RegExp.cap(2).toInt() == 1);
+    ui.compressionType->setCurrentIndex(TILED_LZ4_COMPRESSION);
+    ui.squirtColorSpace->setValue(numBits);
+    ui.tiledDeltaMode->setCheckState(deltaMode ? Qt::Checked : Qt::Unchecked);
+  }
   else if (nvpipeRegExp.exactMatch(value))
   {
     int level = nvpipeRegExp.cap(1).toInt();
@@ -152,6 +170,11 @@ QString pqImageCompressorWidget::compressorConfig() const
         .arg(ui.zlibColorSpace->value())
         .arg(ui.zlibStripAlpha->isChecked() ? 1 : 0);
 
+    case TILED_LZ4_COMPRESSION:
+      return QString("vtkTiledLZ4Compressor 0 %1 %2")
+        .arg(ui.squirtColorSpace->value())
+        .arg(ui.tiledDeltaMode->isChecked() ? 1 : 0);
+
     case NVPIPE_COMPRESSION: // nvpipe
       return QString("vtkNvPipeCompressor 0 %1").arg(ui.nvpLevel->value());
   }
@@ -163,8 +186,11 @@ QString pqImageCompressorWidget::compressorConfig() const
 void pqImageCompressorWidget::currentIndexChanged(int index)
 {
   Ui::ImageCompressorWidget& ui = this->Internals->Ui;
-  ui.squirtLabel->setVisible(index == SQUIRT_COMPRESSION || index == LZ4_COMPRESSION);
-  ui.squirtColorSpace->setVisible(index == SQUIRT_COMPRESSION || index == LZ4_COMPRESSION);
+  ui.squirtLabel->setVisible(index == SQUIRT_COMPRESSION || index == LZ4_COMPRESSION ||
+    index == TILED_LZ4_COMPRESSION);
+  ui.squirtColorSpace->setVisible(index == SQUIRT_COMPRESSION || index == LZ4_COMPRESSION ||
+    index == TILED_LZ4_COMPRESSION);
+  ui.tiledDeltaMode->setVisible(index == TILED_LZ4_COMPRESSION);
 
   ui.zlibLabel1->setVisible(index == ZLIB_COMPRESSION);
   ui.zlibLabel2->setVisible(index == ZLIB_COMPRESSION);
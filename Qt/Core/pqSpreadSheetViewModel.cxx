@@ -66,6 +66,7 @@ public:
 
   QItemSelectionModel SelectionModel;
   pqTimer Timer;
+  pqTimer PrefetchTimer;
   pqTimer SelectionTimer;
   int DecimalPrecision;
   bool FixedRepresentation;
@@ -99,6 +100,12 @@ pqSpreadSheetViewModel::pqSpreadSheetViewModel(vtkSMProxy* view, QObject* parent
   this->Internal->Timer.setInterval(500); // milliseconds.
   QObject::connect(&this->Internal->Timer, SIGNAL(timeout()), this, SLOT(delayedUpdate()));
 
+  // zero-delay, so that the fetched rows are shown before prefetching.
+  this->Internal->PrefetchTimer.setSingleShot(true);
+  this->Internal->PrefetchTimer.setInterval(0);
+  QObject::connect(
+    &this->Internal->PrefetchTimer, SIGNAL(timeout()), this, SLOT(delayedPrefetch()));
+
   this->Internal->SelectionTimer.setSingleShot(true);
   this->Internal->SelectionTimer.setInterval(100); // milliseconds.
   QObject::connect(
@@ -178,6 +185,7 @@ void pqSpreadSheetViewModel::forceUpdate()
   this->Internal->ActiveRegion[1] = -1;
   this->Internal->SelectionModel.clear();
   this->Internal->Timer.stop();
+  this->Internal->PrefetchTimer.stop();
   this->Internal->SelectionTimer.stop();
 
   vtkIdType& rows = this->Internal->LastRowCount;
@@ -211,7 +219,19 @@ void pqSpreadSheetViewModel::delayedUpdate()
 {
   if (this->Internal->ActiveRegion[0] >= 0)
   {
-    this->Internal->VTKView->GetValue(this->Internal->ActiveRegion[0], 0);
+    this->Internal->VTKView->FetchRows(
+      this->Internal->ActiveRegion[0], this->Internal->ActiveRegion[1]);
+    this->Internal->PrefetchTimer.start();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void pqSpreadSheetViewModel::delayedPrefetch()
+{
+  if (this->Internal->ActiveRegion[0] >= 0)
+  {
+    this->Internal->VTKView->PrefetchRows(
+      this->Internal->ActiveRegion[0], this->Internal->ActiveRegion[1]);
   }
 }
 
@@ -226,6 +246,13 @@ void pqSpreadSheetViewModel::setActiveRegion(int row_top, int row_bottom)
 {
   this->Internal->ActiveRegion[0] = row_top;
   this->Internal->ActiveRegion[1] = row_bottom;
+
+  // prefetch the blocks next to the region in the scroll direction, even when
+  // all the visible rows are available.
+  if (row_top >= 0 && this->Internal->VTKView->IsFetchNeeded(row_top, row_bottom))
+  {
+    this->Internal->Timer.start();
+  }
 }
 
 //-----------------------------------------------------------------------------
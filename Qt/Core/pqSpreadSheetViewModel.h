@@ -105,7 +105,8 @@ public:
    * set the region (in row indices) that is currently being shown in the view.
    * the model will provide data-values only for the active-region. For any
    * other region it will simply return a "..." text for display (in
-   * QAbstractTableModel::data(..) callback).
+   * QAbstractTableModel::data(..) callback). The blocks next to the active
+   * region in the scroll direction are prefetched.
    */
   void setActiveRegion(int row_top, int row_bottom);
 
@@ -165,6 +166,12 @@ private Q_SLOTS:
    */
   void delayedUpdate();
 
+  /**
+   * called, once the rows fetched by delayedUpdate() are shown, to prefetch
+   * the blocks next to the active region.
+   */
+  void delayedPrefetch();
+
   void triggerSelectionChanged();
 
   /**
@@ -0,0 +1,60 @@
+# Tests writing asynchronously with the parallel serial writer while the
+# properties of the internal writer change between writes.
+
+from paraview.simple import *
+from paraview import smtesting
+from os.path import join
+import os
+
+smtesting.ProcessCommandLineArguments()
+
+pm = servermanager.vtkProcessModule.GetProcessModule()
+
+def Barrier():
+    # ensure all ranks wait till root has written the files.
+    if pm.GetSymmetricMPIMode():
+        pm.GetGlobalController().Barrier()
+
+# separate files to avoid failures in parallel test runs
+suffix = "-sym" if pm.GetSymmetricMPIMode() else ""
+binary = join(smtesting.TempDir, "asynchronous-binary%s.stl" % suffix)
+ascii = join(smtesting.TempDir, "asynchronous-ascii%s.stl" % suffix)
+
+s = Sphere()
+s.PhiResolution = 40
+s.ThetaResolution = 40
+numCells = s.GetDataInformation().GetNumberOfCells()
+
+writer = servermanager.writers.PSTLWriter(Input=s, FileName=binary)
+writer.WriteAsynchronously = 1
+writer.FileType = "Binary"
+writer.UpdatePipeline()
+
+# the internal writer may still be writing the first file. These pushes must
+# wait for it instead of changing the writer under its feet.
+writer.FileType = "Ascii"
+writer.FileName = ascii
+writer.UpdatePipeline()
+
+# deleting the writer waits for the last write.
+Delete(writer)
+del writer
+Barrier()
+
+for fname, expectedAscii in ((binary, False), (ascii, True)):
+    if pm.GetPartitionId() == 0:
+        with open(fname, "rb") as f:
+            isAscii = f.read(5) == b"solid"
+        if isAscii != expectedAscii:
+            raise smtesting.TestError("'%s' was written with the wrong file type." % fname)
+
+    reader = STLReader(FileNames=[fname])
+    reader.UpdatePipeline()
+    if reader.GetDataInformation().GetNumberOfCells() != numCells:
+        raise smtesting.TestError("'%s' does not have %d cells." % (fname, numCells))
+    Delete(reader)
+
+Barrier()
+if pm.GetPartitionId() == 0:
+    os.remove(binary)
+    os.remove(ascii)
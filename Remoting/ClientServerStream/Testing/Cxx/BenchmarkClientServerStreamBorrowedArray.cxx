@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkClientServerStream.h"
+#include "vtkNew.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+
+#include <functional>
+#include <vector>
+
+namespace
+{
+void Fill(vtkClientServerStream& css, const std::vector<double>& values, bool borrow)
+{
+  css.Reset();
+  css << vtkClientServerStream::Invoke << "SetValues";
+  if (borrow)
+  {
+    css << vtkClientServerStream::InsertBorrowedArray(
+      values.data(), static_cast<int>(values.size()));
+  }
+  else
+  {
+    css << vtkClientServerStream::InsertArray(values.data(), static_cast<int>(values.size()));
+  }
+  css << 42 << vtkClientServerStream::End;
+}
+
+double Time(const std::function<void()>& f, int count)
+{
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  for (int cc = 0; cc < count; ++cc)
+  {
+    f();
+  }
+  timer->StopTimer();
+  return timer->GetElapsedTime() / count;
+}
+}
+
+// Times inserting and extracting an array argument, copied and borrowed.
+int BenchmarkClientServerStreamBorrowedArray(int argc, char* argv[])
+{
+  int numValues = 100000000;
+  int count = 10;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument("--values", argT::EQUAL_ARGUMENT, &numValues, "Number of values in the array.");
+  arg.AddArgument("--count", argT::EQUAL_ARGUMENT, &count, "Number of repetitions.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<double> values(numValues);
+  for (int cc = 0; cc < numValues; ++cc)
+  {
+    values[cc] = cc * 0.5;
+  }
+
+  vtkClientServerStream css;
+  std::vector<double> result(values.size());
+  const double* ptr = nullptr;
+  vtkTypeUInt32 length = 0;
+  const double insertTime = Time([&]() { Fill(css, values, false); }, count);
+  const double extractTime =
+    Time([&]() { css.GetArgument(0, 1, result.data(), static_cast<vtkTypeUInt32>(numValues)); },
+      count);
+  const double insertBorrowedTime = Time([&]() { Fill(css, values, true); }, count);
+  const double extractBorrowedTime = Time([&]() { css.GetArgument(0, 1, &ptr, &length); }, count);
+
+  cout << "Values: " << numValues << endl;
+  cout << "InsertArray: " << insertTime << "s, GetArgument (copy): " << extractTime << "s" << endl;
+  cout << "InsertBorrowedArray: " << insertBorrowedTime
+       << "s, GetArgument (no copy): " << extractBorrowedTime << "s" << endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkClientServerStream.h"
+#include "vtkNew.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+void Fill(vtkClientServerStream& css, const std::vector<double>& values, bool borrow)
+{
+  css.Reset();
+  css << vtkClientServerStream::Invoke << "SetValues";
+  if (borrow)
+  {
+    css << vtkClientServerStream::InsertBorrowedArray(
+      values.data(), static_cast<int>(values.size()));
+  }
+  else
+  {
+    css << vtkClientServerStream::InsertArray(values.data(), static_cast<int>(values.size()));
+  }
+  css << 42 << vtkClientServerStream::End;
+}
+
+bool CheckCopy(const vtkClientServerStream& css, const std::vector<double>& values)
+{
+  vtkTypeUInt32 length = 0;
+  int last = 0;
+  std::vector<double> result(values.size());
+  if (!css.GetArgumentLength(0, 1, &length) || length != values.size() ||
+    !css.GetArgument(0, 1, result.data(), length) || result != values ||
+    !css.GetArgument(0, 2, &last) || last != 42)
+  {
+    cerr << "ERROR: failed to copy array argument." << endl;
+    return false;
+  }
+
+  // Conversion to another type must still work.
+  std::vector<float> converted(values.size());
+  if (!css.GetArgument(0, 1, converted.data(), length) ||
+    !std::equal(values.begin(), values.end(), converted.begin(),
+      [](double a, float b) { return static_cast<float>(a) == b; }))
+  {
+    cerr << "ERROR: failed to convert array argument." << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestClientServerStreamBorrowedArray(int, char*[])
+{
+  const int numValues = 1000;
+  std::vector<double> values(numValues);
+  for (int cc = 0; cc < numValues; ++cc)
+  {
+    values[cc] = cc * 0.5;
+  }
+
+  vtkClientServerStream copied;
+  vtkClientServerStream borrowed;
+  Fill(copied, values, false);
+  Fill(borrowed, values, true);
+  if (!CheckCopy(copied, values) || !CheckCopy(borrowed, values))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Non-copying access returns the borrowed memory itself.
+  const double* ptr = nullptr;
+  vtkTypeUInt32 length = 0;
+  if (!borrowed.GetArgument(0, 1, &ptr, &length) || ptr != values.data() ||
+    length != values.size())
+  {
+    cerr << "ERROR: non-copying access to a borrowed array failed." << endl;
+    return EXIT_FAILURE;
+  }
+  const float* fptr = nullptr;
+  if (borrowed.GetArgument(0, 1, &fptr, &length))
+  {
+    cerr << "ERROR: non-copying access must not convert types." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Appending an argument keeps it borrowed.
+  vtkClientServerStream expanded;
+  expanded << vtkClientServerStream::Invoke;
+  expanded.AppendArgument(borrowed, 0, 1);
+  expanded << vtkClientServerStream::End;
+  if (!expanded.GetArgument(0, 0, &ptr, &length) || ptr != values.data())
+  {
+    cerr << "ERROR: appended argument is not borrowed." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Printing and serializing include the borrowed values.
+  if (std::string(copied.StreamToString()) != borrowed.StreamToString())
+  {
+    cerr << "ERROR: string representations differ." << endl;
+    return EXIT_FAILURE;
+  }
+  const unsigned char* copiedData;
+  const unsigned char* borrowedData;
+  size_t copiedLength, borrowedLength;
+  if (!copied.GetData(&copiedData, &copiedLength) ||
+    !borrowed.GetData(&borrowedData, &borrowedLength) || copiedLength != borrowedLength ||
+    memcmp(copiedData, borrowedData, copiedLength) != 0 || !CheckCopy(borrowed, values))
+  {
+    cerr << "ERROR: serialized streams differ." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Streams set from serialized data also support non-copying access,
+  // provided the values are aligned.
+  vtkClientServerStream received;
+  received.SetData(copiedData, copiedLength);
+  if (!CheckCopy(received, values))
+  {
+    return EXIT_FAILURE;
+  }
+  if (received.GetArgument(0, 1, &ptr, &length) &&
+    (length != values.size() || !std::equal(values.begin(), values.end(), ptr)))
+  {
+    cerr << "ERROR: non-copying access returned wrong values." << endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
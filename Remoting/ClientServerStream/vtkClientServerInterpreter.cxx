@@ -594,7 +594,7 @@ int vtkClientServerInterpreter::ExpandMessage(
   int a;
   for (a = 0; a < startArgument && a < in.GetNumberOfArguments(inIndex); ++a)
   {
-    out << in.GetArgument(inIndex, a);
+    out.AppendArgument(in, inIndex, a);
   }
 
   // Expand id_value for remaining arguments.
@@ -647,8 +647,9 @@ int vtkClientServerInterpreter::ExpandMessage(
     }
     else
     {
-      // Just copy the argument.
-      out << in.GetArgument(inIndex, a);
+      // Just copy the argument.  Borrowed arrays remain borrowed since
+      // the expanded message does not outlive the input stream.
+      out.AppendArgument(in, inIndex, a);
     }
   }
 
@@ -13,6 +13,8 @@
 #include "vtkVariantExtract.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <map>
 #include <sstream>
 #include <string>
 #include <typeinfo>
@@ -226,6 +228,88 @@ public:
   // Buffer for return value from StreamToString.
   std::string String;
 
+  // Arrays inserted with InsertBorrowedArray.  Data only holds their
+  // type and length, their values are read from the caller's memory.
+  // The full representation is built in Record only when a caller needs
+  // it, and Flatten() copies the values into Data.
+  struct BorrowedArrayEntry
+  {
+    const unsigned char* Data;
+    size_t Size;
+    std::vector<unsigned char> Record;
+  };
+  typedef std::map<DataType::difference_type, BorrowedArrayEntry> BorrowedArraysType;
+  BorrowedArraysType BorrowedArrays;
+
+  // Copy all borrowed array values into Data.
+  void Flatten()
+  {
+    if (this->BorrowedArrays.empty())
+    {
+      return;
+    }
+
+    size_t size = this->Data.size();
+    for (const auto& item : this->BorrowedArrays)
+    {
+      size += item.second.Size;
+    }
+    DataType data;
+    data.reserve(size);
+    DataType::const_iterator pos = this->Data.begin();
+    for (const auto& item : this->BorrowedArrays)
+    {
+      // The type and length stay in place, the values follow them.
+      DataType::const_iterator valuesPos =
+        this->Data.begin() + item.first + 2 * sizeof(vtkTypeUInt32);
+      data.insert(data.end(), pos, valuesPos);
+      data.insert(data.end(), item.second.Data, item.second.Data + item.second.Size);
+      pos = valuesPos;
+    }
+    data.insert(data.end(), pos, DataType::const_iterator(this->Data.end()));
+
+    // Shift the values following each borrowed array.
+    DataType::difference_type shift = 0;
+    BorrowedArraysType::const_iterator iter = this->BorrowedArrays.begin();
+    for (auto& offset : this->ValueOffsets)
+    {
+      for (; iter != this->BorrowedArrays.end() && iter->first < offset; ++iter)
+      {
+        shift += static_cast<DataType::difference_type>(iter->second.Size);
+      }
+      offset += shift;
+    }
+
+    this->Data.swap(data);
+    this->BorrowedArrays.clear();
+  }
+
+  // Get a pointer to the given value within the given message without
+  // building the full representation of borrowed arrays.  For those,
+  // only the type and length are available from the returned pointer
+  // and the entry is returned in borrowed.
+  static const unsigned char* GetRawValue(const vtkClientServerStream& css, int message,
+    int value, const BorrowedArrayEntry** borrowed)
+  {
+    *borrowed = nullptr;
+    if (value >= 0 && value < css.GetNumberOfValues(message))
+    {
+      const vtkClientServerStreamInternals* self = css.Internal;
+      const DataType::difference_type offset =
+        self->ValueOffsets[self->MessageIndexes[message] + value];
+      if (!self->BorrowedArrays.empty())
+      {
+        auto iter = self->BorrowedArrays.find(offset);
+        if (iter != self->BorrowedArrays.end())
+        {
+          *borrowed = &iter->second;
+        }
+      }
+      return &*self->Data.begin() + offset;
+    }
+    return nullptr;
+  }
+
   // Access to protected members of vtkClientServerStream.
   static vtkClientServerStream& Write(vtkClientServerStream& css, const void* data, size_t length)
   {
@@ -259,13 +343,16 @@ vtkClientServerStream::~vtkClientServerStream()
 //----------------------------------------------------------------------------
 vtkClientServerStream::vtkClientServerStream(const vtkClientServerStream& r, vtkObjectBase* owner)
 {
-  // Allocate and copy the internal representation of the stream.
+  // Allocate and copy the internal representation of the stream.  The
+  // copy must not reference memory borrowed by the source.
+  r.Internal->Flatten();
   this->Internal = new vtkClientServerStreamInternals(*r.Internal, owner);
 }
 
 //----------------------------------------------------------------------------
 vtkClientServerStream& vtkClientServerStream::operator=(const vtkClientServerStream& that)
 {
+  that.Internal->Flatten();
   *this->Internal = *that.Internal;
   return *this;
 }
@@ -291,8 +378,8 @@ vtkClientServerStream& vtkClientServerStream::Write(const void* data, size_t len
   }
 
   // Copy the value into the data.
-  this->Internal->Data.resize(this->Internal->Data.size() + length);
-  memcpy(&*(this->Internal->Data.end() - length), data, length);
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  this->Internal->Data.insert(this->Internal->Data.end(), bytes, bytes + length);
   return *this;
 }
 
@@ -313,6 +400,7 @@ void vtkClientServerStream::Reset()
   this->Internal->MessageIndexes.erase(
     this->Internal->MessageIndexes.begin(), this->Internal->MessageIndexes.end());
   this->Internal->Objects.Clear();
+  this->Internal->BorrowedArrays.clear();
 
   // No message has yet been started.
   this->Internal->Invalid = 0;
@@ -410,6 +498,15 @@ vtkClientServerStream& vtkClientServerStream::operator<<(vtkClientServerStream::
 //----------------------------------------------------------------------------
 vtkClientServerStream& vtkClientServerStream::operator<<(vtkClientServerStream::Array a)
 {
+  // Make room for the type, length, data and optional null terminator
+  // at once rather than growing the stream for each of them.
+  vtkClientServerStreamInternals::DataType& data = this->Internal->Data;
+  const size_t required = data.size() + sizeof(vtkTypeUInt32) + sizeof(a.Length) + a.Size + 1;
+  if (required > data.capacity())
+  {
+    data.reserve(std::max(required, 2 * data.capacity()));
+  }
+
   // Store the array type, then length, then data.
   *this << a.Type;
   this->Write(&a.Length, sizeof(a.Length));
@@ -424,6 +521,51 @@ vtkClientServerStream& vtkClientServerStream::operator<<(vtkClientServerStream::
   return *this;
 }
 
+//----------------------------------------------------------------------------
+vtkClientServerStream& vtkClientServerStream::operator<<(vtkClientServerStream::BorrowedArray a)
+{
+  if (a.Size == 0 || !a.Data)
+  {
+    // Nothing to borrow.
+    vtkClientServerStream::Array array = { a.Type, a.Length, a.Size, a.Data };
+    return *this << array;
+  }
+
+  // Store the array type and length only.  The values are referenced.
+  *this << a.Type;
+  const vtkClientServerStreamInternals::DataType::difference_type offset =
+    this->Internal->ValueOffsets.back();
+  this->Write(&a.Length, sizeof(a.Length));
+
+  vtkClientServerStreamInternals::BorrowedArrayEntry& entry =
+    this->Internal->BorrowedArrays[offset];
+  entry.Data = static_cast<const unsigned char*>(a.Data);
+  entry.Size = a.Size;
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+vtkClientServerStream& vtkClientServerStream::AppendArgument(
+  const vtkClientServerStream& source, int message, int argument)
+{
+  const vtkClientServerStreamInternals::BorrowedArrayEntry* borrowed;
+  const unsigned char* data =
+    vtkClientServerStreamInternals::GetRawValue(source, message, 1 + argument, &borrowed);
+  if (data && borrowed && this != &source)
+  {
+    // Borrow the same memory.
+    vtkTypeUInt32 tp;
+    vtkClientServerStream::BorrowedArray a;
+    memcpy(&tp, data, sizeof(tp));
+    memcpy(&a.Length, data + sizeof(tp), sizeof(a.Length));
+    a.Type = static_cast<vtkClientServerStream::Types>(tp);
+    a.Size = static_cast<vtkTypeUInt32>(borrowed->Size);
+    a.Data = borrowed->Data;
+    return *this << a;
+  }
+  return *this << source.GetArgument(message, argument);
+}
+
 //----------------------------------------------------------------------------
 vtkClientServerStream& vtkClientServerStream::operator<<(const vtkClientServerStream& css)
 {
@@ -626,6 +768,40 @@ VTK_CLIENT_SERVER_INSERT_ARRAY(float)
 VTK_CLIENT_SERVER_INSERT_ARRAY(double)
 #undef VTK_CLIENT_SERVER_INSERT_ARRAY
 
+//----------------------------------------------------------------------------
+// Template and macro to implement all InsertBorrowedArray methods in the same way.
+template <class T>
+vtkClientServerStream::BorrowedArray vtkClientServerStreamInsertBorrowedArray(
+  const T* data, int length)
+{
+  // Construct and return the array information structure.
+  typedef VTK_CSS_TYPENAME vtkTypeTraits<T>::SizedType Type;
+  vtkClientServerStream::BorrowedArray a = { vtkClientServerTypeTraits<Type>::Array(),
+    static_cast<vtkTypeUInt32>(length), static_cast<vtkTypeUInt32>(sizeof(Type) * length), data };
+  return a;
+}
+
+#define VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(type)                                              \
+  vtkClientServerStream::BorrowedArray vtkClientServerStream::InsertBorrowedArray(                 \
+    const type* data, int length)                                                                  \
+  {                                                                                                \
+    return vtkClientServerStreamInsertBorrowedArray(data, length);                                 \
+  }
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(char)
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(short)
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(int)
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(long)
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(signed char)
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(unsigned char)
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(unsigned short)
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(unsigned int)
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(unsigned long)
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(long long)
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(unsigned long long)
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(float)
+VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY(double)
+#undef VTK_CLIENT_SERVER_INSERT_BORROWED_ARRAY
+
 //----------------------------------------------------------------------------
 // Template to implement each type conversion in the lookup tables below.
 // The "long, long, long" arguments are used to convince VS6 to select
@@ -1002,12 +1178,8 @@ VTK_CSS_GET_ARGUMENT(unsigned long long)
 
 template <typename SourceType, typename DestType>
 int vtkClientServerStreamGetArgumentArrayCase(
-  const unsigned char* src, DestType* dest, vtkTypeUInt32 length)
+  const unsigned char* src, vtkTypeUInt32 len, DestType* dest, vtkTypeUInt32 length)
 {
-  // Get the length of the value in the stream.
-  vtkTypeUInt32 len;
-  memcpy(&len, src, sizeof(len));
-  src += sizeof(len);
   if (len == length)
   {
     // Copy the value out of the stream.
@@ -1020,10 +1192,32 @@ int vtkClientServerStreamGetArgumentArrayCase(
   return 0;
 }
 
+//----------------------------------------------------------------------------
+// Whether the given type identifier is one of the numeric array types.
+static bool vtkClientServerStreamIsArrayType(vtkTypeUInt32 tp)
+{
+  switch (static_cast<vtkClientServerStream::Types>(tp))
+  {
+    case vtkClientServerStream::int8_array:
+    case vtkClientServerStream::int16_array:
+    case vtkClientServerStream::int32_array:
+    case vtkClientServerStream::int64_array:
+    case vtkClientServerStream::uint8_array:
+    case vtkClientServerStream::uint16_array:
+    case vtkClientServerStream::uint32_array:
+    case vtkClientServerStream::uint64_array:
+    case vtkClientServerStream::float32_array:
+    case vtkClientServerStream::float64_array:
+      return true;
+    default:
+      return false;
+  }
+}
+
 #define VTK_CSS_GET_ARGUMENT_ARRAY_CASE(TypeId, SourceType)                                        \
   case vtkClientServerStream::TypeId:                                                              \
   {                                                                                                \
-    return vtkClientServerStreamGetArgumentArrayCase<SourceType, T>(data, value, length);          \
+    return vtkClientServerStreamGetArgumentArrayCase<SourceType, T>(values, len, value, length);   \
   }
 
 //----------------------------------------------------------------------------
@@ -1033,27 +1227,33 @@ int vtkClientServerStreamGetArgumentArray(
   const vtkClientServerStream* self, int midx, int argument, T* value, vtkTypeUInt32 length)
 {
   typedef VTK_CSS_TYPENAME vtkTypeTraits<T>::SizedType Type;
+  const vtkClientServerStreamInternals::BorrowedArrayEntry* borrowed;
   if (const unsigned char* data =
-        vtkClientServerStreamInternals::GetValue(*self, midx, 1 + argument))
+        vtkClientServerStreamInternals::GetRawValue(*self, midx, 1 + argument, &borrowed))
   {
     // Get the type of the value in the stream.
     vtkTypeUInt32 tp;
     memcpy(&tp, data, sizeof(tp));
     data += sizeof(tp);
 
+    // Get the length of the value in the stream, if it is an array, and
+    // the location of its values, which may be borrowed.
+    vtkTypeUInt32 len = 0;
+    const unsigned char* values = nullptr;
+    if (borrowed || vtkClientServerStreamIsArrayType(tp))
+    {
+      memcpy(&len, data, sizeof(len));
+      values = borrowed ? borrowed->Data : data + sizeof(len);
+    }
+
     // If the type and length of the array match, use it.
     const auto array_type = vtkClientServerTypeTraits<Type>::Array();
     if (static_cast<vtkClientServerStream::Types>(tp) == array_type)
     {
-      // Get the length of the value in the stream.
-      vtkTypeUInt32 len;
-      memcpy(&len, data, sizeof(len));
-      data += sizeof(len);
-
       if (len == length)
       {
         // Copy the value out of the stream.
-        memcpy(value, data, len * sizeof(Type));
+        memcpy(value, values, len * sizeof(Type));
         return 1;
       }
     }
@@ -1113,6 +1313,63 @@ VTK_CSS_GET_ARGUMENT_ARRAY(long long)
 VTK_CSS_GET_ARGUMENT_ARRAY(unsigned long long)
 #undef VTK_CSS_GET_ARGUMENT_ARRAY
 
+//----------------------------------------------------------------------------
+// Template and macro to implement the non-copying array GetArgument
+// methods in the same way.
+template <class T>
+int vtkClientServerStreamGetArgumentArrayPointer(const vtkClientServerStream* self, int midx,
+  int argument, const T** value, vtkTypeUInt32* length)
+{
+  typedef VTK_CSS_TYPENAME vtkTypeTraits<T>::SizedType Type;
+  const vtkClientServerStreamInternals::BorrowedArrayEntry* borrowed;
+  if (const unsigned char* data =
+        vtkClientServerStreamInternals::GetRawValue(*self, midx, 1 + argument, &borrowed))
+  {
+    // Only arrays of the exact type can be returned without conversion.
+    vtkTypeUInt32 tp;
+    memcpy(&tp, data, sizeof(tp));
+    data += sizeof(tp);
+    if (static_cast<vtkClientServerStream::Types>(tp) != vtkClientServerTypeTraits<Type>::Array())
+    {
+      return 0;
+    }
+
+    vtkTypeUInt32 len;
+    memcpy(&len, data, sizeof(len));
+    const unsigned char* values = borrowed ? borrowed->Data : data + sizeof(len);
+    if (reinterpret_cast<std::uintptr_t>(values) % alignof(T) != 0)
+    {
+      // Values stored in the stream are not aligned for the type.
+      return 0;
+    }
+    *value = len > 0 ? reinterpret_cast<const T*>(values) : nullptr;
+    *length = len;
+    return 1;
+  }
+  return 0;
+}
+
+#define VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(type)                                                   \
+  int vtkClientServerStream::GetArgument(                                                          \
+    int message, int argument, const type** value, vtkTypeUInt32* length) const                    \
+  {                                                                                                \
+    return vtkClientServerStreamGetArgumentArrayPointer(this, message, argument, value, length);   \
+  }
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(signed char)
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(char)
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(int)
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(short)
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(long)
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(unsigned char)
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(unsigned int)
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(unsigned short)
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(unsigned long)
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(float)
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(double)
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(long long)
+VTK_CSS_GET_ARGUMENT_ARRAY_POINTER(unsigned long long)
+#undef VTK_CSS_GET_ARGUMENT_ARRAY_POINTER
+
 //----------------------------------------------------------------------------
 int vtkClientServerStream::GetArgument(int message, int argument, const char** value) const
 {
@@ -1394,8 +1651,11 @@ int vtkClientServerStream::GetArgument(int message, int& argument, vtkVariant* v
 //----------------------------------------------------------------------------
 int vtkClientServerStream::GetArgumentLength(int message, int argument, vtkTypeUInt32* length) const
 {
-  // Get a pointer to the type/value pair in the stream.
-  if (const unsigned char* data = this->GetValue(message, 1 + argument))
+  // Get a pointer to the type/value pair in the stream.  The length of
+  // borrowed arrays is stored in the stream as well.
+  const vtkClientServerStreamInternals::BorrowedArrayEntry* borrowed;
+  if (const unsigned char* data =
+        vtkClientServerStreamInternals::GetRawValue(*this, message, 1 + argument, &borrowed))
   {
     // Get the type of the value in the stream.
     vtkTypeUInt32 tp;
@@ -1452,6 +1712,9 @@ int vtkClientServerStream::GetData(const unsigned char** data, size_t* length) c
   // Do not return data unless stream is valid.
   if (!this->Internal->Invalid)
   {
+    // The data must include the values of borrowed arrays.
+    this->Internal->Flatten();
+
     if (data)
     {
       *data = &*this->Internal->Data.begin();
@@ -1833,20 +2096,24 @@ int vtkClientServerStream::GetNumberOfValues(int message) const
 //----------------------------------------------------------------------------
 const unsigned char* vtkClientServerStream::GetValue(int message, int value) const
 {
-  if (value >= 0 && value < this->GetNumberOfValues(message))
-  {
-    // Get the index to the beginning of the requested message.
-    vtkClientServerStreamInternals::ValueOffsetsType::size_type index =
-      this->Internal->MessageIndexes[message];
-
-    // Return a pointer to the value-th value in the message.
-    const unsigned char* data = &*this->Internal->Data.begin();
-    return data + this->Internal->ValueOffsets[index + value];
-  }
-  else
+  const vtkClientServerStreamInternals::BorrowedArrayEntry* borrowed;
+  const unsigned char* data =
+    vtkClientServerStreamInternals::GetRawValue(*this, message, value, &borrowed);
+  if (data && borrowed)
   {
-    return nullptr;
+    // Build the full representation of the borrowed array: type,
+    // length and values.
+    auto entry = const_cast<vtkClientServerStreamInternals::BorrowedArrayEntry*>(borrowed);
+    if (entry->Record.empty())
+    {
+      const size_t headerSize = 2 * sizeof(vtkTypeUInt32);
+      entry->Record.reserve(headerSize + entry->Size);
+      entry->Record.insert(entry->Record.end(), data, data + headerSize);
+      entry->Record.insert(entry->Record.end(), entry->Data, entry->Data + entry->Size);
+    }
+    return entry->Record.data();
   }
+  return data;
 }
 
 //----------------------------------------------------------------------------
@@ -1960,7 +2227,9 @@ int vtkClientServerStream::GetNumberOfArguments(int message) const
 vtkClientServerStream::Types vtkClientServerStream::GetArgumentType(int message, int argument) const
 {
   // Get a pointer to the type/value pair in the stream.
-  if (const unsigned char* data = this->GetValue(message, 1 + argument))
+  const vtkClientServerStreamInternals::BorrowedArrayEntry* borrowed;
+  if (const unsigned char* data =
+        vtkClientServerStreamInternals::GetRawValue(*this, message, 1 + argument, &borrowed))
   {
     // Get the type of the value in the stream and convert it.
     vtkTypeUInt32 type;
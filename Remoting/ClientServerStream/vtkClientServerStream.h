@@ -177,6 +177,36 @@ public:
   int GetArgument(int message, int argument, vtkObjectBase** value) const;
   ///@}
 
+  ///@{
+  /**
+   * Get a pointer to the values of the given array argument in the
+   * given message, and its length, without copying them. Unlike the
+   * copying overloads, the array must be stored with the exact sized
+   * type of the requested type. Returns 0 if that is not the case or if
+   * the values are not suitably aligned in the stream, in which case the
+   * copying overloads should be used instead. The pointer is invalidated
+   * when the stream is modified.
+   */
+  int GetArgument(int message, int argument, const signed char** value, vtkTypeUInt32* length) const;
+  int GetArgument(int message, int argument, const char** value, vtkTypeUInt32* length) const;
+  int GetArgument(int message, int argument, const short** value, vtkTypeUInt32* length) const;
+  int GetArgument(int message, int argument, const int** value, vtkTypeUInt32* length) const;
+  int GetArgument(int message, int argument, const long** value, vtkTypeUInt32* length) const;
+  int GetArgument(
+    int message, int argument, const unsigned char** value, vtkTypeUInt32* length) const;
+  int GetArgument(
+    int message, int argument, const unsigned short** value, vtkTypeUInt32* length) const;
+  int GetArgument(
+    int message, int argument, const unsigned int** value, vtkTypeUInt32* length) const;
+  int GetArgument(
+    int message, int argument, const unsigned long** value, vtkTypeUInt32* length) const;
+  int GetArgument(int message, int argument, const float** value, vtkTypeUInt32* length) const;
+  int GetArgument(int message, int argument, const double** value, vtkTypeUInt32* length) const;
+  int GetArgument(int message, int argument, const long long** value, vtkTypeUInt32* length) const;
+  int GetArgument(
+    int message, int argument, const unsigned long long** value, vtkTypeUInt32* length) const;
+  ///@}
+
   /**
    * Get the value of the given argument in the given message.
    * Returns whether the argument could be converted to the requested
@@ -228,6 +258,16 @@ public:
    */
   int GetData(const unsigned char** data, size_t* length) const;
 
+  /**
+   * Append the given argument of the given message of another stream to
+   * this stream. This is equivalent to `*this << source.GetArgument(message,
+   * argument)`, except that arrays borrowed by the source stream are
+   * borrowed by this stream as well instead of being copied (see
+   * InsertBorrowedArray).
+   */
+  vtkClientServerStream& AppendArgument(
+    const vtkClientServerStream& source, int message, int argument);
+
   //--------------------------------------------------------------------------
   // Stream writing methods:
 
@@ -245,6 +285,20 @@ public:
   };
   ///@}
 
+  ///@{
+  /**
+   * Proxy-object returned by InsertBorrowedArray and used to insert
+   * array data into the stream without copying it.
+   */
+  struct BorrowedArray
+  {
+    Types Type;
+    vtkTypeUInt32 Length;
+    vtkTypeUInt32 Size;
+    const void* Data;
+  };
+  ///@}
+
   ///@{
   /**
    * Stream operators for special types.
@@ -253,6 +307,7 @@ public:
   vtkClientServerStream& operator<<(vtkClientServerStream::Types);
   vtkClientServerStream& operator<<(vtkClientServerStream::Argument);
   vtkClientServerStream& operator<<(vtkClientServerStream::Array);
+  vtkClientServerStream& operator<<(vtkClientServerStream::BorrowedArray);
   vtkClientServerStream& operator<<(const vtkClientServerStream&);
   vtkClientServerStream& operator<<(vtkClientServerID);
   vtkClientServerStream& operator<<(vtkObjectBase*);
@@ -300,6 +355,33 @@ public:
   static vtkClientServerStream::Array InsertArray(const double*, int);
   ///@}
 
+  ///@{
+  /**
+   * Allow arrays to be passed into the stream without copying them.
+   * The stream only references the given memory, which must remain
+   * valid and unchanged until the stream is reset or destroyed. The
+   * values are copied into the stream only when needed: when the
+   * stream data is accessed with GetData, when the stream is copied or
+   * when the argument is accessed in a way that requires the stream
+   * representation (e.g. GetArgument returning an Argument). This is
+   * meant for large arrays in streams that are processed locally, e.g.
+   * by an interpreter.
+   */
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const char*, int);
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const short*, int);
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const int*, int);
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const long*, int);
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const signed char*, int);
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const unsigned char*, int);
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const unsigned short*, int);
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const unsigned int*, int);
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const unsigned long*, int);
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const long long*, int);
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const unsigned long long*, int);
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const float*, int);
+  static vtkClientServerStream::BorrowedArray InsertBorrowedArray(const double*, int);
+  ///@}
+
   /**
    * Construct the entire stream from the given data.  This destroys
    * any data already in the stream.  Returns whether the stream is
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIntArray.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+
+namespace
+{
+template <typename ArrayT>
+void FillArray(ArrayT* array, vtkIdType numTuples, int numComps)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  array->SetNumberOfComponents(numComps);
+  array->SetNumberOfTuples(numTuples);
+  for (vtkIdType tuple = 0; tuple < numTuples; ++tuple)
+  {
+    for (int comp = 0; comp < numComps; ++comp)
+    {
+      array->SetTypedComponent(tuple, comp,
+        static_cast<typename ArrayT::ValueType>(random->GetNextRangeValue(-1000, 1000)));
+    }
+  }
+}
+
+double TimeCopyFromArray(vtkDataArray* array, bool fused, bool modified)
+{
+  if (modified)
+  {
+    // vtkDataArray caches its ranges, make sure they are recomputed.
+    array->Modified();
+  }
+  vtkPVArrayInformation::SetUseFusedRangeComputation(fused);
+  vtkNew<vtkPVArrayInformation> info;
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  info->CopyFromArray(array, nullptr);
+  timer->StopTimer();
+  return timer->GetElapsedTime();
+}
+}
+
+// Times vtkPVArrayInformation::CopyFromArray computing the ranges one
+// component at a time and in a single fused pass, and once the ranges are
+// cached by the array.
+int BenchmarkPVArrayInformationFusedRange(int argc, char* argv[])
+{
+  int numTuples = 10000000;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument("--tuples", argT::EQUAL_ARGUMENT, &numTuples, "Number of tuples.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("scalars");
+  FillArray(scalars.Get(), numTuples, 1);
+
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("vectors");
+  FillArray(vectors.Get(), numTuples, 3);
+
+  vtkNew<vtkIntArray> tensors;
+  tensors->SetName("tensors");
+  FillArray(tensors.Get(), numTuples, 9);
+
+  const bool prevUseFused = vtkPVArrayInformation::GetUseFusedRangeComputation();
+  for (vtkDataArray* array : { static_cast<vtkDataArray*>(scalars.Get()),
+         static_cast<vtkDataArray*>(vectors.Get()), static_cast<vtkDataArray*>(tensors.Get()) })
+  {
+    const double legacyTime = TimeCopyFromArray(array, false, true);
+    const double fusedTime = TimeCopyFromArray(array, true, true);
+    const double cachedTime = TimeCopyFromArray(array, true, false);
+    cout << array->GetName() << " (" << array->GetNumberOfTuples() << " x "
+         << array->GetNumberOfComponents() << "): per-component " << legacyTime << "s, fused "
+         << fusedTime << "s, cached " << cachedTime << "s" << endl;
+  }
+  vtkPVArrayInformation::SetUseFusedRangeComputation(prevUseFused);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+
+#include <algorithm>
+
+namespace
+{
+vtkSmartPointer<vtkImageData> NewBlock(unsigned int index)
+{
+  auto img = vtkSmartPointer<vtkImageData>::New();
+  img->SetDimensions(2, 2, 2);
+  img->SetOrigin(index, 0, 0);
+
+  vtkNew<vtkDoubleArray> array;
+  array->SetName("data");
+  array->SetNumberOfTuples(img->GetNumberOfPoints());
+  array->FillComponent(0, static_cast<double>(index));
+  img->GetPointData()->SetScalars(array);
+  return img;
+}
+
+double TimeCopyFromObject(vtkPVDataInformation* info, vtkDataObject* data)
+{
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  info->CopyFromObject(data);
+  timer->StopTimer();
+  return timer->GetElapsedTime();
+}
+}
+
+// Times vtkPVDataInformation::CopyFromObject on a multiblock of small images
+// without the leaf information cache, with a cold cache and after a fraction
+// of the blocks changed.
+int BenchmarkPVDataInformationLeafCache(int argc, char* argv[])
+{
+  int numBlocks = 10000;
+  double changedFraction = 0.01;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument("--blocks", argT::EQUAL_ARGUMENT, &numBlocks, "Number of blocks.");
+  arg.AddArgument(
+    "--changed", argT::EQUAL_ARGUMENT, &changedFraction, "Fraction of blocks changed per update.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkMultiBlockDataSet> data;
+  data->SetNumberOfBlocks(numBlocks);
+  for (int cc = 0; cc < numBlocks; ++cc)
+  {
+    data->SetBlock(cc, NewBlock(cc));
+  }
+
+  const bool prevUseCache = vtkPVDataInformation::GetUseLeafInformationCache();
+
+  vtkPVDataInformation::SetUseLeafInformationCache(false);
+  vtkNew<vtkPVDataInformation> uncached;
+  const double uncachedTime = TimeCopyFromObject(uncached, data);
+
+  vtkPVDataInformation::SetUseLeafInformationCache(true);
+  vtkPVDataInformation::ClearLeafInformationCache();
+  vtkNew<vtkPVDataInformation> cached;
+  const double coldTime = TimeCopyFromObject(cached, data);
+
+  const int stride = std::max(1, static_cast<int>(1.0 / changedFraction));
+  for (int cc = 0; cc < numBlocks; cc += stride)
+  {
+    auto img = vtkImageData::SafeDownCast(data->GetBlock(cc));
+    auto array = img->GetPointData()->GetArray("data");
+    array->SetComponent(0, 0, -1.0 - cc);
+    array->Modified();
+  }
+  const double warmTime = TimeCopyFromObject(cached, data);
+  vtkPVDataInformation::SetUseLeafInformationCache(prevUseCache);
+
+  cout << "Blocks: " << numBlocks << " (changed: " << (numBlocks + stride - 1) / stride << ")"
+       << endl;
+  cout << "CopyFromObject without cache: " << uncachedTime << "s" << endl;
+  cout << "CopyFromObject with cold cache: " << coldTime << "s" << endl;
+  cout << "CopyFromObject with warm cache: " << warmTime << "s" << endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDataSetAttributes.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkFloatArray.h"
+#include "vtkIntArray.h"
+#include "vtkMathUtilities.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+template <typename ArrayT>
+void FillArray(ArrayT* array, vtkIdType numTuples, int numComps)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  array->SetNumberOfComponents(numComps);
+  array->SetNumberOfTuples(numTuples);
+  for (vtkIdType tuple = 0; tuple < numTuples; ++tuple)
+  {
+    for (int comp = 0; comp < numComps; ++comp)
+    {
+      array->SetTypedComponent(tuple, comp,
+        static_cast<typename ArrayT::ValueType>(random->GetNextRangeValue(-1000, 1000)));
+    }
+  }
+}
+
+void CopyFromArray(vtkPVArrayInformation* info, vtkDataArray* array, vtkFieldData* fd, bool fused)
+{
+  // vtkDataArray caches its ranges, make sure they are recomputed.
+  array->Modified();
+  vtkPVArrayInformation::SetUseFusedRangeComputation(fused);
+  info->CopyFromArray(array, fd);
+}
+
+bool SameValue(double expected, double actual)
+{
+  return expected == actual || vtkMathUtilities::FuzzyCompare(expected, actual, 1e-6);
+}
+
+bool Compare(vtkPVArrayInformation* expected, vtkPVArrayInformation* actual)
+{
+  for (int comp = -1; comp < expected->GetNumberOfComponents(); ++comp)
+  {
+    const double* erange = expected->GetComponentRange(comp);
+    const double* arange = actual->GetComponentRange(comp);
+    const double* efinite = expected->GetComponentFiniteRange(comp);
+    const double* afinite = actual->GetComponentFiniteRange(comp);
+    if (!SameValue(erange[0], arange[0]) || !SameValue(erange[1], arange[1]) ||
+      !SameValue(efinite[0], afinite[0]) || !SameValue(efinite[1], afinite[1]))
+    {
+      cerr << "ERROR: range mismatch for component " << comp << " of '"
+           << expected->GetName() << "': expected (" << erange[0] << ", " << erange[1]
+           << ") and (" << efinite[0] << ", " << efinite[1] << "), got (" << arange[0] << ", "
+           << arange[1] << ") and (" << afinite[0] << ", " << afinite[1] << ")" << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Test(vtkDataArray* array, vtkFieldData* fd)
+{
+  vtkNew<vtkPVArrayInformation> legacy;
+  CopyFromArray(legacy, array, fd, false);
+  vtkNew<vtkPVArrayInformation> fused;
+  CopyFromArray(fused, array, fd, true);
+  return Compare(legacy, fused);
+}
+
+// The fused computation must reuse the ranges cached by the array, and cache
+// the ranges it computes.
+bool TestRangeCache(vtkDoubleArray* array)
+{
+  vtkPVArrayInformation::SetUseFusedRangeComputation(true);
+  array->Modified();
+  vtkNew<vtkPVArrayInformation> info;
+  info->CopyFromArray(array, nullptr);
+  double range[2];
+  for (int comp = -1; comp < array->GetNumberOfComponents(); ++comp)
+  {
+    // vtkDataArray::GetRange uses the cached ranges, even if they are out of date.
+    array->SetTypedComponent(0, std::max(comp, 0), 1.0e9);
+    array->GetRange(range, comp);
+    const double* expected = info->GetComponentRange(comp);
+    if (range[0] != expected[0] || range[1] != expected[1])
+    {
+      cerr << "ERROR: the fused range of component " << comp << " was not cached." << endl;
+      return false;
+    }
+  }
+
+  // Unchanged arrays are not scanned again.
+  vtkNew<vtkPVArrayInformation> cached;
+  cached->CopyFromArray(array, nullptr);
+  if (!Compare(info, cached))
+  {
+    cerr << "ERROR: the cached ranges were not used." << endl;
+    return false;
+  }
+
+  // Modified arrays are.
+  array->Modified();
+  cached->CopyFromArray(array, nullptr);
+  if (cached->GetComponentRange(0)[1] != 1.0e9)
+  {
+    cerr << "ERROR: the ranges of a modified array were not recomputed." << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestPVArrayInformationFusedRange(int, char*[])
+{
+  const vtkIdType numTuples = 100000;
+  const bool prevUseFused = vtkPVArrayInformation::GetUseFusedRangeComputation();
+  bool success = true;
+
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("scalars");
+  FillArray(scalars.Get(), numTuples, 1);
+
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("vectors");
+  FillArray(vectors.Get(), numTuples, 3);
+
+  vtkNew<vtkIntArray> tensors;
+  tensors->SetName("tensors");
+  FillArray(tensors.Get(), numTuples, 9);
+
+  // Non-finite values must only affect the range they belong to.
+  vtkNew<vtkDoubleArray> nonfinite;
+  nonfinite->SetName("nonfinite");
+  FillArray(nonfinite.Get(), numTuples, 3);
+  nonfinite->SetTypedComponent(0, 0, std::numeric_limits<double>::quiet_NaN());
+  nonfinite->SetTypedComponent(numTuples / 2, 1, std::numeric_limits<double>::infinity());
+  nonfinite->SetTypedComponent(numTuples - 1, 2, -std::numeric_limits<double>::infinity());
+
+  vtkNew<vtkDoubleArray> empty;
+  empty->SetName("empty");
+  empty->SetNumberOfComponents(2);
+
+  vtkNew<vtkFieldData> fd;
+  fd->AddArray(scalars);
+  fd->AddArray(vectors);
+  fd->AddArray(tensors);
+  fd->AddArray(nonfinite);
+  fd->AddArray(empty);
+
+  for (vtkDataArray* array : { static_cast<vtkDataArray*>(scalars.Get()),
+         static_cast<vtkDataArray*>(vectors.Get()), static_cast<vtkDataArray*>(tensors.Get()),
+         static_cast<vtkDataArray*>(nonfinite.Get()), static_cast<vtkDataArray*>(empty.Get()) })
+  {
+    success &= Test(array, nullptr);
+  }
+
+  // Ghost values, including extreme ones, must be skipped.
+  vtkNew<vtkUnsignedCharArray> ghosts;
+  ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+  ghosts->SetNumberOfTuples(numTuples);
+  ghosts->FillValue(0);
+  for (vtkIdType cc = 0; cc < numTuples; cc += 7)
+  {
+    ghosts->SetValue(cc, vtkDataSetAttributes::DUPLICATEPOINT);
+    vectors->SetTypedComponent(cc, 0, 1.0e6);
+  }
+  fd->AddArray(ghosts);
+  success &= Test(vectors, fd);
+  success &= Test(nonfinite, fd);
+
+  success &= TestRangeCache(vectors);
+
+  vtkPVArrayInformation::SetUseFusedRangeComputation(prevUseFused);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+vtkSmartPointer<vtkImageData> NewBlock(unsigned int index)
+{
+  auto img = vtkSmartPointer<vtkImageData>::New();
+  img->SetDimensions(2, 2, 2);
+  img->SetOrigin(index, 0, 0);
+
+  vtkNew<vtkDoubleArray> array;
+  array->SetName("data");
+  array->SetNumberOfTuples(img->GetNumberOfPoints());
+  array->FillComponent(0, static_cast<double>(index));
+  img->GetPointData()->SetScalars(array);
+  return img;
+}
+
+bool Compare(vtkPVDataInformation* expected, vtkPVDataInformation* actual)
+{
+  auto earray = expected->GetArrayInformation("data", vtkDataObject::POINT);
+  auto aarray = actual->GetArrayInformation("data", vtkDataObject::POINT);
+  if (!earray || !aarray)
+  {
+    cerr << "ERROR: missing array information." << endl;
+    return false;
+  }
+  const double* erange = earray->GetComponentRange(0);
+  const double* arange = aarray->GetComponentRange(0);
+  if (erange[0] != arange[0] || erange[1] != arange[1])
+  {
+    cerr << "ERROR: range mismatch: expected (" << erange[0] << ", " << erange[1] << "), got ("
+         << arange[0] << ", " << arange[1] << ")" << endl;
+    return false;
+  }
+  double ebds[6], abds[6];
+  expected->GetBounds(ebds);
+  actual->GetBounds(abds);
+  for (int cc = 0; cc < 6; ++cc)
+  {
+    if (ebds[cc] != abds[cc])
+    {
+      cerr << "ERROR: bounds mismatch." << endl;
+      return false;
+    }
+  }
+  if (expected->GetNumberOfPoints() != actual->GetNumberOfPoints() ||
+    expected->GetNumberOfCells() != actual->GetNumberOfCells() ||
+    expected->GetNumberOfDataSets() != actual->GetNumberOfDataSets())
+  {
+    cerr << "ERROR: counts mismatch." << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestPVDataInformationLeafCache(int, char*[])
+{
+  const int numBlocks = 1000;
+  const int stride = 100;
+
+  vtkNew<vtkMultiBlockDataSet> data;
+  data->SetNumberOfBlocks(numBlocks);
+  for (int cc = 0; cc < numBlocks; ++cc)
+  {
+    data->SetBlock(cc, NewBlock(cc));
+  }
+
+  const bool prevUseCache = vtkPVDataInformation::GetUseLeafInformationCache();
+
+  // Baseline: no cache.
+  vtkPVDataInformation::SetUseLeafInformationCache(false);
+  vtkNew<vtkPVDataInformation> uncached;
+  uncached->CopyFromObject(data);
+
+  // Populate the cache.
+  vtkPVDataInformation::SetUseLeafInformationCache(true);
+  vtkNew<vtkPVDataInformation> cached;
+  cached->CopyFromObject(data);
+  if (!Compare(uncached, cached))
+  {
+    vtkPVDataInformation::SetUseLeafInformationCache(prevUseCache);
+    return EXIT_FAILURE;
+  }
+
+  // Change a few blocks, both by modifying arrays in place and by replacing
+  // blocks, and gather information again.
+  for (int cc = 0; cc < numBlocks; cc += stride)
+  {
+    if ((cc / stride) % 2 == 0)
+    {
+      auto img = vtkImageData::SafeDownCast(data->GetBlock(cc));
+      auto array = img->GetPointData()->GetArray("data");
+      array->SetComponent(0, 0, -1.0 - cc);
+      array->Modified();
+    }
+    else
+    {
+      auto img = NewBlock(cc);
+      img->SetOrigin(cc, numBlocks, 0);
+      data->SetBlock(cc, img);
+    }
+  }
+  cached->CopyFromObject(data);
+
+  vtkPVDataInformation::SetUseLeafInformationCache(false);
+  uncached->CopyFromObject(data);
+  vtkPVDataInformation::SetUseLeafInformationCache(true);
+  if (!Compare(uncached, cached))
+  {
+    vtkPVDataInformation::SetUseLeafInformationCache(prevUseCache);
+    return EXIT_FAILURE;
+  }
+
+  // Gather from several threads at once, starting from an empty cache so that
+  // lookups and insertions interleave. The arrays cached their ranges in the
+  // gather above, so the threads only read them.
+  vtkPVDataInformation::ClearLeafInformationCache();
+  std::vector<vtkSmartPointer<vtkPVDataInformation>> concurrent(4);
+  std::vector<std::thread> threads;
+  for (auto& info : concurrent)
+  {
+    info = vtkSmartPointer<vtkPVDataInformation>::New();
+    threads.emplace_back([&info, &data]() { info->CopyFromObject(data); });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  vtkPVDataInformation::SetUseLeafInformationCache(prevUseCache);
+  for (auto& info : concurrent)
+  {
+    if (!Compare(uncached, info))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
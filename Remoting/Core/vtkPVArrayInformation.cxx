@@ -3,23 +3,32 @@
 #include "vtkPVArrayInformation.h"
 
 #include "vtkAbstractArray.h"
+#include "vtkArrayDispatch.h"
 #include "vtkCellAttribute.h"
 #include "vtkCellGrid.h"
 #include "vtkClientServerStream.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkFieldData.h"
 #include "vtkGenericAttribute.h"
 #include "vtkInformation.h"
+#include "vtkInformationDoubleVectorKey.h"
+#include "vtkInformationInformationVectorKey.h"
 #include "vtkInformationIterator.h"
 #include "vtkInformationKey.h"
+#include "vtkInformationVector.h"
 #include "vtkNew.h"
 #include "vtkNumberToString.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVLogger.h"
 #include "vtkPVPostFilter.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStringArray.h"
+#include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <set>
 #include <sstream>
@@ -42,6 +51,214 @@ vtkTuple<double, 2> MergeRanges(const vtkTuple<double, 2>& r1, const vtkTuple<do
   return vtkTuple<double, 2>({ std::min(r1[0], r2[0]), std::max(r1[1], r2[1]) });
 }
 
+bool UseFusedRangeComputation = true;
+
+/**
+ * Computes range and finite range for all components and for the L2 norm in
+ * a single pass. Ranges are stored as 4 values per component, `[min, max,
+ * finite-min, finite-max]`, with the L2 norm first. Like vtkDataArray, NaNs
+ * are ignored for the range and non-finite values for the finite range.
+ */
+template <typename ArrayT>
+class FusedRangeFunctor
+{
+  ArrayT* Array;
+  const unsigned char* Ghosts;
+  unsigned char GhostsToSkip;
+  int NumberOfComponents;
+  vtkSMPThreadLocal<std::vector<double>> TLRanges;
+
+  static void Update(double* range, double value)
+  {
+    if (!std::isnan(value))
+    {
+      range[0] = std::min(range[0], value);
+      range[1] = std::max(range[1], value);
+      if (std::isfinite(value))
+      {
+        range[2] = std::min(range[2], value);
+        range[3] = std::max(range[3], value);
+      }
+    }
+  }
+
+  void InitializeRanges(std::vector<double>& ranges) const
+  {
+    ranges.resize(4 * (this->NumberOfComponents + 1));
+    for (size_t cc = 0; cc < ranges.size(); cc += 2)
+    {
+      ranges[cc] = VTK_DOUBLE_MAX;
+      ranges[cc + 1] = VTK_DOUBLE_MIN;
+    }
+  }
+
+public:
+  std::vector<double> Result;
+
+  FusedRangeFunctor(ArrayT* array, const unsigned char* ghosts, unsigned char ghostsToSkip)
+    : Array(array)
+    , Ghosts(ghosts)
+    , GhostsToSkip(ghostsToSkip)
+    , NumberOfComponents(array->GetNumberOfComponents())
+  {
+  }
+
+  void Initialize() { this->InitializeRanges(this->TLRanges.Local()); }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    double* ranges = this->TLRanges.Local().data();
+    const int numComps = this->NumberOfComponents;
+    const auto tuples = vtk::DataArrayTupleRange(this->Array, begin, end);
+    vtkIdType tupleIdx = begin;
+    for (const auto tuple : tuples)
+    {
+      if (this->Ghosts && (this->Ghosts[tupleIdx++] & this->GhostsToSkip))
+      {
+        continue;
+      }
+      double squaredNorm = 0.0;
+      for (int comp = 0; comp < numComps; ++comp)
+      {
+        const double value = static_cast<double>(tuple[comp]);
+        FusedRangeFunctor::Update(ranges + 4 * (comp + 1), value);
+        squaredNorm += value * value;
+      }
+      FusedRangeFunctor::Update(ranges, squaredNorm);
+    }
+  }
+
+  void Reduce()
+  {
+    this->InitializeRanges(this->Result);
+    for (const auto& ranges : this->TLRanges)
+    {
+      for (size_t cc = 0; cc < ranges.size(); cc += 2)
+      {
+        this->Result[cc] = std::min(this->Result[cc], ranges[cc]);
+        this->Result[cc + 1] = std::max(this->Result[cc + 1], ranges[cc + 1]);
+      }
+    }
+    if (this->NumberOfComponents == 1)
+    {
+      // vtkDataArray reports the component range as the L2 norm range for
+      // single component arrays.
+      std::copy(this->Result.begin() + 4, this->Result.end(), this->Result.begin());
+      return;
+    }
+    // the L2 norm range was computed on squared norms.
+    for (int cc = 0; cc < 4; cc += 2)
+    {
+      if (this->Result[cc] <= this->Result[cc + 1])
+      {
+        this->Result[cc] = std::sqrt(this->Result[cc]);
+        this->Result[cc + 1] = std::sqrt(this->Result[cc + 1]);
+      }
+    }
+  }
+};
+
+/**
+ * vtkDataArray caches the ranges it computes in its information, and removes
+ * them when the array is modified. These read and write that cache using the
+ * layout of FusedRangeFunctor::Result, so that unchanged arrays are not
+ * scanned again, and so that later calls to vtkDataArray::GetRange are cache
+ * hits. Like vtkDataArray, the L2 norm range of single component arrays is
+ * the range of the component.
+ */
+vtkInformationVector* GetRangeCache(vtkInformation* info, vtkInformationInformationVectorKey* key,
+  int numComps, bool create)
+{
+  vtkInformationVector* infoVec = info->Get(key);
+  if (create && (!infoVec || infoVec->GetNumberOfInformationObjects() < numComps))
+  {
+    vtkNew<vtkInformationVector> newInfoVec;
+    newInfoVec->SetNumberOfInformationObjects(numComps);
+    info->Set(key, newInfoVec);
+    infoVec = newInfoVec;
+  }
+  return infoVec && infoVec->GetNumberOfInformationObjects() >= numComps ? infoVec : nullptr;
+}
+
+bool GetCachedRanges(vtkDataArray* array, std::vector<double>& ranges)
+{
+  const int numComps = array->GetNumberOfComponents();
+  if (!array->HasInformation() || numComps < 1)
+  {
+    return false;
+  }
+  vtkInformation* info = array->GetInformation();
+  vtkInformationVector* compInfo =
+    GetRangeCache(info, vtkAbstractArray::PER_COMPONENT(), numComps, false);
+  vtkInformationVector* finiteInfo =
+    GetRangeCache(info, vtkAbstractArray::PER_FINITE_COMPONENT(), numComps, false);
+  if (!compInfo || !finiteInfo)
+  {
+    return false;
+  }
+
+  ranges.resize(4 * (numComps + 1));
+  for (int comp = -1; comp < numComps; ++comp)
+  {
+    double* compRanges = &ranges[4 * (comp + 1)];
+    vtkInformation* rangeInfo = info;
+    vtkInformation* finiteRangeInfo = info;
+    vtkInformationDoubleVectorKey* rangeKey = vtkDataArray::L2_NORM_RANGE();
+    vtkInformationDoubleVectorKey* finiteRangeKey = vtkDataArray::L2_NORM_FINITE_RANGE();
+    if (comp >= 0 || numComps == 1)
+    {
+      rangeInfo = compInfo->GetInformationObject(std::max(comp, 0));
+      finiteRangeInfo = finiteInfo->GetInformationObject(std::max(comp, 0));
+      rangeKey = finiteRangeKey = vtkDataArray::COMPONENT_RANGE();
+    }
+    if (!rangeInfo->Has(rangeKey) || !finiteRangeInfo->Has(finiteRangeKey))
+    {
+      return false;
+    }
+    rangeInfo->Get(rangeKey, compRanges);
+    finiteRangeInfo->Get(finiteRangeKey, compRanges + 2);
+  }
+  return true;
+}
+
+void SetCachedRanges(vtkDataArray* array, const std::vector<double>& ranges)
+{
+  const int numComps = array->GetNumberOfComponents();
+  if (numComps < 1)
+  {
+    return;
+  }
+  vtkInformation* info = array->GetInformation();
+  vtkInformationVector* compInfo =
+    GetRangeCache(info, vtkAbstractArray::PER_COMPONENT(), numComps, true);
+  vtkInformationVector* finiteInfo =
+    GetRangeCache(info, vtkAbstractArray::PER_FINITE_COMPONENT(), numComps, true);
+  for (int comp = 0; comp < numComps; ++comp)
+  {
+    const double* compRanges = &ranges[4 * (comp + 1)];
+    compInfo->GetInformationObject(comp)->Set(vtkDataArray::COMPONENT_RANGE(), compRanges, 2);
+    finiteInfo->GetInformationObject(comp)->Set(
+      vtkDataArray::COMPONENT_RANGE(), compRanges + 2, 2);
+  }
+  if (numComps > 1)
+  {
+    info->Set(vtkDataArray::L2_NORM_RANGE(), ranges.data(), 2);
+    info->Set(vtkDataArray::L2_NORM_FINITE_RANGE(), ranges.data() + 2, 2);
+  }
+}
+
+struct FusedRangeWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, const unsigned char* ghosts, unsigned char ghostsToSkip,
+    std::vector<double>& result)
+  {
+    FusedRangeFunctor<ArrayT> functor(array, ghosts, ghostsToSkip);
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+    result = std::move(functor.Result);
+  }
+};
+
 } // end of namespace
 
 vtkStandardNewMacro(vtkPVArrayInformation);
@@ -282,7 +499,47 @@ void vtkPVArrayInformation::CopyFromArray(vtkAbstractArray* array, vtkFieldData*
   }
 
   auto dataArray = vtkDataArray::SafeDownCast(array);
-  if (dataArray && dataArray->IsNumeric())
+  if (dataArray && dataArray->IsNumeric() && ::UseFusedRangeComputation)
+  {
+    // Skip ghosts the same way vtkFieldData::GetRange would.
+    const unsigned char* ghosts = nullptr;
+    unsigned char ghostsToSkip = 0;
+    if (fd && array->GetName() && fd->GetAbstractArray(array->GetName()) == array)
+    {
+      vtkUnsignedCharArray* ghostArray = fd->GetGhostArray();
+      if (ghostArray && ghostArray != array &&
+        ghostArray->GetNumberOfTuples() == array->GetNumberOfTuples())
+      {
+        ghosts = ghostArray->GetPointer(0);
+        ghostsToSkip = fd->GetGhostsToSkip();
+      }
+    }
+
+    // The ranges cached by the array do not skip ghosts.
+    std::vector<double> ranges;
+    if (ghosts || !::GetCachedRanges(dataArray, ranges))
+    {
+      FusedRangeWorker worker;
+      if (!vtkArrayDispatch::Dispatch::Execute(dataArray, worker, ghosts, ghostsToSkip, ranges))
+      {
+        worker(dataArray, ghosts, ghostsToSkip, ranges);
+      }
+      if (!ghosts)
+      {
+        ::SetCachedRanges(dataArray, ranges);
+      }
+    }
+    for (int comp = -1; comp < numComponents; ++comp)
+    {
+      auto& compInfo = this->Components.at(comp + 1);
+      const double* compRanges = &ranges[4 * (comp + 1)];
+      compInfo.Range[0] = compRanges[0];
+      compInfo.Range[1] = compRanges[1];
+      compInfo.FiniteRange[0] = compRanges[2];
+      compInfo.FiniteRange[1] = compRanges[3];
+    }
+  }
+  else if (dataArray && dataArray->IsNumeric())
   {
     for (int comp = -1; comp < numComponents; ++comp)
     {
@@ -324,6 +581,18 @@ void vtkPVArrayInformation::CopyFromArray(vtkAbstractArray* array, vtkFieldData*
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVArrayInformation::SetUseFusedRangeComputation(bool value)
+{
+  ::UseFusedRangeComputation = value;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVArrayInformation::GetUseFusedRangeComputation()
+{
+  return ::UseFusedRangeComputation;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVArrayInformation::CopyFromCellAttribute(vtkCellGrid* grid, vtkCellAttribute* attribute)
 {
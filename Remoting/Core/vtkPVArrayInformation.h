@@ -135,6 +135,20 @@ public:
   ///@}
 
   void CopyFromArray(vtkAbstractArray* array, vtkFieldData* fd = nullptr);
+
+  ///@{
+  /**
+   * When enabled, CopyFromArray() computes the range and the finite range of
+   * every component and of the magnitude using a single pass over the array,
+   * parallelized with vtkSMPTools, instead of separate passes for each
+   * component and each kind of range. Ghost values flagged in `fd` are skipped
+   * in both cases.
+   *
+   * Enabled by default.
+   */
+  static void SetUseFusedRangeComputation(bool);
+  static bool GetUseFusedRangeComputation();
+  ///@}
   void CopyFromCellAttribute(vtkCellGrid* grid, vtkCellAttribute* attribute);
   void CopyFromGenericAttribute(vtkGenericAttribute* array);
   void CopyToStream(vtkClientServerStream*) const;
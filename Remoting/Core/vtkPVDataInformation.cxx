@@ -52,15 +52,102 @@
 #include "vtkTable.h"
 #include "vtkUniformGrid.h"
 #include "vtkUniformGridAMR.h"
+#include "vtkWeakPointer.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <map>
+#include <mutex>
 #include <numeric>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+/**
+ * Cache for information collected from non-composite datasets. Entries are
+ * keyed on the dataset and are valid as long as the dataset is alive and
+ * its MTime, which includes the MTime of its arrays, is unchanged. Liveness is
+ * checked using a weak reference, so a dataset allocated at the address of a
+ * released one never matches the stale entry. Information may be gathered from
+ * several threads at once, hence all accesses are serialized.
+ */
+class vtkPVDataInformationLeafCache
+{
+public:
+  static vtkPVDataInformationLeafCache& GetInstance()
+  {
+    static vtkPVDataInformationLeafCache instance;
+    return instance;
+  }
+
+  std::atomic<bool> Enabled{ true };
+
+  vtkSmartPointer<vtkPVDataInformation> Find(vtkDataObject* dobj)
+  {
+    if (!this->Enabled || !vtkDataSet::SafeDownCast(dobj))
+    {
+      return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    auto iter = this->Entries.find(dobj);
+    if (iter != this->Entries.end() && iter->second.Object.GetPointer() == dobj &&
+      iter->second.MTime == dobj->GetMTime())
+    {
+      return iter->second.Information;
+    }
+    return nullptr;
+  }
+
+  void Insert(vtkDataObject* dobj, vtkPVDataInformation* info)
+  {
+    if (!this->Enabled || !vtkDataSet::SafeDownCast(dobj))
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    if (this->Entries.size() >= this->PurgeThreshold)
+    {
+      this->Purge();
+    }
+    auto& entry = this->Entries[dobj];
+    entry.Object = dobj;
+    entry.MTime = dobj->GetMTime();
+    entry.Information = info;
+  }
+
+  void Clear()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Entries.clear();
+    this->PurgeThreshold = MinimumPurgeThreshold;
+  }
+
+private:
+  // Removes entries for datasets that have been released.
+  void Purge()
+  {
+    for (auto iter = this->Entries.begin(); iter != this->Entries.end();)
+    {
+      iter = iter->second.Object.GetPointer() == nullptr ? this->Entries.erase(iter) : std::next(iter);
+    }
+    this->PurgeThreshold = std::max(static_cast<size_t>(MinimumPurgeThreshold), 2 * this->Entries.size());
+  }
+
+  struct Entry
+  {
+    vtkWeakPointer<vtkDataObject> Object;
+    vtkMTimeType MTime = 0;
+    vtkSmartPointer<vtkPVDataInformation> Information;
+  };
+
+  static constexpr size_t MinimumPurgeThreshold = 1024;
+  std::mutex Mutex;
+  std::unordered_map<vtkDataObject*, Entry> Entries;
+  size_t PurgeThreshold = MinimumPurgeThreshold;
+};
+
 class vtkPVDataInformationAccumulator
 {
   vtkNew<vtkPVDataInformation> Current;
@@ -75,13 +162,30 @@ public:
     }
     assert(vtkCompositeDataSet::SafeDownCast(dobj) == nullptr);
 
-    this->Current->Initialize();
-    this->Current->CopyFromDataObject(dobj);
-    if (this->Current->GetDataSetType() != -1)
+    auto& cache = vtkPVDataInformationLeafCache::GetInstance();
+    vtkSmartPointer<vtkPVDataInformation> current = cache.Find(dobj);
+    if (current == nullptr)
+    {
+      if (cache.Enabled)
+      {
+        auto leafInfo = vtkSmartPointer<vtkPVDataInformation>::New();
+        leafInfo->CopyFromDataObject(dobj);
+        cache.Insert(dobj, leafInfo);
+        current = leafInfo;
+      }
+      else
+      {
+        this->Current->Initialize();
+        this->Current->CopyFromDataObject(dobj);
+        current = this->Current.GetPointer();
+      }
+    }
+
+    if (current->GetDataSetType() != -1)
     {
-      assert(this->Current->GetCompositeDataSetType() == -1);
-      this->UniqueBlockTypes.insert(this->Current->GetDataSetType());
-      info->AddInformation(this->Current);
+      assert(current->GetCompositeDataSetType() == -1);
+      this->UniqueBlockTypes.insert(current->GetDataSetType());
+      info->AddInformation(current);
     }
     return info;
   }
@@ -483,6 +587,29 @@ void vtkPVDataInformation::CopyFromObject(vtkObject* object)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::SetUseLeafInformationCache(bool value)
+{
+  auto& cache = vtkPVDataInformationLeafCache::GetInstance();
+  cache.Enabled = value;
+  if (!value)
+  {
+    cache.Clear();
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVDataInformation::GetUseLeafInformationCache()
+{
+  return vtkPVDataInformationLeafCache::GetInstance().Enabled;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::ClearLeafInformationCache()
+{
+  vtkPVDataInformationLeafCache::GetInstance().Clear();
+}
+
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::CopyFromPipelineInformation(vtkInformation* pinfo)
 {
@@ -98,6 +98,7 @@ public:
    * vtkPVInformation API implementation.
    */
   void AddInformation(vtkPVInformation* info) override;
+  bool IsAddInformationAssociative() override { return true; }
   void CopyToStream(vtkClientServerStream*) override;
   void CopyFromStream(const vtkClientServerStream*) override;
   void CopyParametersToStream(vtkMultiProcessStream&) override;
@@ -462,6 +463,32 @@ public:
    */
   unsigned int ComputeCompositeIndexForAMR(unsigned int level, unsigned int index) const;
 
+  ///@{
+  /**
+   * When enabled, the information collected from each non-composite dataset
+   * (e.g. the leaves of a composite dataset) is cached, keyed on the dataset
+   * and its modification time which accounts for its arrays as well.
+   * Subsequent calls to CopyFromObject() reuse the cached array ranges, bounds
+   * and counts for datasets that have not been modified since, instead of
+   * recomputing them. This is useful when only a few blocks of a large
+   * composite dataset change between updates.
+   *
+   * Entries hold a weak reference to their dataset, so information cached for
+   * a released dataset is never returned for a new one, and the cache may be
+   * used from several threads at once.
+   *
+   * Enabled by default.
+   */
+  static void SetUseLeafInformationCache(bool);
+  static bool GetUseLeafInformationCache();
+  ///@}
+
+  /**
+   * Releases all information cached for non-composite datasets.
+   * @sa SetUseLeafInformationCache
+   */
+  static void ClearLeafInformationCache();
+
 protected:
   vtkPVDataInformation();
   ~vtkPVDataInformation() override;
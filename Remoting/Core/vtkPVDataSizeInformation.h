@@ -34,6 +34,11 @@ public:
    */
   void AddInformation(vtkPVInformation* info) override;
 
+  /**
+   * Memory sizes are simply added up, hence this returns true.
+   */
+  bool IsAddInformationAssociative() override { return true; }
+
   ///@{
   /**
    * Manage a serialized version of the information.
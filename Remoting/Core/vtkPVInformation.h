@@ -32,6 +32,16 @@ public:
    */
   virtual void AddInformation(vtkPVInformation*);
 
+  /**
+   * Returns true if AddInformation() is associative i.e. merging the
+   * information from ranks A, B and C gives the same result whether it is done
+   * as `(A + B) + C` or as `A + (B + C)`, as long as the order of the ranks is
+   * preserved. When true, the information gathered from MPI ranks may be merged
+   * in parallel using a reduction tree rather than being merged on the root.
+   * Default implementation returns false.
+   */
+  virtual bool IsAddInformationAssociative() { return false; }
+
   ///@{
   /**
    * Manage a serialized version of the information.
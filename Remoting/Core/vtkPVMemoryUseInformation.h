@@ -34,6 +34,11 @@ public:
    */
   void AddInformation(vtkPVInformation*) override;
 
+  /**
+   * Memory use records are appended in rank order, hence this returns true.
+   */
+  bool IsAddInformationAssociative() override { return true; }
+
   ///@{
   /**
    * Manage a serialized version of the information.
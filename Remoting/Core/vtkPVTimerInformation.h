@@ -51,6 +51,11 @@ public:
    */
   void AddInformation(vtkPVInformation* info) override;
 
+  /**
+   * Logs are appended in rank order, hence this returns true.
+   */
+  bool IsAddInformationAssociative() override { return true; }
+
   ///@{
   /**
    * Serialize objects to/from a stream object.
@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkPVXMLElement.h"
+#include "vtkPVXMLParser.h"
+#include "vtkProcessModule.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMProxy.h"
+#include "vtkSMProxyManager.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMStateLoader.h"
+#include "vtkSmartPointer.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+
+#include <sstream>
+#include <string>
+
+namespace
+{
+// Loads the state, parsed again so that each load starts from the same XML,
+// and returns the time spent in vtkSMStateLoader.
+double LoadState(
+  vtkSMSessionProxyManager* pxm, const std::string& state, bool useIndices, bool transactional)
+{
+  pxm->UnRegisterProxies();
+  vtkSmartPointer<vtkPVXMLElement> root = vtkPVXMLParser::ParseXML(state.c_str());
+  vtkPVXMLElement::SetUseLookupIndices(useIndices);
+  vtkNew<vtkSMStateLoader> loader;
+  loader->SetSessionProxyManager(pxm);
+  loader->SetTransactionalLoad(transactional);
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  pxm->LoadXMLState(root, loader);
+  timer->StopTimer();
+  vtkPVXMLElement::SetUseLookupIndices(true);
+  return timer->GetElapsedTime();
+}
+}
+
+// Times loading a state of sphere and shrink pairs with linear lookups, with
+// the lookup indices of vtkPVXMLElement, and with a transactional load.
+int BenchmarkLoadLargeState(int argc, char* argv[])
+{
+  // `--pipelines=10000` gives a state file of about 50 MB.
+  int numPipelines = 10000;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument(
+    "--pipelines", argT::EQUAL_ARGUMENT, &numPipelines, "Number of sphere and shrink pairs.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+  vtkSMSession* session = vtkSMSession::New();
+  vtkSMSessionProxyManager* pxm =
+    vtkSMProxyManager::GetProxyManager()->GetSessionProxyManager(session);
+
+  // Proxies referring to other proxies by id, as in any state file.
+  for (int cc = 0; cc < numPipelines; ++cc)
+  {
+    const std::string index = std::to_string(cc);
+    vtkSmartPointer<vtkSMProxy> sphere;
+    sphere.TakeReference(pxm->NewProxy("sources", "SphereSource"));
+    vtkSMPropertyHelper(sphere, "ThetaResolution").Set(3 + cc % 100);
+    sphere->UpdateVTKObjects();
+    pxm->RegisterProxy("sources", ("sphere" + index).c_str(), sphere);
+
+    vtkSmartPointer<vtkSMProxy> shrink;
+    shrink.TakeReference(pxm->NewProxy("filters", "ShrinkFilter"));
+    vtkSMPropertyHelper(shrink, "Input").Set(sphere);
+    shrink->UpdateVTKObjects();
+    pxm->RegisterProxy("sources", ("shrink" + index).c_str(), shrink);
+  }
+
+  vtkSmartPointer<vtkPVXMLElement> saved;
+  saved.TakeReference(pxm->SaveXMLState());
+  std::ostringstream stream;
+  saved->PrintXML(stream, vtkIndent());
+  const std::string state = stream.str();
+  saved = nullptr;
+
+  const double linearTime = LoadState(pxm, state, false, false);
+  const double indexedTime = LoadState(pxm, state, true, false);
+  // pushes are only batched in client-server sessions.
+  const double transactionalTime = LoadState(pxm, state, true, true);
+
+  cout << "State: " << state.size() / (1024.0 * 1024.0) << " MB, " << 2 * numPipelines
+       << " proxies" << endl;
+  cout << "LoadState with linear lookups: " << linearTime
+       << "s, with lookup indices: " << indexedTime << "s, speedup: " << linearTime / indexedTime
+       << endl;
+  cout << "Transactional LoadState: " << transactionalTime << "s" << endl;
+
+  pxm->UnRegisterProxies();
+  session->Delete();
+  vtkInitializationHelper::Finalize();
+  return EXIT_SUCCESS;
+}
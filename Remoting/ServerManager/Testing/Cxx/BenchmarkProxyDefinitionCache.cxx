@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkProcessModule.h"
+#include "vtkSIProxyDefinitionManager.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <string>
+
+namespace
+{
+// Creates definition managers as done at startup, and returns the time of one.
+double TimeLoad(int repeat)
+{
+  vtkSmartPointer<vtkSIProxyDefinitionManager> manager;
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  for (int cc = 0; cc < repeat; ++cc)
+  {
+    manager = vtkSmartPointer<vtkSIProxyDefinitionManager>::New();
+  }
+  timer->StopTimer();
+  return timer->GetElapsedTime() / repeat;
+}
+}
+
+// Times the creation of the proxy definition manager at startup, parsing the
+// XMLs, writing the definition cache, and reading it.
+int BenchmarkProxyDefinitionCache(int argc, char* argv[])
+{
+  int repeat = 10;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument("--repeat", argT::EQUAL_ARGUMENT, &repeat, "Number of startups to time.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse() || repeat < 1)
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return EXIT_FAILURE;
+  }
+
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    cerr << "Could not determine temporary directory.\n";
+    return EXIT_FAILURE;
+  }
+  const std::string cacheDir = std::string(tempDir) + "/BenchmarkProxyDefinitionCache";
+  delete[] tempDir;
+  vtksys::SystemTools::RemoveADirectory(cacheDir);
+
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+  const std::string previousCacheDir = vtkSIProxyDefinitionManager::GetDefinitionCacheDirectory();
+
+  vtkSIProxyDefinitionManager::SetDefinitionCacheDirectory(std::string());
+  const double parseTime = TimeLoad(repeat);
+  // The first startup writes the cache, the next ones read it.
+  vtkSIProxyDefinitionManager::SetDefinitionCacheDirectory(cacheDir);
+  const double writeTime = TimeLoad(1);
+  const double readTime = TimeLoad(repeat);
+  vtkSIProxyDefinitionManager::SetDefinitionCacheDirectory(previousCacheDir);
+
+  cout << "Startup parsing XMLs: " << parseTime << "s, writing the cache: " << writeTime
+       << "s, reading the cache: " << readTime << "s" << endl;
+
+  vtksys::SystemTools::RemoveADirectory(cacheDir);
+  vtkInitializationHelper::Finalize();
+  return EXIT_SUCCESS;
+}
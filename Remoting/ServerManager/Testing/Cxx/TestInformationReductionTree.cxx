@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkClientServerStream.h"
+#include "vtkCommunicator.h"
+#include "vtkInitializationHelper.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVInformation.h"
+#include "vtkPVSessionCore.h"
+#include "vtkProcessModule.h"
+#include "vtkTestingObjectFactory.h"
+
+#include <vector>
+
+namespace
+{
+// Records the ranks it was gathered from, in merge order. Merging is
+// order-sensitive, so any reordering of the ranks shows up in the result.
+class vtkRankListInformation : public vtkPVInformation
+{
+public:
+  static vtkRankListInformation* New();
+  vtkTypeMacro(vtkRankListInformation, vtkPVInformation);
+
+  void CopyFromObject(vtkObject*) override
+  {
+    this->Ranks.assign(
+      1, vtkMultiProcessController::GetGlobalController()->GetLocalProcessId());
+  }
+
+  void AddInformation(vtkPVInformation* other) override
+  {
+    auto info = vtkRankListInformation::SafeDownCast(other);
+    if (info->Ranks.size() > 1)
+    {
+      ++this->NumberOfPartialMerges;
+    }
+    this->Ranks.insert(this->Ranks.end(), info->Ranks.begin(), info->Ranks.end());
+  }
+
+  void CopyToStream(vtkClientServerStream* css) override
+  {
+    css->Reset();
+    *css << vtkClientServerStream::Reply << static_cast<int>(this->Ranks.size());
+    for (int rank : this->Ranks)
+    {
+      *css << rank;
+    }
+    *css << vtkClientServerStream::End;
+  }
+
+  void CopyFromStream(const vtkClientServerStream* css) override
+  {
+    int count = 0;
+    css->GetArgument(0, 0, &count);
+    this->Ranks.resize(count);
+    for (int cc = 0; cc < count; ++cc)
+    {
+      css->GetArgument(0, cc + 1, &this->Ranks[cc]);
+    }
+  }
+
+  std::vector<int> Ranks;
+  // Number of merged objects that already held more than one rank.
+  int NumberOfPartialMerges = 0;
+
+protected:
+  vtkRankListInformation() = default;
+  ~vtkRankListInformation() override = default;
+
+private:
+  vtkRankListInformation(const vtkRankListInformation&) = delete;
+  void operator=(const vtkRankListInformation&) = delete;
+};
+vtkStandardNewMacro(vtkRankListInformation);
+
+class vtkAssociativeRankListInformation : public vtkRankListInformation
+{
+public:
+  static vtkAssociativeRankListInformation* New();
+  vtkTypeMacro(vtkAssociativeRankListInformation, vtkRankListInformation);
+  bool IsAddInformationAssociative() override { return true; }
+
+protected:
+  vtkAssociativeRankListInformation() = default;
+  ~vtkAssociativeRankListInformation() override = default;
+
+private:
+  vtkAssociativeRankListInformation(const vtkAssociativeRankListInformation&) = delete;
+  void operator=(const vtkAssociativeRankListInformation&) = delete;
+};
+vtkStandardNewMacro(vtkAssociativeRankListInformation);
+
+// Exposes CollectInformation so that it can be run without a client.
+class vtkTestSessionCore : public vtkPVSessionCore
+{
+public:
+  static vtkTestSessionCore* New();
+  vtkTypeMacro(vtkTestSessionCore, vtkPVSessionCore);
+  using vtkPVSessionCore::CollectInformation;
+};
+vtkStandardNewMacro(vtkTestSessionCore);
+
+bool Collect(vtkTestSessionCore* core, vtkRankListInformation* info, int fanIn)
+{
+  vtkPVSessionCore::SetInformationReductionFanIn(fanIn);
+  info->CopyFromObject(nullptr);
+  info->NumberOfPartialMerges = 0;
+  core->CollectInformation(info);
+
+  auto controller = vtkMultiProcessController::GetGlobalController();
+  if (controller->GetLocalProcessId() != 0)
+  {
+    return true;
+  }
+
+  const int numProcs = controller->GetNumberOfProcesses();
+  bool success = static_cast<int>(info->Ranks.size()) == numProcs;
+  for (int cc = 0; success && cc < numProcs; ++cc)
+  {
+    success = info->Ranks[cc] == cc;
+  }
+  if (!success)
+  {
+    cerr << "ERROR: " << info->GetClassName() << " with fan-in " << fanIn
+         << " was not merged in rank order." << endl;
+  }
+  if (!info->IsAddInformationAssociative() && info->NumberOfPartialMerges != 0)
+  {
+    cerr << "ERROR: non-associative information was merged using the reduction tree." << endl;
+    success = false;
+  }
+  return success;
+}
+}
+
+int TestInformationReductionTree(int argc, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argc, argv, vtkProcessModule::PROCESS_BATCH);
+  auto controller = vtkMultiProcessController::GetGlobalController();
+  if (controller == nullptr || controller->GetNumberOfProcesses() < 2)
+  {
+    cout << "This test requires at least 2 MPI ranks." << endl;
+    vtkInitializationHelper::Finalize();
+    return VTK_SKIP_RETURN_CODE;
+  }
+
+  const int prevFanIn = vtkPVSessionCore::GetInformationReductionFanIn();
+  int success = 1;
+  {
+    vtkNew<vtkTestSessionCore> core;
+    vtkNew<vtkAssociativeRankListInformation> associative;
+    vtkNew<vtkRankListInformation> nonAssociative;
+    // fan-in 1 is the gather-to-root path. The test runs on 3 ranks, which is
+    // not a power of 2; fan-in 4 is larger than the number of ranks.
+    for (int fanIn : { 1, 2, 3, 4 })
+    {
+      success &= Collect(core, associative, fanIn) ? 1 : 0;
+      success &= Collect(core, nonAssociative, fanIn) ? 1 : 0;
+    }
+  }
+  vtkPVSessionCore::SetInformationReductionFanIn(prevFanIn);
+
+  int allSuccess = 0;
+  controller->AllReduce(&success, &allSuccess, 1, vtkCommunicator::LOGICAL_AND_OP);
+  vtkInitializationHelper::Finalize();
+  return allSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkPVXMLElement.h"
+#include "vtkPVXMLParser.h"
+#include "vtkProcessModule.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMProxy.h"
+#include "vtkSMProxyManager.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMStateLoader.h"
+#include "vtkSmartPointer.h"
+
+#include <sstream>
+#include <string>
+
+namespace
+{
+// Loads the state, parsed again so that each load starts from the same XML.
+void LoadState(
+  vtkSMSessionProxyManager* pxm, const std::string& state, bool useIndices, bool transactional)
+{
+  pxm->UnRegisterProxies();
+  vtkSmartPointer<vtkPVXMLElement> root = vtkPVXMLParser::ParseXML(state.c_str());
+  vtkPVXMLElement::SetUseLookupIndices(useIndices);
+  vtkNew<vtkSMStateLoader> loader;
+  loader->SetSessionProxyManager(pxm);
+  loader->SetTransactionalLoad(transactional);
+  pxm->LoadXMLState(root, loader);
+  vtkPVXMLElement::SetUseLookupIndices(true);
+}
+
+// Checks that every shrink filter was loaded with the sphere it was saved with.
+bool Check(vtkSMSessionProxyManager* pxm, int numPipelines)
+{
+  if (static_cast<int>(pxm->GetNumberOfProxies("sources")) != 2 * numPipelines)
+  {
+    cerr << "ERROR: " << pxm->GetNumberOfProxies("sources") << " proxies were loaded instead of "
+         << 2 * numPipelines << "." << endl;
+    return false;
+  }
+  for (int cc = 0; cc < numPipelines; ++cc)
+  {
+    const std::string index = std::to_string(cc);
+    vtkSMProxy* sphere = pxm->GetProxy("sources", ("sphere" + index).c_str());
+    vtkSMProxy* shrink = pxm->GetProxy("sources", ("shrink" + index).c_str());
+    if (!sphere || !shrink || vtkSMPropertyHelper(shrink, "Input").GetAsProxy() != sphere ||
+      vtkSMPropertyHelper(sphere, "ThetaResolution").GetAsInt() != 3 + cc % 100)
+    {
+      cerr << "ERROR: pipeline " << cc << " was not loaded correctly." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestLoadLargeState(int, char* argv[])
+{
+  const int numPipelines = 100;
+
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+  vtkSMSession* session = vtkSMSession::New();
+  vtkSMSessionProxyManager* pxm =
+    vtkSMProxyManager::GetProxyManager()->GetSessionProxyManager(session);
+
+  // Proxies referring to other proxies by id, as in any state file.
+  for (int cc = 0; cc < numPipelines; ++cc)
+  {
+    const std::string index = std::to_string(cc);
+    vtkSmartPointer<vtkSMProxy> sphere;
+    sphere.TakeReference(pxm->NewProxy("sources", "SphereSource"));
+    vtkSMPropertyHelper(sphere, "ThetaResolution").Set(3 + cc % 100);
+    sphere->UpdateVTKObjects();
+    pxm->RegisterProxy("sources", ("sphere" + index).c_str(), sphere);
+
+    vtkSmartPointer<vtkSMProxy> shrink;
+    shrink.TakeReference(pxm->NewProxy("filters", "ShrinkFilter"));
+    vtkSMPropertyHelper(shrink, "Input").Set(sphere);
+    shrink->UpdateVTKObjects();
+    pxm->RegisterProxy("sources", ("shrink" + index).c_str(), shrink);
+  }
+
+  vtkSmartPointer<vtkPVXMLElement> saved;
+  saved.TakeReference(pxm->SaveXMLState());
+  std::ostringstream stream;
+  saved->PrintXML(stream, vtkIndent());
+  const std::string state = stream.str();
+  saved = nullptr;
+
+  int exitCode = EXIT_SUCCESS;
+  LoadState(pxm, state, false, false);
+  if (!Check(pxm, numPipelines))
+  {
+    exitCode = EXIT_FAILURE;
+  }
+  LoadState(pxm, state, true, false);
+  if (!Check(pxm, numPipelines))
+  {
+    exitCode = EXIT_FAILURE;
+  }
+  // pushes are only batched in client-server sessions, but the proxies must be
+  // loaded the same.
+  LoadState(pxm, state, true, true);
+  if (!Check(pxm, numPipelines))
+  {
+    exitCode = EXIT_FAILURE;
+  }
+
+  pxm->UnRegisterProxies();
+  session->Delete();
+  vtkInitializationHelper::Finalize();
+  return exitCode;
+}
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkInitializationHelper.h"
+#include "vtkPVProxyDefinitionIterator.h"
+#include "vtkPVXMLElement.h"
+#include "vtkProcessModule.h"
+#include "vtkSIProxyDefinitionManager.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <string>
+
+namespace
+{
+// Collapsing is done from these definitions, thus is the same when they are.
+bool Compare(vtkSIProxyDefinitionManager* expected, vtkSIProxyDefinitionManager* actual)
+{
+  vtkSmartPointer<vtkPVProxyDefinitionIterator> iter;
+  iter.TakeReference(expected->NewIterator(vtkSIProxyDefinitionManager::CORE_DEFINITIONS));
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    const char* group = iter->GetGroupName();
+    const char* name = iter->GetProxyName();
+    vtkPVXMLElement* definition = actual->GetProxyDefinition(group, name, false);
+    if (!definition || !definition->Equals(iter->GetProxyDefinition()))
+    {
+      cerr << "ERROR: definition (" << group << ", " << name << ") differs." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestProxyDefinitionCache(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    cerr << "Could not determine temporary directory.\n";
+    return EXIT_FAILURE;
+  }
+  const std::string cacheDir = std::string(tempDir) + "/TestProxyDefinitionCache";
+  delete[] tempDir;
+  vtksys::SystemTools::RemoveADirectory(cacheDir);
+
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+  const std::string previousCacheDir = vtkSIProxyDefinitionManager::GetDefinitionCacheDirectory();
+
+  vtkSIProxyDefinitionManager::SetDefinitionCacheDirectory(std::string());
+  auto parsed = vtkSmartPointer<vtkSIProxyDefinitionManager>::New();
+
+  // The first startup writes the cache, the next one reads it.
+  vtkSIProxyDefinitionManager::SetDefinitionCacheDirectory(cacheDir);
+  auto written = vtkSmartPointer<vtkSIProxyDefinitionManager>::New();
+  const bool cached = vtksys::SystemTools::FileIsDirectory(cacheDir);
+  auto read = vtkSmartPointer<vtkSIProxyDefinitionManager>::New();
+  vtkSIProxyDefinitionManager::SetDefinitionCacheDirectory(previousCacheDir);
+
+  int exitCode = EXIT_SUCCESS;
+  if (!cached)
+  {
+    cerr << "ERROR: no cache file was written in " << cacheDir << "." << endl;
+    exitCode = EXIT_FAILURE;
+  }
+  else if (!Compare(parsed, written) || !Compare(parsed, read))
+  {
+    exitCode = EXIT_FAILURE;
+  }
+
+  parsed = nullptr;
+  written = nullptr;
+  read = nullptr;
+  vtkInitializationHelper::Finalize();
+  return exitCode;
+}
@@ -25,11 +25,15 @@
 #include "vtkSmartPointer.h"
 
 #include "vtksys/FStream.hxx"
+#include "vtksys/SystemTools.hxx"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #define LOG(x)                                                                                     \
   if (this->LogStream)                                                                             \
@@ -67,6 +71,19 @@ void RMICallback(
       break;
   }
 }
+
+int& InformationReductionFanIn()
+{
+  static int fanIn = []() {
+    std::string value;
+    if (vtksys::SystemTools::GetEnv("PARAVIEW_INFORMATION_REDUCTION_FANIN", value))
+    {
+      return std::atoi(value.c_str());
+    }
+    return 2;
+  }();
+  return fanIn;
+}
 };
 //****************************************************************************/
 //                        Internal Class
@@ -881,6 +898,12 @@ bool vtkPVSessionCore::CollectInformation(vtkPVInformation* info)
     return true;
   }
 
+  const int fanIn = vtkPVSessionCore::GetInformationReductionFanIn();
+  if (fanIn >= 2 && info->IsAddInformationAssociative())
+  {
+    return this->ReduceInformation(info, fanIn);
+  }
+
   vtkIdType* rcvcounts = nullptr;     /* significant only at rank 0 */
   vtkIdType* offSet = nullptr;        /* significant only at rank 0 */
   int rbufsize = 0;                   /* significant only at rank 0 */
@@ -960,6 +983,72 @@ bool vtkPVSessionCore::CollectInformation(vtkPVInformation* info)
   return true;
 }
 
+//----------------------------------------------------------------------------
+bool vtkPVSessionCore::ReduceInformation(vtkPVInformation* info, int fanIn)
+{
+  vtkMultiProcessController* controller = this->ParallelController;
+  const int rank = controller->GetLocalProcessId();
+  const int nranks = controller->GetNumberOfProcesses();
+
+  // At each level, every rank that is a multiple of `span` merges the
+  // information from the ranks `rank + stride`, `rank + 2 * stride`, etc. Since
+  // children are merged in rank order, every rank always holds the merged
+  // information for a contiguous range of ranks, hence the result is the same
+  // as merging serially on the root as long as AddInformation is associative.
+  for (vtkIdType stride = 1; stride < nranks; stride *= fanIn)
+  {
+    const vtkIdType span = stride * fanIn;
+    if (rank % span != 0)
+    {
+      // Send the information merged so far to the parent and we're done.
+      const int parent = static_cast<int>(rank - (rank % span));
+
+      vtkClientServerStream stream;
+      info->CopyToStream(&stream);
+
+      const unsigned char* data;
+      size_t length;
+      stream.GetData(&data, &length);
+      vtkIdType local_length = static_cast<vtkIdType>(length);
+      controller->Send(&local_length, 1, parent, ROOT_SATELLITE_INFO_TAG);
+      controller->Send(data, local_length, parent, ROOT_SATELLITE_INFO_TAG);
+      break;
+    }
+
+    std::vector<unsigned char> buffer;
+    vtkClientServerStream rcvStream;
+    for (vtkIdType child = rank + stride; child < std::min<vtkIdType>(rank + span, nranks);
+         child += stride)
+    {
+      vtkIdType length = 0;
+      controller->Receive(&length, 1, static_cast<int>(child), ROOT_SATELLITE_INFO_TAG);
+      buffer.resize(static_cast<size_t>(length));
+      controller->Receive(buffer.data(), length, static_cast<int>(child), ROOT_SATELLITE_INFO_TAG);
+
+      rcvStream.SetData(buffer.data(), buffer.size());
+      vtkSmartPointer<vtkPVInformation> tempInfo;
+      tempInfo.TakeReference(info->NewInstance());
+      tempInfo->CopyFromStream(&rcvStream);
+      info->AddInformation(tempInfo);
+    }
+  }
+
+  this->ParallelController->Barrier();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSessionCore::SetInformationReductionFanIn(int fanIn)
+{
+  InformationReductionFanIn() = fanIn;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVSessionCore::GetInformationReductionFanIn()
+{
+  return InformationReductionFanIn();
+}
+
 //----------------------------------------------------------------------------
 void vtkPVSessionCore::RegisterRemoteObject(vtkTypeUInt32 gid, vtkObject* obj)
 {
@@ -176,6 +176,24 @@ public:
    */
   void GarbageCollectSIObject(int* clientIds, int nbClients);
 
+  ///@{
+  /**
+   * Get/Set the fan-in of the reduction tree used to collect information from
+   * MPI satellites for information classes that report
+   * vtkPVInformation::IsAddInformationAssociative(). With a fan-in of `k`,
+   * each rank merges the information from up to `k - 1` other ranks at each
+   * level, thus the root only receives from `log_k(P)` ranks. A value less than
+   * 2 disables the reduction tree and all ranks send their information to the
+   * root, which merges them serially.
+   *
+   * Default is 2 (binomial tree) unless overridden using the
+   * `PARAVIEW_INFORMATION_REDUCTION_FANIN` environment variable. The value must
+   * be the same on all ranks.
+   */
+  static void SetInformationReductionFanIn(int fanIn);
+  static int GetInformationReductionFanIn();
+  ///@}
+
 protected:
   vtkPVSessionCore();
   ~vtkPVSessionCore() override;
@@ -203,6 +221,13 @@ protected:
    */
   bool CollectInformation(vtkPVInformation*);
 
+  /**
+   * Gather information across MPI satellites using a k-ary reduction tree.
+   * Only used for information classes for which
+   * vtkPVInformation::IsAddInformationAssociative() returns true.
+   */
+  bool ReduceInformation(vtkPVInformation*, int fanIn);
+
   /**
    * Increment reference count of a local vtkSIObject.
    */
@@ -513,22 +513,22 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int message_len
     {
       std::string string;
       stream >> string;
-      vtkSMMessage msg;
-      msg.ParseFromString(string);
-
-      //      cout << "=================================" << endl;
-      //      msg.PrintDebugString();
-      //      cout << "=================================" << endl;
+      this->PushStateFromClient(string);
+    }
+    break;
 
-      // Do we skip the processing ?
-      if (!this->Internal->StoreShareOnly(&msg))
+    case vtkPVSessionServer::PUSH_BATCH:
+    {
+      // Pushes are processed in the order the client made them, which keeps
+      // proxies created before the proxies referring to them.
+      int count;
+      stream >> count;
+      for (int cc = 0; cc < count; ++cc)
       {
-        this->PushState(&msg);
+        std::string string;
+        stream >> string;
+        this->PushStateFromClient(string);
       }
-
-      // Notify when ProxyManager state has changed
-      // or any other state change
-      this->NotifyOtherClients(&msg);
     }
     break;
 
@@ -551,6 +551,29 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int message_len
       this->Internal->GetActiveController()->Send(css, 1, vtkPVSessionServer::REPLY_PULL);
     }
     break;
+
+    case vtkPVSessionServer::PULL_BATCH:
+    {
+      // All the results are sent back to the client as a single reply.
+      int count;
+      stream >> count;
+      vtkMultiProcessStream css;
+      css << count;
+      for (int cc = 0; cc < count; ++cc)
+      {
+        std::string string;
+        stream >> string;
+        vtkSMMessage msg;
+        msg.ParseFromString(string);
+        if (!this->Internal->RetreiveShareOnly(&msg))
+        {
+          this->PullState(&msg);
+        }
+        css << msg.SerializeAsString();
+      }
+      this->Internal->GetActiveController()->Send(css, 1, vtkPVSessionServer::REPLY_PULL);
+    }
+    break;
     case vtkPVSessionServer::REGISTER_SI:
     {
       std::string string;
@@ -601,6 +624,27 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int message_len
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVSessionServer::PushStateFromClient(const std::string& state)
+{
+  vtkSMMessage msg;
+  msg.ParseFromString(state);
+
+  //      cout << "=================================" << endl;
+  //      msg.PrintDebugString();
+  //      cout << "=================================" << endl;
+
+  // Do we skip the processing ?
+  if (!this->Internal->StoreShareOnly(&msg))
+  {
+    this->PushState(&msg);
+  }
+
+  // Notify when ProxyManager state has changed
+  // or any other state change
+  this->NotifyOtherClients(&msg);
+}
+
 //----------------------------------------------------------------------------
 void vtkPVSessionServer::SendLastResultToClient()
 {
@@ -16,6 +16,8 @@
 #include "vtkPVSessionBase.h"
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 
+#include <string> // needed for std::string
+
 class vtkMultiProcessController;
 class vtkMultiProcessStream;
 
@@ -71,6 +73,8 @@ public:
     REGISTER_SI = 16,
     UNREGISTER_SI = 17,
     LAST_RESULT = 18,
+    PUSH_BATCH = 19,
+    PULL_BATCH = 20,
     SERVER_NOTIFICATION_MESSAGE_RMI = 55624,
     CLIENT_SERVER_MESSAGE_RMI = 55625,
     CLOSE_SESSION = 55626,
@@ -139,6 +143,11 @@ protected:
    */
   void SendLastResultToClient();
 
+  /**
+   * Called when client triggers PushState(), with the serialized message.
+   */
+  void PushStateFromClient(const std::string& state);
+
   vtkMPIMToNSocketConnection* MPIMToNSocketConnection;
 
   bool MultipleConnection;
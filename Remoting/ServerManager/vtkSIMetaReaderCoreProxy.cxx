@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSIMetaReaderCoreProxy.h"
+
+#include "vtkObjectFactory.h"
+#include "vtkSIMetaReaderProxy.h"
+#include "vtkSMMessage.h"
+
+vtkStandardNewMacro(vtkSIMetaReaderCoreProxy);
+//----------------------------------------------------------------------------
+vtkSIMetaReaderCoreProxy::vtkSIMetaReaderCoreProxy() = default;
+
+//----------------------------------------------------------------------------
+vtkSIMetaReaderCoreProxy::~vtkSIMetaReaderCoreProxy() = default;
+
+//----------------------------------------------------------------------------
+void vtkSIMetaReaderCoreProxy::SetMetaReader(vtkSIMetaReaderProxy* metaReader)
+{
+  this->MetaReader = metaReader;
+}
+
+//----------------------------------------------------------------------------
+void vtkSIMetaReaderCoreProxy::Push(vtkSMMessage* message)
+{
+  if (this->MetaReader && message->ExtensionSize(ProxyState::property) > 0)
+  {
+    // the prefetching thread must not read with the reader being modified, and
+    // what it read is invalidated anyway.
+    this->MetaReader->StopPrefetching();
+  }
+  this->Superclass::Push(message);
+}
+
+//----------------------------------------------------------------------------
+void vtkSIMetaReaderCoreProxy::Pull(vtkSMMessage* message)
+{
+  vtkSIMetaReaderProxy* metaReader = this->MetaReader;
+  if (!metaReader)
+  {
+    this->Superclass::Pull(message);
+    return;
+  }
+  // the prefetching thread updates the information of the reader for each file
+  // it reads, but does not need to be stopped.
+  metaReader->LockReader();
+  this->Superclass::Pull(message);
+  metaReader->UnlockReader();
+}
+
+//----------------------------------------------------------------------------
+void vtkSIMetaReaderCoreProxy::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSIMetaReaderCoreProxy
+ *
+ * vtkSIMetaReaderCoreProxy is the server-side helper for the internal reader
+ * of a vtkSIMetaReaderProxy that can prefetch files on a background thread.
+ * Using it as the si_class of the internal reader proxy declares that the
+ * reader can be used from another thread. Properties are pushed to the reader
+ * once prefetching is stopped, and pulled from it while the prefetching thread
+ * is kept off the reader. Used alone, it behaves like vtkSIProxy.
+ *
+ * @sa vtkSIMetaReaderProxy, vtkFileSeriesReader
+ */
+
+#ifndef vtkSIMetaReaderCoreProxy_h
+#define vtkSIMetaReaderCoreProxy_h
+
+#include "vtkRemotingServerManagerModule.h" //needed for exports
+#include "vtkSIProxy.h"
+#include "vtkWeakPointer.h" // needed for vtkWeakPointer
+
+class vtkSIMetaReaderProxy;
+
+class VTKREMOTINGSERVERMANAGER_EXPORT vtkSIMetaReaderCoreProxy : public vtkSIProxy
+{
+public:
+  static vtkSIMetaReaderCoreProxy* New();
+  vtkTypeMacro(vtkSIMetaReaderCoreProxy, vtkSIProxy);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Overridden to synchronize with the prefetching thread of the meta reader.
+   */
+  void Push(vtkSMMessage* msg) override;
+  void Pull(vtkSMMessage* msg) override;
+  ///@}
+
+  /**
+   * Set by the meta reader this proxy is the internal reader of.
+   */
+  void SetMetaReader(vtkSIMetaReaderProxy* metaReader);
+
+protected:
+  vtkSIMetaReaderCoreProxy();
+  ~vtkSIMetaReaderCoreProxy() override;
+
+  vtkWeakPointer<vtkSIMetaReaderProxy> MetaReader;
+
+private:
+  vtkSIMetaReaderCoreProxy(const vtkSIMetaReaderCoreProxy&) = delete;
+  void operator=(const vtkSIMetaReaderCoreProxy&) = delete;
+};
+
+#endif
@@ -9,6 +9,8 @@
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVXMLElement.h"
+#include "vtkSIMetaReaderCoreProxy.h"
+#include "vtkSMMessage.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <sstream>
@@ -41,6 +43,13 @@ void vtkSIMetaReaderProxy::OnCreateVTKObjects()
     vtkErrorMacro("Missing subproxy: Reader");
     return;
   }
+  // the properties of the internal reader are pushed and pulled by its own
+  // proxy, which must synchronize with prefetching as well.
+  if (auto* core = vtkSIMetaReaderCoreProxy::SafeDownCast(this->GetSubSIProxy("Reader")))
+  {
+    core->SetMetaReader(this);
+  }
+
   vtkClientServerStream stream;
   stream << vtkClientServerStream::Invoke << this->GetVTKObject() << "SetReader" << reader
          << vtkClientServerStream::End;
@@ -52,6 +61,46 @@ void vtkSIMetaReaderProxy::OnCreateVTKObjects()
   this->Interpreter->ProcessStream(stream);
 }
 
+//----------------------------------------------------------------------------
+void vtkSIMetaReaderProxy::Push(vtkSMMessage* message)
+{
+  if (message->ExtensionSize(ProxyState::property) > 0)
+  {
+    this->StopPrefetching();
+  }
+  this->Superclass::Push(message);
+}
+
+//----------------------------------------------------------------------------
+void vtkSIMetaReaderProxy::StopPrefetching()
+{
+  this->InvokeOnFileSeriesReader("StopPrefetching");
+}
+
+//----------------------------------------------------------------------------
+void vtkSIMetaReaderProxy::LockReader()
+{
+  this->InvokeOnFileSeriesReader("LockReader");
+}
+
+//----------------------------------------------------------------------------
+void vtkSIMetaReaderProxy::UnlockReader()
+{
+  this->InvokeOnFileSeriesReader("UnlockReader");
+}
+
+//----------------------------------------------------------------------------
+void vtkSIMetaReaderProxy::InvokeOnFileSeriesReader(const char* method)
+{
+  vtkObjectBase* object = this->GetVTKObject();
+  if (object && object->IsA("vtkFileSeriesReader"))
+  {
+    vtkClientServerStream stream;
+    stream << vtkClientServerStream::Invoke << object << method << vtkClientServerStream::End;
+    this->Interpreter->ProcessStream(stream);
+  }
+}
+
 //----------------------------------------------------------------------------
 bool vtkSIMetaReaderProxy::ReadXMLAttributes(vtkPVXMLElement* element)
 {
@@ -25,6 +25,24 @@ public:
   vtkTypeMacro(vtkSIMetaReaderProxy, vtkSISourceProxy);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  /**
+   * Overridden to stop the prefetching thread of vtkFileSeriesReader, which
+   * uses the file names and the internal reader, before properties are pushed.
+   */
+  void Push(vtkSMMessage* msg) override;
+
+  ///@{
+  /**
+   * Synchronize with the prefetching thread of vtkFileSeriesReader, if the
+   * meta reader has one. See vtkFileSeriesReader::StopPrefetching() and
+   * vtkFileSeriesReader::LockReader(). vtkSIMetaReaderCoreProxy calls these
+   * around the pushes and pulls of the properties of the internal reader.
+   */
+  void StopPrefetching();
+  void LockReader();
+  void UnlockReader();
+  ///@}
+
 protected:
   vtkSIMetaReaderProxy();
   ~vtkSIMetaReaderProxy() override;
@@ -46,6 +64,8 @@ protected:
 private:
   vtkSIMetaReaderProxy(const vtkSIMetaReaderProxy&) = delete;
   void operator=(const vtkSIMetaReaderProxy&) = delete;
+
+  void InvokeOnFileSeriesReader(const char* method);
 };
 
 #endif
@@ -12,6 +12,7 @@
 #include "vtkPVProxyDefinitionIterator.h"
 #include "vtkPVServerManagerPluginInterface.h"
 #include "vtkPVSession.h"
+#include "vtkPVVersion.h" // for PARAVIEW_VERSION_FULL
 #include "vtkPVXMLElement.h"
 #include "vtkPVXMLParser.h"
 #include "vtkProcessModule.h"
@@ -22,13 +23,18 @@
 #include "vtkTimerLog.h"
 
 #include <cassert>
+#include <cstring>
+#include <iomanip>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include <vtksys/FStream.hxx>
 #include <vtksys/RegularExpression.hxx>
+#include <vtksys/SystemTools.hxx>
 
 //****************************************************************************/
 //                    Internal Classes and typedefs
@@ -37,6 +43,108 @@ typedef vtkSmartPointer<vtkPVXMLElement> XMLElement;
 typedef std::map<std::string, XMLElement> StrToXmlMap;
 typedef std::map<std::string, StrToXmlMap> StrToStrToXmlMap;
 
+// A core definition read from a cache file. Its vtkPVXMLElement tree is only
+// created from the binary form the first time the definition is accessed.
+struct PendingDefinition
+{
+  std::shared_ptr<const std::string> Buffer;
+  size_t Offset;
+  size_t Length;
+};
+typedef std::map<std::string, std::map<std::string, PendingDefinition>> StrToStrToPendingMap;
+
+namespace
+{
+const char DefinitionCacheMagic[8] = { 'P', 'V', 'S', 'M', 'D', 'E', 'F', 'S' };
+const vtkTypeUInt32 DefinitionCacheFormatVersion = 1;
+const vtkTypeUInt32 DefinitionCacheByteOrder = 0x01020304;
+
+std::string& DefinitionCacheDirectory()
+{
+  static std::string directory = []() {
+    std::string value;
+    vtksys::SystemTools::GetEnv("PARAVIEW_PROXY_DEFINITION_CACHE_DIRECTORY", value);
+    return value;
+  }();
+  return directory;
+}
+
+//----------------------------------------------------------------------------
+// Create the element of a pending definition, if any, and stop tracking it.
+vtkPVXMLElement* MaterializeDefinition(StrToStrToPendingMap& pendingMap,
+  const std::string& groupName, const std::string& proxyName, XMLElement& element)
+{
+  auto groupIter = pendingMap.find(groupName);
+  if (groupIter != pendingMap.end())
+  {
+    auto iter = groupIter->second.find(proxyName);
+    if (iter != groupIter->second.end())
+    {
+      const PendingDefinition& pending = iter->second;
+      element =
+        vtkPVXMLElement::ReadBinary(pending.Buffer->data() + pending.Offset, pending.Length);
+      groupIter->second.erase(iter);
+    }
+  }
+  return element;
+}
+
+//----------------------------------------------------------------------------
+// 64-bit FNV-1a hash, the length is hashed too so that concatenations differ.
+void HashDefinitionCacheKey(vtkTypeUInt64& hash, const char* data, size_t length)
+{
+  const vtkTypeUInt64 prime = 1099511628211ULL;
+  for (size_t cc = 0; cc < sizeof(length); ++cc)
+  {
+    hash = (hash ^ ((length >> (8 * cc)) & 0xff)) * prime;
+  }
+  for (size_t cc = 0; cc < length; ++cc)
+  {
+    hash = (hash ^ static_cast<unsigned char>(data[cc])) * prime;
+  }
+}
+
+void HashDefinitionCacheKey(vtkTypeUInt64& hash, const std::string& str)
+{
+  HashDefinitionCacheKey(hash, str.data(), str.size());
+}
+
+//----------------------------------------------------------------------------
+void WriteCacheValue(std::string& buffer, vtkTypeUInt32 value)
+{
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void WriteCacheString(std::string& buffer, const std::string& str)
+{
+  WriteCacheValue(buffer, static_cast<vtkTypeUInt32>(str.size()));
+  buffer.append(str);
+}
+
+bool ReadCacheValue(const char*& data, const char* end, vtkTypeUInt32& value)
+{
+  if (static_cast<size_t>(end - data) < sizeof(value))
+  {
+    return false;
+  }
+  memcpy(&value, data, sizeof(value));
+  data += sizeof(value);
+  return true;
+}
+
+bool ReadCacheString(const char*& data, const char* end, std::string& str)
+{
+  vtkTypeUInt32 length;
+  if (!ReadCacheValue(data, end, length) || static_cast<size_t>(end - data) < length)
+  {
+    return false;
+  }
+  str.assign(data, length);
+  data += length;
+  return true;
+}
+}
+
 class vtkSIProxyDefinitionManager::vtkInternals
 {
 public:
@@ -48,10 +156,19 @@ public:
   StrToStrToXmlMap CoreDefinitions;
   // Keep track of custom definition
   StrToStrToXmlMap CustomsDefinitions;
+  // Keep track of ServerManager definition read from a cache but not created yet
+  StrToStrToPendingMap PendingDefinitions;
+  // Keep track of the ServerManager definition loaded from the XMLs of a
+  // plugin, in the binary form written to the cache.
+  bool RecordDefinitions;
+  std::string RecordedDefinitions;
+  vtkTypeUInt32 NumberOfRecordedDefinitions;
   //-------------------------------------------------------------------------
   vtkInternals()
     : EnableXMLProxyDefinitionUpdate(true)
     , ReplaceOverrideInParent(true)
+    , RecordDefinitions(false)
+    , NumberOfRecordedDefinitions(0)
   {
   }
   //-------------------------------------------------------------------------
@@ -59,6 +176,31 @@ public:
   {
     this->CoreDefinitions.clear();
     this->CustomsDefinitions.clear();
+    this->PendingDefinitions.clear();
+  }
+  //-------------------------------------------------------------------------
+  void RecordDefinition(const char* groupName, const char* proxyName, vtkPVXMLElement* element)
+  {
+    std::string binary;
+    element->WriteBinary(binary);
+    WriteCacheString(this->RecordedDefinitions, groupName);
+    WriteCacheString(this->RecordedDefinitions, proxyName);
+    WriteCacheValue(this->RecordedDefinitions,
+      element->GetName() && strcmp(element->GetName(), "Extension") == 0 ? 1 : 0);
+    WriteCacheValue(this->RecordedDefinitions, static_cast<vtkTypeUInt32>(binary.size()));
+    this->RecordedDefinitions.append(binary);
+    this->NumberOfRecordedDefinitions++;
+  }
+  //-------------------------------------------------------------------------
+  void MaterializeGroup(const char* groupName)
+  {
+    for (auto& pair : this->CoreDefinitions[groupName])
+    {
+      if (!pair.second)
+      {
+        MaterializeDefinition(this->PendingDefinitions, groupName, pair.first, pair.second);
+      }
+    }
   }
   //-------------------------------------------------------------------------
   bool HasCoreDefinition(const char* groupName, const char* proxyName)
@@ -99,7 +241,7 @@ public:
   }
   //-------------------------------------------------------------------------
   vtkPVXMLElement* GetProxyElement(
-    const StrToStrToXmlMap& map, const char* firstStr, const char* secondStr)
+    StrToStrToXmlMap& map, const char* firstStr, const char* secondStr)
   {
     vtkPVXMLElement* elementToReturn = nullptr;
 
@@ -107,15 +249,20 @@ public:
     if (firstStr && secondStr)
     {
       // Find the value based on both keys
-      StrToStrToXmlMap::const_iterator it = map.find(firstStr);
+      StrToStrToXmlMap::iterator it = map.find(firstStr);
       if (it != map.end())
       {
         // We found a match for the first key
-        StrToXmlMap::const_iterator it2 = it->second.find(secondStr);
+        StrToXmlMap::iterator it2 = it->second.find(secondStr);
         if (it2 != it->second.end())
         {
-          // We found a match for the second key
-          elementToReturn = it2->second.GetPointer();
+          // We found a match for the second key, that may not be created yet
+          elementToReturn = it2->second;
+          if (!elementToReturn)
+          {
+            elementToReturn =
+              MaterializeDefinition(this->PendingDefinitions, it->first, it2->first, it2->second);
+          }
         }
       }
     }
@@ -256,7 +403,13 @@ public:
     }
     else
     {
-      return this->CoreProxyIterator->second.GetPointer();
+      XMLElement& element = this->CoreProxyIterator->second;
+      if (!element && this->PendingDefinitionMap)
+      {
+        MaterializeDefinition(*this->PendingDefinitionMap, this->CurrentGroupName,
+          this->CoreProxyIterator->first, element);
+      }
+      return element.GetPointer();
     }
   }
   //-------------------------------------------------------------------------
@@ -286,6 +439,11 @@ public:
     this->CustomDefinitionMap = map;
     this->InvalidCustomIterator = true;
   }
+  //-------------------------------------------------------------------------
+  void RegisterPendingDefinitionMap(StrToStrToPendingMap* map)
+  {
+    this->PendingDefinitionMap = map;
+  }
 
   //-------------------------------------------------------------------------
   void GoToNextGroup() override { this->NextGroup(); }
@@ -296,6 +454,7 @@ protected:
     this->Initialized = false;
     this->CoreDefinitionMap = nullptr;
     this->CustomDefinitionMap = nullptr;
+    this->PendingDefinitionMap = nullptr;
     this->InvalidCoreIterator = true;
     this->InvalidCustomIterator = true;
   }
@@ -398,6 +557,7 @@ private:
   StrToXmlMap::iterator CustomProxyIteratorEnd;
   StrToStrToXmlMap* CoreDefinitionMap;
   StrToStrToXmlMap* CustomDefinitionMap;
+  StrToStrToPendingMap* PendingDefinitionMap;
   std::set<std::string> GroupNames;
   std::set<std::string>::iterator GroupNameIterator;
   bool InvalidCoreIterator;
@@ -491,6 +651,11 @@ void vtkSIProxyDefinitionManager::AddElement(
   {
     // Just referenced it
     this->Internals->CoreDefinitions[groupName][proxyName] = element;
+    auto pending = this->Internals->PendingDefinitions.find(groupName);
+    if (pending != this->Internals->PendingDefinitions.end())
+    {
+      pending->second.erase(proxyName);
+    }
     updated = true;
   }
 
@@ -804,6 +969,10 @@ bool vtkSIProxyDefinitionManager::LoadConfigurationXML(
       proxyName = proxy->GetAttributeOrEmpty("name");
       if (!proxyName.empty())
       {
+        if (this->Internals->RecordDefinitions)
+        {
+          this->Internals->RecordDefinition(groupName.c_str(), proxyName.c_str(), proxy);
+        }
         this->AddElement(groupName.c_str(), proxyName.c_str(), proxy);
       }
     }
@@ -843,12 +1012,14 @@ vtkPVProxyDefinitionIterator* vtkSIProxyDefinitionManager::NewIterator(int scope
   {
     case vtkSIProxyDefinitionManager::CORE_DEFINITIONS: // Core only
       iterator->RegisterCoreDefinitionMap(&this->Internals->CoreDefinitions);
+      iterator->RegisterPendingDefinitionMap(&this->Internals->PendingDefinitions);
       break;
     case vtkSIProxyDefinitionManager::CUSTOM_DEFINITIONS: // Custom only
       iterator->RegisterCustomDefinitionMap(&this->Internals->CustomsDefinitions);
       break;
     default: // Both
       iterator->RegisterCoreDefinitionMap(&this->Internals->CoreDefinitions);
+      iterator->RegisterPendingDefinitionMap(&this->Internals->PendingDefinitions);
       iterator->RegisterCustomDefinitionMap(&this->Internals->CustomsDefinitions);
       break;
   }
@@ -1118,6 +1289,8 @@ void vtkSIProxyDefinitionManager::Push(vtkSMMessage* msg)
   // proxy definitions on the client side when a server's definitions are
   // loaded. Ideally, we save all proxies that are "client" only. We will do
   // that when we convert this class to use pugixml.
+  this->Internals->MaterializeGroup("animation_writers");
+  this->Internals->MaterializeGroup("screenshot_writers");
   const auto animationWriters = this->Internals->CoreDefinitions["animation_writers"];
   const auto screenshotWriters = this->Internals->CoreDefinitions["screenshot_writers"];
 
@@ -1190,14 +1363,51 @@ void vtkSIProxyDefinitionManager::HandlePlugin(vtkPVPlugin* plugin)
     // Make sure only the SERVER is processing the XML proxy definition
     if (this->Internals->EnableXMLProxyDefinitionUpdate)
     {
+      // if GetPluginName() == vtkPVInitializerPlugin, it implies that it's
+      // the ParaView core and should not be treated as plugin.
+      const bool attachHints = strcmp(plugin->GetPluginName(), "vtkPVInitializerPlugin") != 0;
       bool tmpReplaceOverrideInParent = this->Internals->ReplaceOverrideInParent;
       this->Internals->ReplaceOverrideInParent = false;
-      for (size_t cc = 0; cc < xmls.size(); cc++)
+
+      // The cache is keyed by the plugin XMLs and everything that changes how
+      // they are loaded.
+      std::string cacheFileName;
+      vtkTypeUInt64 cacheKey = 14695981039346656037ULL;
+      const std::string& cacheDirectory = DefinitionCacheDirectory();
+      if (!cacheDirectory.empty() && !xmls.empty())
       {
-        this->LoadConfigurationXMLFromString(xmls[cc].c_str(),
-          // if GetPluginName() == vtkPVInitializerPlugin, it implies that it's
-          // the ParaView core and should not be treated as plugin.
-          strcmp(plugin->GetPluginName(), "vtkPVInitializerPlugin") != 0, false);
+        HashDefinitionCacheKey(cacheKey, PARAVIEW_VERSION_FULL);
+        HashDefinitionCacheKey(cacheKey, plugin->GetPluginName());
+        HashDefinitionCacheKey(cacheKey, plugin->GetPluginVersionString());
+        HashDefinitionCacheKey(cacheKey, attachHints ? "hints" : "");
+        for (const auto& xml : xmls)
+        {
+          HashDefinitionCacheKey(cacheKey, xml);
+        }
+        std::ostringstream fileName;
+        fileName << cacheDirectory << "/" << plugin->GetPluginName() << "-" << std::hex
+                 << std::setw(16) << std::setfill('0') << cacheKey << ".pvdefs";
+        cacheFileName = fileName.str();
+      }
+
+      if (cacheFileName.empty() || !this->LoadDefinitionCache(cacheFileName, cacheKey))
+      {
+        bool loaded = true;
+        this->Internals->RecordDefinitions = !cacheFileName.empty();
+        for (size_t cc = 0; cc < xmls.size(); cc++)
+        {
+          loaded = this->LoadConfigurationXMLFromString(xmls[cc].c_str(), attachHints, false) &&
+            loaded;
+        }
+        // Do not cache the definitions of a plugin with invalid XMLs, to keep
+        // reporting the errors.
+        if (this->Internals->RecordDefinitions && loaded)
+        {
+          this->SaveDefinitionCache(cacheFileName, cacheKey);
+        }
+        this->Internals->RecordDefinitions = false;
+        this->Internals->RecordedDefinitions.clear();
+        this->Internals->NumberOfRecordedDefinitions = 0;
       }
 
       // Make sure we invalidate any cached flatten version of our proxy definition
@@ -1207,6 +1417,161 @@ void vtkSIProxyDefinitionManager::HandlePlugin(vtkPVPlugin* plugin)
     }
   }
 }
+//---------------------------------------------------------------------------
+bool vtkSIProxyDefinitionManager::LoadDefinitionCache(
+  const std::string& fileName, vtkTypeUInt64 key)
+{
+  // Read the whole file at once, the definitions are created from it when
+  // accessed.
+  vtksys::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+  if (!file)
+  {
+    return false;
+  }
+  file.seekg(0, std::ios::end);
+  const std::streamoff size = file.tellg();
+  file.seekg(0, std::ios::beg);
+  const size_t headerSize = sizeof(DefinitionCacheMagic) + 3 * sizeof(vtkTypeUInt32) + sizeof(key);
+  if (size < static_cast<std::streamoff>(headerSize))
+  {
+    return false;
+  }
+  auto buffer = std::make_shared<std::string>(static_cast<size_t>(size), '\0');
+  if (!file.read(&(*buffer)[0], size))
+  {
+    return false;
+  }
+
+  const char* data = buffer->data();
+  const char* end = data + buffer->size();
+  vtkTypeUInt32 formatVersion, byteOrder, numDefinitions;
+  vtkTypeUInt64 fileKey;
+  if (memcmp(data, DefinitionCacheMagic, sizeof(DefinitionCacheMagic)) != 0)
+  {
+    return false;
+  }
+  data += sizeof(DefinitionCacheMagic);
+  ReadCacheValue(data, end, formatVersion);
+  ReadCacheValue(data, end, byteOrder);
+  memcpy(&fileKey, data, sizeof(fileKey));
+  data += sizeof(fileKey);
+  ReadCacheValue(data, end, numDefinitions);
+  if (formatVersion != DefinitionCacheFormatVersion || byteOrder != DefinitionCacheByteOrder ||
+    fileKey != key)
+  {
+    return false;
+  }
+
+  // Check the whole file before adding any definition.
+  struct CachedDefinition
+  {
+    std::string GroupName;
+    std::string ProxyName;
+    vtkTypeUInt32 Extension;
+    size_t Offset;
+    size_t Length;
+  };
+  std::vector<CachedDefinition> definitions(numDefinitions);
+  for (auto& definition : definitions)
+  {
+    vtkTypeUInt32 length;
+    if (!ReadCacheString(data, end, definition.GroupName) ||
+      !ReadCacheString(data, end, definition.ProxyName) ||
+      !ReadCacheValue(data, end, definition.Extension) || !ReadCacheValue(data, end, length) ||
+      static_cast<size_t>(end - data) < length)
+    {
+      return false;
+    }
+    definition.Offset = static_cast<size_t>(data - buffer->data());
+    definition.Length = length;
+    data += length;
+  }
+  if (data != end)
+  {
+    return false;
+  }
+
+  for (const auto& definition : definitions)
+  {
+    const char* groupName = definition.GroupName.c_str();
+    const char* proxyName = definition.ProxyName.c_str();
+    if (definition.Extension)
+    {
+      // Extensions modify existing definitions, hence are applied right away.
+      vtkSmartPointer<vtkPVXMLElement> element =
+        vtkPVXMLElement::ReadBinary(buffer->data() + definition.Offset, definition.Length);
+      if (element)
+      {
+        this->AddElement(groupName, proxyName, element);
+      }
+    }
+    else
+    {
+      this->Internals->CoreDefinitions[groupName][proxyName] = nullptr;
+      this->Internals->PendingDefinitions[groupName][proxyName] =
+        PendingDefinition{ buffer, definition.Offset, definition.Length };
+
+      // Let the world know that a core-definition was registered.
+      RegisteredDefinitionInformation info(groupName, proxyName, false);
+      this->InvokeEvent(vtkCommand::RegisterEvent, &info);
+    }
+  }
+  return true;
+}
+
+//---------------------------------------------------------------------------
+void vtkSIProxyDefinitionManager::SaveDefinitionCache(
+  const std::string& fileName, vtkTypeUInt64 key)
+{
+  // Only one rank writes the cache, the others would write the same file.
+  vtkProcessModule* pm = vtkProcessModule::GetProcessModule();
+  if (pm && pm->GetPartitionId() > 0)
+  {
+    return;
+  }
+
+  std::string header(DefinitionCacheMagic, sizeof(DefinitionCacheMagic));
+  WriteCacheValue(header, DefinitionCacheFormatVersion);
+  WriteCacheValue(header, DefinitionCacheByteOrder);
+  header.append(reinterpret_cast<const char*>(&key), sizeof(key));
+  WriteCacheValue(header, this->Internals->NumberOfRecordedDefinitions);
+
+  // Write to a temporary file first so that other processes never read a
+  // partially written cache.
+  std::ostringstream tmpFileName;
+  tmpFileName << fileName << "."
+              << static_cast<vtkTypeUInt64>(vtkTimerLog::GetUniversalTime() * 1e6) << ".tmp";
+  const std::string& records = this->Internals->RecordedDefinitions;
+  bool success =
+    vtksys::SystemTools::MakeDirectory(vtksys::SystemTools::GetFilenamePath(fileName)).IsSuccess();
+  if (success)
+  {
+    vtksys::ofstream file(tmpFileName.str().c_str(), std::ios::out | std::ios::binary);
+    file.write(header.data(), header.size());
+    file.write(records.data(), records.size());
+    file.close();
+    success = !file.fail();
+  }
+  success = success && vtksys::SystemTools::RenameFile(tmpFileName.str(), fileName).IsSuccess();
+  if (!success)
+  {
+    vtksys::SystemTools::RemoveFile(tmpFileName.str());
+    vtkWarningMacro("Failed to write the proxy definition cache '" << fileName << "'.");
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSIProxyDefinitionManager::SetDefinitionCacheDirectory(const std::string& directory)
+{
+  DefinitionCacheDirectory() = directory;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkSIProxyDefinitionManager::GetDefinitionCacheDirectory()
+{
+  return DefinitionCacheDirectory();
+}
+
 //---------------------------------------------------------------------------
 bool vtkSIProxyDefinitionManager::HasDefinition(const char* groupName, const char* proxyName)
 {
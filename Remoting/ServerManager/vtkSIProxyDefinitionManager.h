@@ -33,6 +33,8 @@
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 #include "vtkSIObject.h"
 
+#include <string> // for std::string
+
 class vtkPVPlugin;
 class vtkPVProxyDefinitionIterator;
 class vtkPVXMLElement;
@@ -194,6 +196,25 @@ public:
    */
   void EnableXMLProxyDefnitionUpdate(bool);
 
+  ///@{
+  /**
+   * Get/Set the directory where the proxy definitions of each plugin,
+   * including the ParaView core, are cached in a binary form. A cache file is
+   * written the first time the XMLs of a plugin are loaded and is keyed by the
+   * plugin name and a hash of the ParaView version, the plugin version and its
+   * XMLs. Afterwards, the definitions are read from it with a single read
+   * instead of parsing the XMLs, and the vtkPVXMLElement of a definition is
+   * only created the first time the definition is accessed.
+   *
+   * Default is empty, which disables the cache, unless overridden using the
+   * `PARAVIEW_PROXY_DEFINITION_CACHE_DIRECTORY` environment variable. It must
+   * be set before the vtkSIProxyDefinitionManager is created to be used for
+   * the core definitions.
+   */
+  static void SetDefinitionCacheDirectory(const std::string& directory);
+  static std::string GetDefinitionCacheDirectory();
+  ///@}
+
   /**
    * Push a new state to the underneath implementation
    * The provided implementation just store the message
@@ -268,6 +289,17 @@ protected:
   void HandlePlugin(vtkPVPlugin*);
   ///@}
 
+  ///@{
+  /**
+   * Load the definitions of a plugin from a cache file, or save the
+   * definitions recorded while loading the XMLs of the plugin to it. `key`
+   * must match the one the file was saved with. LoadDefinitionCache() returns
+   * false without adding any definition if the file is missing or invalid.
+   */
+  bool LoadDefinitionCache(const std::string& fileName, vtkTypeUInt64 key);
+  void SaveDefinitionCache(const std::string& fileName, vtkTypeUInt64 key);
+  ///@}
+
   /**
    * Called by the XML parser to add an element from which a proxy
    * can be created. Called during parsing.
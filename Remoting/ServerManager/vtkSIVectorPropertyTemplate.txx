@@ -238,7 +238,9 @@ bool vtkSIVectorPropertyTemplate<T, force_idtype>::Push(T* values, int number_of
     }
     if (this->ArgumentIsArray)
     {
-      stream << vtkClientServerStream::InsertArray(values, number_of_elements);
+      // The stream is processed before returning, so `values` can be
+      // referenced rather than copied.
+      stream << vtkClientServerStream::InsertBorrowedArray(values, number_of_elements);
     }
     else
     {
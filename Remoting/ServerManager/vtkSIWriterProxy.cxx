@@ -5,6 +5,7 @@
 #include "vtkAlgorithm.h"
 #include "vtkClientServerInterpreter.h"
 #include "vtkClientServerStream.h"
+#include "vtkCommand.h"
 #include "vtkInformation.h"
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
@@ -55,6 +56,10 @@ void vtkSIWriterProxy::OnCreateVTKObjects()
   vtkSIProxy* writerProxy = this->GetSubSIProxy("Writer");
   if (writerProxy)
   {
+    // the properties of the internal writer are pushed by its own proxy.
+    writerProxy->AddObserver(
+      vtkCommand::StartEvent, this, &vtkSIWriterProxy::WaitForPendingWrite);
+
     vtkClientServerStream stream;
     stream << vtkClientServerStream::Invoke << object << "SetWriter" << writerProxy->GetVTKObject()
            << vtkClientServerStream::End;
@@ -66,6 +71,16 @@ void vtkSIWriterProxy::OnCreateVTKObjects()
     this->Interpreter->ProcessStream(stream);
   }
 
+  if (object->IsA("vtkParallelSerialWriter"))
+  {
+    // share the process module's queue instead of starting a thread per writer.
+    vtkClientServerStream stream;
+    stream << vtkClientServerStream::Invoke << object << "SetCallbackQueue"
+           << vtkProcessModule::GetProcessModule()->GetCallbackQueue()
+           << vtkClientServerStream::End;
+    this->Interpreter->ProcessStream(stream);
+  }
+
   vtkSIProxy* helper = this->GetSubSIProxy("PreGatherHelper");
   if (helper)
   {
@@ -112,6 +127,33 @@ void vtkSIWriterProxy::OnCreateVTKObjects()
   stream.Reset();
 }
 
+//----------------------------------------------------------------------------
+void vtkSIWriterProxy::Push(vtkSMMessage* message)
+{
+  this->WaitForPendingWrite();
+  this->Superclass::Push(message);
+}
+
+//----------------------------------------------------------------------------
+void vtkSIWriterProxy::Pull(vtkSMMessage* message)
+{
+  this->WaitForPendingWrite();
+  this->Superclass::Pull(message);
+}
+
+//----------------------------------------------------------------------------
+void vtkSIWriterProxy::WaitForPendingWrite()
+{
+  vtkObjectBase* object = this->GetVTKObject();
+  if (object && object->IsA("vtkParallelSerialWriter"))
+  {
+    vtkClientServerStream stream;
+    stream << vtkClientServerStream::Invoke << object << "WaitForPendingWrite"
+           << vtkClientServerStream::End;
+    this->Interpreter->ProcessStream(stream);
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkSIWriterProxy::AddInput(int input_port, vtkAlgorithmOutput* connection, const char* method)
 {
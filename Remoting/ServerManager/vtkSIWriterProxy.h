@@ -37,6 +37,16 @@ public:
    */
   virtual void UpdatePipelineTime(double time);
 
+  ///@{
+  /**
+   * Overridden to wait for the pending asynchronous write of
+   * vtkParallelSerialWriter, which uses the internal writer, before the
+   * properties are pushed or pulled.
+   */
+  void Push(vtkSMMessage* msg) override;
+  void Pull(vtkSMMessage* msg) override;
+  ///@}
+
 protected:
   vtkSIWriterProxy();
   ~vtkSIWriterProxy() override;
@@ -52,6 +62,13 @@ protected:
    */
   bool ReadXMLAttributes(vtkPVXMLElement* element) override;
 
+  /**
+   * Wait for the pending asynchronous write, if the writer has one. This is
+   * also called before properties are pushed to or pulled from the internal
+   * writer.
+   */
+  void WaitForPendingWrite();
+
   char* FileNameMethod;
   vtkSetStringMacro(FileNameMethod);
 
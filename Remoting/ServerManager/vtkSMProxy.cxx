@@ -567,18 +567,34 @@ void vtkSMProxy::UpdatePropertyInformation()
 
 //---------------------------------------------------------------------------
 void vtkSMProxy::UpdatePropertyInformationInternal(vtkSMProperty* single_property /*=nullptr*/)
+{
+  vtkSMMessage message;
+  if (!this->PreparePropertyInformationRequest(&message, single_property))
+  {
+    return;
+  }
+
+  // Hmm, this changes message itself. Funky.
+  this->PullState(&message);
+
+  // Update internal values
+  this->LoadState(&message, this->Session->GetProxyLocator());
+}
+
+//---------------------------------------------------------------------------
+bool vtkSMProxy::PreparePropertyInformationRequest(
+  vtkSMMessage* message, vtkSMProperty* single_property /*=nullptr*/)
 {
   this->CreateVTKObjects();
 
   // If no location, it means no state...
   if (!this->ObjectsCreated || this->Location == 0)
   {
-    return;
+    return false;
   }
 
   bool some_thing_to_fetch = false;
-  vtkSMMessage message;
-  Variant* var = message.AddExtension(PullRequest::arguments);
+  Variant* var = message->AddExtension(PullRequest::arguments);
   var->set_type(Variant::STRING);
 
   vtkSMProxyInternals::PropertyInfoMap::iterator it;
@@ -604,16 +620,7 @@ void vtkSMProxy::UpdatePropertyInformationInternal(vtkSMProperty* single_propert
     }
   }
 
-  if (!some_thing_to_fetch)
-  {
-    return;
-  }
-
-  // Hmm, this changes message itself. Funky.
-  this->PullState(&message);
-
-  // Update internal values
-  this->LoadState(&message, this->Session->GetProxyLocator());
+  return some_thing_to_fetch;
 }
 
 //---------------------------------------------------------------------------
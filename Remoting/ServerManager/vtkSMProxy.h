@@ -929,6 +929,15 @@ protected:
    */
   virtual void UpdatePropertyInformationInternal(vtkSMProperty* prop = nullptr);
 
+  /**
+   * Fills `message` with the request pulling the information properties of
+   * this proxy, or only `prop` if not null, as sent by
+   * UpdatePropertyInformationInternal(). Returns false if there is nothing to
+   * pull. This makes it possible to pull the information of several proxies
+   * at once using vtkSMSession::PullStates().
+   */
+  bool PreparePropertyInformationRequest(vtkSMMessage* message, vtkSMProperty* prop = nullptr);
+
   /**
    * vtkSMProxy tracks state of properties on this proxy in an internal State
    * object. Since it tracks all the properties by index, if there's a potential
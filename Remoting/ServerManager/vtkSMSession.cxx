@@ -55,6 +55,7 @@ vtkSMSession::vtkSMSession(bool initialize_during_constructor /*=true*/,
 
   this->SessionProxyManager = nullptr;
   this->StateLocator = vtkSMStateLocator::New();
+  this->BatchedPushesCount = 0;
 
   // Create and setup deserializer for the local ProxyLocator
   vtkNew<vtkSMDeserializerProtobuf> deserializer;
@@ -114,6 +115,35 @@ void vtkSMSession::PushState(vtkSMMessage* msg)
   this->Superclass::PushState(msg);
 }
 
+//----------------------------------------------------------------------------
+void vtkSMSession::BeginBatchedPushes()
+{
+  ++this->BatchedPushesCount;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSession::EndBatchedPushes()
+{
+  if (this->BatchedPushesCount <= 0)
+  {
+    vtkErrorMacro("BeginBatchedPushes and EndBatchedPushes mismatch!");
+    return;
+  }
+  if (--this->BatchedPushesCount == 0)
+  {
+    this->SendBatchedPushes();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSession::PullStates(const std::vector<vtkSMMessage*>& messages)
+{
+  for (vtkSMMessage* message : messages)
+  {
+    this->PullState(message);
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSession::UpdateStateHistory(vtkSMMessage* msg)
 {
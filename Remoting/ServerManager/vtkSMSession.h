@@ -14,6 +14,8 @@
 #include "vtkPVSessionBase.h"
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 
+#include <vector> // needed for std::vector
+
 class vtkSMCollaborationManager;
 class vtkSMProxyLocator;
 class vtkSMSessionProxyManager;
@@ -132,6 +134,32 @@ public:
    */
   void PushState(vtkSMMessage* msg) override;
 
+  ///@{
+  /**
+   * Should be called to begin/end a batch of state pushes. Within a batch,
+   * sessions connected to remote servers hold back the pushes meant for the
+   * servers and send them as a single message per server when the outermost
+   * batch ends, or earlier when anything else has to be sent to the servers.
+   * The servers process the pushes in the order they were made. Batches may
+   * be nested.
+   */
+  void BeginBatchedPushes();
+  void EndBatchedPushes();
+  ///@}
+
+  /**
+   * Returns true if the session is within a BeginBatchedPushes() and
+   * EndBatchedPushes() block.
+   */
+  bool GetBatchedPushes() { return this->BatchedPushesCount > 0; }
+
+  /**
+   * Pulls the state of several objects, as PullState() does for each of them.
+   * Sessions connected to remote servers send the requests meant for each
+   * server as a single message and wait for a single reply.
+   */
+  virtual void PullStates(const std::vector<vtkSMMessage*>& messages);
+
   /**
    * Sends the message to all clients.
    */
@@ -300,6 +328,12 @@ protected:
    */
   void UpdateStateHistory(vtkSMMessage* msg);
 
+  /**
+   * Called when the outermost batch of pushes ends. Subclasses holding back
+   * pushes should send them here.
+   */
+  virtual void SendBatchedPushes() {}
+
   vtkSMSessionProxyManager* SessionProxyManager;
   vtkSMStateLocator* StateLocator;
   vtkSMProxyLocator* ProxyLocator;
@@ -307,6 +341,8 @@ protected:
 private:
   vtkSMSession(const vtkSMSession&) = delete;
   void operator=(const vtkSMSession&) = delete;
+
+  int BatchedPushesCount;
 };
 
 #endif
@@ -81,6 +81,8 @@ vtkSMSessionClient::vtkSMSessionClient()
   // Default value
   this->NoMoreDelete = false;
   this->NotBusy = 0;
+  this->NumberOfMessagesSent = 0;
+  this->NumberOfRoundTrips = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -522,6 +524,7 @@ bool vtkSMSessionClient::IsMPIInitialized(vtkTypeUInt32 servers)
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::CloseSession()
 {
+  this->SendBatchedPushes();
   if (this->DataServerController)
   {
     this->DataServerController->TriggerRMIOnAllChildren(vtkPVSessionServer::CLOSE_SESSION);
@@ -587,15 +590,10 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
   }
   if (num_controllers > 0)
   {
-    vtkMultiProcessStream stream;
-    stream << static_cast<int>(vtkPVSessionServer::PUSH);
-    stream << message->SerializeAsString();
-    std::vector<unsigned char> raw_message;
-    stream.GetRawData(raw_message);
+    const std::string state = message->SerializeAsString();
     for (int cc = 0; cc < num_controllers; cc++)
     {
-      controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+      this->PushStateToServer(controllers[cc], state);
     }
   }
 
@@ -626,14 +624,7 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
         // Add extra-information
         msg.set_share_only(true);
         msg.set_client_id(this->ServerInformation->GetClientId());
-
-        vtkMultiProcessStream stream;
-        stream << static_cast<int>(vtkPVSessionServer::PUSH);
-        stream << msg.SerializeAsString();
-        std::vector<unsigned char> raw_message;
-        stream.GetRawData(raw_message);
-        this->DataServerController->TriggerRMIOnAllChildren(&raw_message[0],
-          static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+        this->PushStateToServer(this->DataServerController, msg.SerializeAsString());
       }
       else if (!remoteObject)
       {
@@ -656,29 +647,70 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
 }
 
 //----------------------------------------------------------------------------
-void vtkSMSessionClient::PullState(vtkSMMessage* message)
+void vtkSMSessionClient::PushStateToServer(
+  vtkMultiProcessController* controller, const std::string& state)
 {
-  this->StartBusyWork();
-  vtkTypeUInt32 location = this->GetRealLocation(message->location());
-  message->set_location(location);
-
-  vtkMultiProcessController* controller = nullptr;
-
-  // We make sure that only ONE location is targeted with a priority order
-  // (1) Client (2) DataServer (3) RenderServer
-  if ((location & vtkPVSession::CLIENT) != 0)
-  {
-    controller = nullptr;
-  }
-  else if ((location & (vtkPVSession::DATA_SERVER | vtkPVSession::DATA_SERVER_ROOT)) != 0)
+  if (this->GetBatchedPushes())
   {
-    controller = this->DataServerController;
+    if (controller == this->RenderServerController)
+    {
+      this->RenderServerBatchedPushes.push_back(state);
+    }
+    else
+    {
+      this->DataServerBatchedPushes.push_back(state);
+    }
+    return;
   }
-  else if ((location & (vtkPVSession::RENDER_SERVER | vtkPVSession::RENDER_SERVER_ROOT)) != 0)
+
+  vtkMultiProcessStream stream;
+  stream << static_cast<int>(vtkPVSessionServer::PUSH);
+  stream << state;
+  std::vector<unsigned char> raw_message;
+  stream.GetRawData(raw_message);
+  this->TriggerServerRMI(controller, raw_message);
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::SendBatchedPushes()
+{
+  vtkMultiProcessController* controllers[2] = { this->DataServerController,
+    this->RenderServerController };
+  std::vector<std::string>* pushes[2] = { &this->DataServerBatchedPushes,
+    &this->RenderServerBatchedPushes };
+  for (int cc = 0; cc < 2; cc++)
   {
-    controller = this->RenderServerController;
+    if (pushes[cc]->empty())
+    {
+      continue;
+    }
+    if (controllers[cc])
+    {
+      vtkMultiProcessStream stream;
+      stream << static_cast<int>(vtkPVSessionServer::PUSH_BATCH);
+      stream << static_cast<int>(pushes[cc]->size());
+      for (const std::string& state : *pushes[cc])
+      {
+        stream << state;
+      }
+      std::vector<unsigned char> raw_message;
+      stream.GetRawData(raw_message);
+      this->TriggerServerRMI(controllers[cc], raw_message);
+    }
+    pushes[cc]->clear();
   }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::PullState(vtkSMMessage* message)
+{
+  // Pushes held back must be processed before the state is pulled.
+  this->SendBatchedPushes();
+  this->StartBusyWork();
+  vtkTypeUInt32 location = this->GetRealLocation(message->location());
+  message->set_location(location);
 
+  vtkMultiProcessController* controller = this->GetPullController(location);
   if (controller)
   {
     vtkMultiProcessStream stream;
@@ -686,11 +718,11 @@ void vtkSMSessionClient::PullState(vtkSMMessage* message)
     stream << message->SerializeAsString();
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
-    controller->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
-      vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    this->TriggerServerRMI(controller, raw_message);
 
     // Get the reply
     vtkMultiProcessStream replyStream;
+    ++this->NumberOfRoundTrips;
     controller->Receive(replyStream, 1, vtkPVSessionServer::REPLY_PULL);
     std::string string;
     replyStream >> string;
@@ -704,6 +736,99 @@ void vtkSMSessionClient::PullState(vtkSMMessage* message)
   this->EndBusyWork();
 }
 
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::PullStates(const std::vector<vtkSMMessage*>& messages)
+{
+  // Pushes held back must be processed before the states are pulled.
+  this->SendBatchedPushes();
+  this->StartBusyWork();
+
+  vtkMultiProcessController* controllers[2] = { this->DataServerController,
+    this->RenderServerController };
+  std::vector<vtkSMMessage*> pulls[2];
+  for (vtkSMMessage* message : messages)
+  {
+    vtkTypeUInt32 location = this->GetRealLocation(message->location());
+    message->set_location(location);
+    vtkMultiProcessController* controller = this->GetPullController(location);
+    if (controller == nullptr)
+    {
+      this->Superclass::PullState(message);
+    }
+    else
+    {
+      pulls[controller == this->DataServerController ? 0 : 1].push_back(message);
+    }
+  }
+
+  for (int cc = 0; cc < 2; cc++)
+  {
+    if (pulls[cc].empty())
+    {
+      continue;
+    }
+    vtkMultiProcessStream stream;
+    stream << static_cast<int>(vtkPVSessionServer::PULL_BATCH);
+    stream << static_cast<int>(pulls[cc].size());
+    for (vtkSMMessage* message : pulls[cc])
+    {
+      stream << message->SerializeAsString();
+    }
+    std::vector<unsigned char> raw_message;
+    stream.GetRawData(raw_message);
+    this->TriggerServerRMI(controllers[cc], raw_message);
+
+    // Get the replies
+    ++this->NumberOfRoundTrips;
+    vtkMultiProcessStream replyStream;
+    controllers[cc]->Receive(replyStream, 1, vtkPVSessionServer::REPLY_PULL);
+    int count = 0;
+    replyStream >> count;
+    if (count != static_cast<int>(pulls[cc].size()))
+    {
+      vtkErrorMacro("Server replied to " << count << " pull requests instead of "
+                                         << pulls[cc].size() << ".");
+      continue;
+    }
+    for (vtkSMMessage* message : pulls[cc])
+    {
+      std::string string;
+      replyStream >> string;
+      message->ParseFromString(string);
+    }
+  }
+  this->EndBusyWork();
+}
+
+//----------------------------------------------------------------------------
+vtkMultiProcessController* vtkSMSessionClient::GetPullController(vtkTypeUInt32 location)
+{
+  // We make sure that only ONE location is targeted with a priority order
+  // (1) Client (2) DataServer (3) RenderServer
+  if ((location & vtkPVSession::CLIENT) != 0)
+  {
+    return nullptr;
+  }
+  else if ((location & (vtkPVSession::DATA_SERVER | vtkPVSession::DATA_SERVER_ROOT)) != 0)
+  {
+    return this->DataServerController;
+  }
+  else if ((location & (vtkPVSession::RENDER_SERVER | vtkPVSession::RENDER_SERVER_ROOT)) != 0)
+  {
+    return this->RenderServerController;
+  }
+  return nullptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::TriggerServerRMI(
+  vtkMultiProcessController* controller, std::vector<unsigned char>& raw_message)
+{
+  ++this->NumberOfMessagesSent;
+  controller->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
+    vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::ExecuteStream(
   vtkTypeUInt32 location, const vtkClientServerStream& cssstream, bool ignore_errors)
@@ -715,6 +840,7 @@ void vtkSMSessionClient::ExecuteStream(
   }
 
   location = this->GetRealLocation(location);
+  this->SendBatchedPushes();
 
   vtkMultiProcessController* controllers[2] = { nullptr, nullptr };
   int num_controllers = 0;
@@ -741,8 +867,7 @@ void vtkSMSessionClient::ExecuteStream(
 
     for (int cc = 0; cc < num_controllers; cc++)
     {
-      controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+      this->TriggerServerRMI(controllers[cc], raw_message);
       controllers[cc]->Send(
         data, static_cast<int>(size), 1, vtkPVSessionServer::EXECUTE_STREAM_TAG);
     }
@@ -757,6 +882,7 @@ void vtkSMSessionClient::ExecuteStream(
 //----------------------------------------------------------------------------
 const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 location)
 {
+  this->SendBatchedPushes();
   this->StartBusyWork();
   location = this->GetRealLocation(location);
 
@@ -783,10 +909,10 @@ const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 loc
     stream << static_cast<int>(vtkPVSessionServer::LAST_RESULT);
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
-    controller->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
-      vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    this->TriggerServerRMI(controller, raw_message);
 
     // Get the reply
+    ++this->NumberOfRoundTrips;
     int size = 0;
     controller->Receive(&size, 1, 1, vtkPVSessionServer::REPLY_LAST_RESULT);
     unsigned char* raw_data = new unsigned char[size + 1];
@@ -805,6 +931,7 @@ const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 loc
 bool vtkSMSessionClient::GatherInformation(
   vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid)
 {
+  this->SendBatchedPushes();
   this->StartBusyWork();
   if (this->RenderServerController == nullptr)
   {
@@ -857,9 +984,9 @@ bool vtkSMSessionClient::GatherInformation(
 
   if (controller)
   {
-    controller->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
-      vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    this->TriggerServerRMI(controller, raw_message);
 
+    ++this->NumberOfRoundTrips;
     int length2 = 0;
     controller->Receive(&length2, 1, 1, vtkPVSessionServer::REPLY_GATHER_INFORMATION_TAG);
     if (length2 <= 0)
@@ -907,6 +1034,7 @@ void vtkSMSessionClient::UnRegisterSIObject(vtkSMMessage* message)
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
   message->set_client_id(this->GetServerInformation()->GetClientId());
+  this->SendBatchedPushes();
 
   vtkMultiProcessController* controllers[2] = { nullptr, nullptr };
   int num_controllers = 0;
@@ -927,8 +1055,7 @@ void vtkSMSessionClient::UnRegisterSIObject(vtkSMMessage* message)
     stream.GetRawData(raw_message);
     for (int cc = 0; cc < num_controllers; cc++)
     {
-      controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+      this->TriggerServerRMI(controllers[cc], raw_message);
     }
   }
 
@@ -948,6 +1075,7 @@ void vtkSMSessionClient::RegisterSIObject(vtkSMMessage* message)
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
   message->set_client_id(this->GetServerInformation()->GetClientId());
+  this->SendBatchedPushes();
 
   vtkMultiProcessController* controllers[2] = { nullptr, nullptr };
   int num_controllers = 0;
@@ -970,8 +1098,7 @@ void vtkSMSessionClient::RegisterSIObject(vtkSMMessage* message)
     {
       if (controllers[cc] != nullptr)
       {
-        controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-          static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+        this->TriggerServerRMI(controllers[cc], raw_message);
       }
     }
   }
@@ -14,6 +14,9 @@
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 #include "vtkSMSession.h"
 
+#include <string> // needed for std::string
+#include <vector> // needed for std::vector
+
 class vtkMultiProcessController;
 class vtkPVServerInformation;
 class vtkSMCollaborationManager;
@@ -103,6 +106,7 @@ public:
    */
   void PushState(vtkSMMessage* msg) override;
   void PullState(vtkSMMessage* message) override;
+  void PullStates(const std::vector<vtkSMMessage*>& messages) override;
   void ExecuteStream(vtkTypeUInt32 location, const vtkClientServerStream& stream,
     bool ignore_errors = false) override;
   const vtkClientServerStream& GetLastResult(vtkTypeUInt32 location) override;
@@ -132,6 +136,16 @@ public:
   bool GatherInformation(
     vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid) override;
 
+  ///@{
+  /**
+   * Returns the number of messages sent to the servers since the session was
+   * created, and the number of them the client waited a reply for. Each of
+   * the latter costs a round trip over the connection.
+   */
+  vtkGetMacro(NumberOfMessagesSent, vtkIdType);
+  vtkGetMacro(NumberOfRoundTrips, vtkIdType);
+  ///@}
+
   /**
    * Returns the number of processes on the given server/s. If more than 1
    * server is identified, than it returns the maximum number of processes e.g.
@@ -239,6 +253,12 @@ protected:
    */
   vtkTypeUInt32 GetRealLocation(vtkTypeUInt32);
 
+  /**
+   * Overridden to send the pushes held back for each server as a single
+   * message.
+   */
+  void SendBatchedPushes() override;
+
   // Both maybe the same when connected to pvserver.
   vtkMultiProcessController* RenderServerController;
   vtkMultiProcessController* DataServerController;
@@ -280,6 +300,31 @@ private:
   int NotBusy;
   vtkTypeUInt32 LastGlobalID;
   vtkTypeUInt32 LastGlobalIDAvailable;
+
+  /**
+   * Sends the serialized state to the server, or holds it back while pushes
+   * are batched.
+   */
+  void PushStateToServer(vtkMultiProcessController* controller, const std::string& state);
+
+  /**
+   * Returns the controller of the server to pull the state at `location`
+   * from, or nullptr if it is pulled locally.
+   */
+  vtkMultiProcessController* GetPullController(vtkTypeUInt32 location);
+
+  /**
+   * Sends a message to the server and counts it.
+   */
+  void TriggerServerRMI(
+    vtkMultiProcessController* controller, std::vector<unsigned char>& raw_message);
+
+  vtkIdType NumberOfMessagesSent;
+  vtkIdType NumberOfRoundTrips;
+
+  // Serialized states held back for each server while pushes are batched.
+  std::vector<std::string> DataServerBatchedPushes;
+  std::vector<std::string> RenderServerBatchedPushes;
 };
 
 #endif
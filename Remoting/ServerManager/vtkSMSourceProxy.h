@@ -254,6 +254,7 @@ protected:
 
   friend class vtkSMInputProperty;
   friend class vtkSMOutputPort;
+  friend class vtkSMStateLoader;
 
   int OutputPortsCreated;
 
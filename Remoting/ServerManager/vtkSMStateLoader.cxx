@@ -2,9 +2,12 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkSMStateLoader.h"
 
+#include "vtkClientServerStream.h"
 #include "vtkClientServerStreamInstantiator.h"
+#include "vtkCommand.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVXMLElement.h"
+#include "vtkSMMessage.h"
 #include "vtkSMProperty.h"
 #include "vtkSMPropertyLink.h"
 #include "vtkSMProxyIterator.h"
@@ -20,6 +23,8 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <map>
+#include <sstream>
 #include <vector>
 
 vtkObjectFactoryNewMacro(vtkSMStateLoader);
@@ -46,10 +51,18 @@ struct vtkSMStateLoaderInternals
   typedef std::vector<ProxyCreationOrderItem> ProxyCreationOrderType;
   ProxyCreationOrderType ProxyCreationOrder;
   bool DeferProxyRegistration;
+  bool DeferPipelineInformation;
+
+  /// Numbers of output ports and required input ports of the algorithms of
+  /// source proxies, by proxy definition (group, name), in transactional mode.
+  typedef std::map<std::pair<std::string, std::string>, std::pair<unsigned int, unsigned int>>
+    AlgorithmPortsType;
+  AlgorithmPortsType AlgorithmPorts;
 
   vtkSMStateLoaderInternals()
     : KeepOriginalId(false)
     , DeferProxyRegistration(false)
+    , DeferPipelineInformation(false)
   {
   }
 };
@@ -60,6 +73,7 @@ vtkSMStateLoader::vtkSMStateLoader()
   this->Internal = new vtkSMStateLoaderInternals;
   this->ServerManagerStateElement = nullptr;
   this->KeepIdMapping = 0;
+  this->TransactionalLoad = false;
   this->ProxyLocator = vtkSMProxyLocator::New();
 }
 
@@ -209,10 +223,19 @@ void vtkSMStateLoader::CreatedNewProxy(vtkTypeUInt32 id, vtkSMProxy* proxy)
   }
 
   // Calling UpdateVTKObjects() will assign the proxy a GlobalId, if needed.
-  proxy->UpdateVTKObjects();
-  if (proxy->IsA("vtkSMSourceProxy"))
+  if (this->Internal->DeferPipelineInformation)
   {
-    vtkSMSourceProxy::SafeDownCast(proxy)->UpdatePipelineInformation();
+    this->ReuseAlgorithmPorts(proxy);
+    proxy->UpdateVTKObjects();
+    this->RecordAlgorithmPorts(proxy);
+  }
+  else
+  {
+    proxy->UpdateVTKObjects();
+    if (proxy->IsA("vtkSMSourceProxy"))
+    {
+      vtkSMSourceProxy::SafeDownCast(proxy)->UpdatePipelineInformation();
+    }
   }
   if (this->Internal->DeferProxyRegistration)
   {
@@ -317,6 +340,22 @@ vtkPVXMLElement* vtkSMStateLoader::LocateProxyElementInternal(
   }
   vtkIdType id = static_cast<vtkIdType>(id_);
 
+  // The parser uses the `id` attribute as the element id, which is looked up
+  // using a hash table. Other elements may have the same generated id, in
+  // which case all elements are checked.
+  if (vtkPVXMLElement::GetUseLookupIndices())
+  {
+    std::ostringstream idstr;
+    idstr << id_;
+    vtkPVXMLElement* element = root->FindNestedElement(idstr.str().c_str());
+    vtkIdType elementId;
+    if (element && element->GetName() && strcmp(element->GetName(), "Proxy") == 0 &&
+      element->GetScalarAttribute("id", &elementId) && elementId == id)
+    {
+      return element;
+    }
+  }
+
   unsigned int numElems = root->GetNumberOfNestedElements();
   unsigned int i = 0;
   for (i = 0; i < numElems; i++)
@@ -618,7 +657,18 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
   // present and registered.
   std::vector<vtkSmartPointer<vtkPVXMLElement>> deferredCollections;
   this->Internal->DeferProxyRegistration = true;
-  for (i = 0; i < numElems; i++)
+
+  // In transactional mode, the pushes made while creating these proxies are
+  // sent as one message per server. Updating info properties needs replies
+  // from the servers, thus is done once all of them are sent.
+  vtkSMSession* batchSession = this->TransactionalLoad ? this->GetSession() : nullptr;
+  if (batchSession)
+  {
+    batchSession->BeginBatchedPushes();
+    this->Internal->DeferPipelineInformation = true;
+  }
+  bool status = true;
+  for (i = 0; status && i < numElems; i++)
   {
     vtkPVXMLElement* currentElement = rootElement->GetNestedElement(i);
     const char* name = currentElement->GetName();
@@ -631,9 +681,34 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
       }
       else if (!this->HandleProxyCollection(currentElement))
       {
-        return 0;
+        status = false;
+      }
+    }
+  }
+  if (batchSession)
+  {
+    this->Internal->DeferPipelineInformation = false;
+    this->Internal->AlgorithmPorts.clear();
+    batchSession->EndBatchedPushes();
+  }
+  if (!status)
+  {
+    return 0;
+  }
+  if (batchSession)
+  {
+    std::vector<vtkSMSourceProxy*> sources;
+    for (const auto& item : this->Internal->ProxyCreationOrder)
+    {
+      if (auto source = vtkSMSourceProxy::SafeDownCast(item.second))
+      {
+        sources.push_back(source);
       }
     }
+    this->UpdatePipelineInformation(sources);
+
+    // The pushes made when registering the proxies are batched as well.
+    batchSession->BeginBatchedPushes();
   }
 
   // Register proxies in order they were created (as that's a good dependency
@@ -645,6 +720,10 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
     this->RegisterProxy(iter->first, iter->second);
   }
   this->Internal->ProxyCreationOrder.clear();
+  if (batchSession)
+  {
+    batchSession->EndBatchedPushes();
+  }
 
   // Now handle animation and timekeeper collections. This time, we let the
   // proxies be registered as needed.
@@ -719,6 +798,118 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
   return 1;
 }
 
+//---------------------------------------------------------------------------
+void vtkSMStateLoader::ReuseAlgorithmPorts(vtkSMProxy* proxy)
+{
+  for (unsigned int cc = 0, max = proxy->GetNumberOfSubProxies(); cc < max; ++cc)
+  {
+    this->ReuseAlgorithmPorts(proxy->GetSubProxy(cc));
+  }
+  auto source = vtkSMSourceProxy::SafeDownCast(proxy);
+  if (!source || source->NumberOfAlgorithmOutputPorts != VTK_UNSIGNED_INT_MAX ||
+    !proxy->GetXMLGroup() || !proxy->GetXMLName())
+  {
+    return;
+  }
+  auto iter = this->Internal->AlgorithmPorts.find(
+    std::make_pair(std::string(proxy->GetXMLGroup()), std::string(proxy->GetXMLName())));
+  if (iter != this->Internal->AlgorithmPorts.end())
+  {
+    source->NumberOfAlgorithmOutputPorts = iter->second.first;
+    source->NumberOfAlgorithmRequiredInputPorts = iter->second.second;
+  }
+}
+
+//---------------------------------------------------------------------------
+void vtkSMStateLoader::RecordAlgorithmPorts(vtkSMProxy* proxy)
+{
+  for (unsigned int cc = 0, max = proxy->GetNumberOfSubProxies(); cc < max; ++cc)
+  {
+    this->RecordAlgorithmPorts(proxy->GetSubProxy(cc));
+  }
+  auto source = vtkSMSourceProxy::SafeDownCast(proxy);
+  if (source && source->NumberOfAlgorithmOutputPorts != VTK_UNSIGNED_INT_MAX &&
+    source->NumberOfAlgorithmRequiredInputPorts != VTK_UNSIGNED_INT_MAX && proxy->GetXMLGroup() &&
+    proxy->GetXMLName())
+  {
+    this->Internal->AlgorithmPorts.emplace(
+      std::make_pair(std::string(proxy->GetXMLGroup()), std::string(proxy->GetXMLName())),
+      std::make_pair(
+        source->NumberOfAlgorithmOutputPorts, source->NumberOfAlgorithmRequiredInputPorts));
+  }
+}
+
+//---------------------------------------------------------------------------
+void vtkSMStateLoader::UpdatePipelineInformation(const std::vector<vtkSMSourceProxy*>& sources)
+{
+  vtkSMSession* session = this->GetSession();
+  if (!session)
+  {
+    return;
+  }
+
+  // The sources and their subproxies, each before its subproxies as in
+  // vtkSMProxy::UpdatePipelineInformation().
+  std::vector<vtkSMProxy*> proxies;
+  std::vector<vtkSMProxy*> stack(sources.rbegin(), sources.rend());
+  while (!stack.empty())
+  {
+    vtkSMProxy* proxy = stack.back();
+    stack.pop_back();
+    proxies.push_back(proxy);
+    for (unsigned int cc = proxy->GetNumberOfSubProxies(); cc > 0; --cc)
+    {
+      stack.push_back(proxy->GetSubProxy(cc - 1));
+    }
+  }
+
+  // Update the pipelines as vtkSMSourceProxy::UpdatePipelineInformation() does,
+  // with one message per location.
+  std::map<vtkTypeUInt32, vtkClientServerStream> streams;
+  for (vtkSMProxy* proxy : proxies)
+  {
+    if (proxy->IsA("vtkSMSourceProxy") && proxy->ObjectsCreated && proxy->GetLocation() != 0)
+    {
+      streams[proxy->GetLocation()] << vtkClientServerStream::Invoke << SIPROXY(proxy)
+                                    << "UpdatePipelineInformation" << vtkClientServerStream::End;
+    }
+  }
+  for (const auto& item : streams)
+  {
+    session->ExecuteStream(item.first, item.second);
+  }
+
+  // Then pull the information properties as UpdatePropertyInformation() does,
+  // with one request per server.
+  std::vector<vtkSMMessage> messages(proxies.size());
+  std::vector<vtkSMMessage*> requests;
+  std::vector<vtkSMProxy*> requesters;
+  for (size_t cc = 0; cc < proxies.size(); ++cc)
+  {
+    if (proxies[cc]->PreparePropertyInformationRequest(&messages[cc]))
+    {
+      messages[cc].set_global_id(proxies[cc]->GetGlobalID());
+      messages[cc].set_location(proxies[cc]->GetLocation());
+      requests.push_back(&messages[cc]);
+      requesters.push_back(proxies[cc]);
+    }
+  }
+  session->PullStates(requests);
+  for (size_t cc = 0; cc < requests.size(); ++cc)
+  {
+    requesters[cc]->LoadState(requests[cc], session->GetProxyLocator());
+  }
+
+  // Subproxies are notified before the proxies they belong to.
+  for (auto iter = proxies.rbegin(); iter != proxies.rend(); ++iter)
+  {
+    if ((*iter)->IsA("vtkSMSourceProxy"))
+    {
+      (*iter)->InvokeEvent(vtkCommand::UpdateInformationEvent);
+    }
+  }
+}
+
 //---------------------------------------------------------------------------
 void vtkSMStateLoader::PrintSelf(ostream& os, vtkIndent indent)
 {
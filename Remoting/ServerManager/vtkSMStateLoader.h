@@ -18,10 +18,12 @@
 
 #include <map>    // needed for API
 #include <string> // needed for API
+#include <vector> // needed for API
 
 class vtkPVXMLElement;
 class vtkSMProxy;
 class vtkSMProxyLocator;
+class vtkSMSourceProxy;
 
 struct vtkSMStateLoaderInternals;
 
@@ -56,6 +58,22 @@ public:
   vtkBooleanMacro(KeepIdMapping, int);
   ///@}
 
+  ///@{
+  /**
+   * When set, the proxies are created and their properties pushed as a batch,
+   * sent as a single message per server (see
+   * vtkSMSession::BeginBatchedPushes()), instead of a message per push. This
+   * is much faster over high-latency connections. The info
+   * properties of the sources are then updated once all proxies are created,
+   * before the proxies are registered, using a single request per server.
+   * From Python, use `servermanager.LoadState(filename, transactional=True)`.
+   * Default is false.
+   */
+  vtkSetMacro(TransactionalLoad, bool);
+  vtkGetMacro(TransactionalLoad, bool);
+  vtkBooleanMacro(TransactionalLoad, bool);
+  ///@}
+
   ///@{
   /**
    * Return an array of ids. The ids are stored in the following order
@@ -85,6 +103,8 @@ protected:
    * true). It also called vtkSMProxy::UpdateVTKObjects() and
    * vtkSMProxy::UpdatePipelineInformation() (if applicable) to ensure that the
    * state loaded on the proxy is "pushed" and any info properties updated.
+   * In transactional mode, info properties are updated by LoadStateInternal()
+   * instead, once the batched pushes are sent.
    * We also create a list to track the order in which proxies are created.
    * This order is a dependency order too and hence helps us register proxies in
    * order of dependencies.
@@ -150,9 +170,32 @@ protected:
    */
   vtkSMProxy* LocateExistingProxyUsingRegistrationName(vtkTypeUInt32 id);
 
+  ///@{
+  /**
+   * Used in transactional mode. The numbers of output ports and of required
+   * input ports of the algorithm of a source proxy are gathered once when its
+   * VTK objects are created and depend on the algorithm class only. They are
+   * thus gathered from the servers for the first proxy of each definition, and
+   * reused for the other proxies, subproxies included, which avoids a round
+   * trip for each source.
+   */
+  void ReuseAlgorithmPorts(vtkSMProxy* proxy);
+  void RecordAlgorithmPorts(vtkSMProxy* proxy);
+  ///@}
+
+  /**
+   * Used in transactional mode instead of calling
+   * vtkSMSourceProxy::UpdatePipelineInformation() on each source. The
+   * pipelines of the sources and of their subproxies are updated using a
+   * single message per location, and their information properties are pulled
+   * using a single request per server.
+   */
+  void UpdatePipelineInformation(const std::vector<vtkSMSourceProxy*>& sources);
+
   vtkPVXMLElement* ServerManagerStateElement;
   vtkSMProxyLocator* ProxyLocator;
   int KeepIdMapping;
+  bool TransactionalLoad;
 
 private:
   vtkSMStateLoader(const vtkSMStateLoader&) = delete;
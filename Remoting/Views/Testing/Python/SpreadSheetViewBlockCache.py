@@ -0,0 +1,49 @@
+from paraview.simple import *
+from paraview import smtesting
+smtesting.ProcessCommandLineArguments()
+
+# 50 points, i.e. 7 blocks of 8 rows.
+sphere = Sphere()
+view = CreateView("SpreadSheetView")
+view.BlockSize = 8
+Show(sphere, view)
+Render(view)
+
+pvview = view.GetClientSideObject()
+assert pvview.GetNumberOfRows() == 50
+pvview.ClearCache()
+pvview.ResetCacheStatistics()
+
+# rows not fetched yet are misses. The visible rows are fetched first and the
+# next block down is prefetched separately.
+assert not pvview.IsAvailable(16)
+assert pvview.IsFetchNeeded(16, 23)
+assert pvview.FetchRows(16, 23) == 1
+assert pvview.IsFetchNeeded(16, 23)
+assert pvview.PrefetchRows(16, 23) == 1
+assert not pvview.IsFetchNeeded(16, 23)
+assert pvview.IsAvailable(16) and pvview.IsAvailable(24) and not pvview.IsAvailable(32)
+assert pvview.GetNumberOfCacheMisses() == 2
+assert pvview.GetNumberOfCacheHits() == 1
+assert pvview.GetNumberOfFetchedBlocks() == 2
+assert pvview.GetAverageFetchTime() <= pvview.GetMaximumFetchTime()
+
+# scrolling down within the cache prefetches the following block.
+assert pvview.IsFetchNeeded(24, 31)
+assert pvview.FetchRows(24, 31) == 0
+assert pvview.PrefetchRows(24, 31) == 1
+assert pvview.IsAvailable(32)
+assert not pvview.IsFetchNeeded(24, 31)
+
+# scrolling up prefetches the blocks above.
+assert pvview.FetchRows(8, 15) == 1
+assert pvview.PrefetchRows(8, 15) == 1
+assert pvview.IsAvailable(0)
+assert pvview.GetNumberOfCacheMisses() == 3
+assert pvview.GetNumberOfCacheHits() == 2
+
+# an empty budget keeps only the last block fetched and disables prefetching.
+view.CacheSize = 0
+assert pvview.FetchRows(40, 47) == 1
+assert pvview.PrefetchRows(40, 47) == 0
+assert pvview.IsAvailable(40) and not pvview.IsAvailable(8)
@@ -167,6 +167,7 @@ public:
   void SetNonlinearSubdivisionLevel(int);
   void SetMatchBoundariesIgnoringCellOrder(int);
   virtual void SetGenerateFeatureEdges(bool);
+  void SetCacheSurfaces(bool);
 
   //***************************************************************************
   // Forwarded to vtkProperty.
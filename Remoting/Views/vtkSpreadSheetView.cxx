@@ -19,6 +19,7 @@
 #include "vtkMemberFunctionCommand.h"
 #include "vtkMultiProcessController.h"
 #include "vtkMultiProcessStream.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVLogger.h"
 #include "vtkPVMergeTables.h"
@@ -37,6 +38,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <map>
 #include <set>
 #include <string>
@@ -226,11 +228,15 @@ class vtkSpreadSheetView::vtkInternals
   public:
     vtkSmartPointer<vtkTable> Dataobject;
     vtkTimeStamp RecentUseTime;
+    unsigned long MemorySize;
+    bool Used;
 
     CacheInfo()
     {
       this->Dataobject = nullptr;
       this->RecentUseTime = vtkTimeStamp();
+      this->MemorySize = 0;
+      this->Used = false;
     }
   };
 
@@ -246,6 +252,9 @@ public:
       this->PreviousFirstCachedBlock = *this->CachedBlocks.begin();
     }
     this->CachedBlocks.clear();
+    this->CacheMemorySize = 0;
+    this->LastBlockMemorySize = 0;
+    this->MissedBlocks.clear();
     this->ColumnMetaData.clear();
     this->ColumnIndexMap.clear();
   }
@@ -366,29 +375,20 @@ public:
     return a1Index > a2Index;
   }
 
-  vtkTable* AddToCache(vtkIdType blockId, vtkTable* data, vtkIdType max)
+  /**
+   * Adds a block to the cache then releases the least recently used blocks
+   * until the cache fits in `maxSize` (in KiBs). The added block is always
+   * kept.
+   */
+  vtkTable* AddToCache(vtkIdType blockId, vtkTable* data, unsigned long maxSize)
   {
     CacheType::iterator iter = this->CachedBlocks.find(blockId);
     if (iter != this->CachedBlocks.end())
     {
+      this->CacheMemorySize -= iter->second.MemorySize;
       this->CachedBlocks.erase(iter);
     }
 
-    if (static_cast<vtkIdType>(this->CachedBlocks.size()) == max)
-    {
-      // remove least-recent-used block.
-      iter = this->CachedBlocks.begin();
-      CacheType::iterator iterToRemove = this->CachedBlocks.begin();
-      for (; iter != this->CachedBlocks.end(); ++iter)
-      {
-        if (iterToRemove->second.RecentUseTime > iter->second.RecentUseTime)
-        {
-          iterToRemove = iter;
-        }
-      }
-      this->CachedBlocks.erase(iterToRemove);
-    }
-
     CacheInfo info;
     vtkTable* clone = vtkTable::New();
 
@@ -419,8 +419,30 @@ public:
     info.Dataobject = clone;
     clone->FastDelete();
     info.RecentUseTime.Modified();
+    info.MemorySize = clone->GetActualMemorySize();
+    // a block that was missed already counted in the statistics.
+    info.Used = this->MissedBlocks.erase(blockId) > 0;
     this->CachedBlocks[blockId] = info;
+    this->CacheMemorySize += info.MemorySize;
+    this->LastBlockMemorySize = info.MemorySize;
     this->MostRecentlyAccessedBlock = blockId;
+
+    while (this->CacheMemorySize > maxSize && this->CachedBlocks.size() > 1)
+    {
+      // remove least-recent-used block.
+      CacheType::iterator iterToRemove = this->CachedBlocks.end();
+      for (iter = this->CachedBlocks.begin(); iter != this->CachedBlocks.end(); ++iter)
+      {
+        if (iter->first != blockId &&
+          (iterToRemove == this->CachedBlocks.end() ||
+            iterToRemove->second.RecentUseTime > iter->second.RecentUseTime))
+        {
+          iterToRemove = iter;
+        }
+      }
+      this->CacheMemorySize -= iterToRemove->second.MemorySize;
+      this->CachedBlocks.erase(iterToRemove);
+    }
     if (this->CachedBlocks.size() == 1)
     {
       this->UpdateColumnMetaData(clone);
@@ -474,17 +496,179 @@ public:
     }
   }
 
+  /**
+   * Counts a hit the first time a cached block is used, or a miss the first
+   * time a block is used before being fetched.
+   */
+  void CountAccess(vtkIdType blockId)
+  {
+    CacheType::iterator iter = this->CachedBlocks.find(blockId);
+    if (iter != this->CachedBlocks.end())
+    {
+      if (!iter->second.Used)
+      {
+        iter->second.Used = true;
+        ++this->NumberOfCacheHits;
+      }
+    }
+    else if (this->MissedBlocks.insert(blockId).second)
+    {
+      ++this->NumberOfCacheMisses;
+    }
+  }
+
+  void AddFetchTime(double time)
+  {
+    ++this->NumberOfFetchedBlocks;
+    this->TotalFetchTime += time;
+    this->MaximumFetchTime = std::max(this->MaximumFetchTime, time);
+  }
+
+  /**
+   * Returns 1 if the rows starting at `first` are below the previously
+   * fetched ones, -1 if they are above, or the previous direction otherwise.
+   */
+  int GetScrollDirection(vtkIdType first) const
+  {
+    if (this->FetchedRows[0] >= 0 && first != this->FetchedRows[0])
+    {
+      return first > this->FetchedRows[0] ? 1 : -1;
+    }
+    return this->ScrollDirection;
+  }
+
+  /**
+   * Collects the blocks for the rows in [first, last] that are not cached and
+   * the blocks to prefetch past them in the scroll direction. A block is
+   * prefetched only if the cache is expected to fit in `maxSize` (in KiBs)
+   * afterwards, assuming it is as large as the last block fetched.
+   */
+  void GetBlocksToFetch(vtkSpreadSheetView* self, vtkIdType first, vtkIdType last,
+    unsigned long maxSize, std::vector<vtkIdType>& blocks, std::vector<vtkIdType>& prefetch)
+  {
+    const vtkIdType blockSize = self->TableStreamer->GetBlockSize();
+    const vtkIdType numRows = self->GetNumberOfRows();
+    first = std::max<vtkIdType>(first, 0);
+    last = std::min<vtkIdType>(last, numRows - 1);
+    if (blockSize <= 0 || first > last)
+    {
+      return;
+    }
+
+    const vtkIdType firstBlock = first / blockSize;
+    const vtkIdType lastBlock = last / blockSize;
+    const vtkIdType maxBlock = (numRows - 1) / blockSize;
+    for (vtkIdType block = firstBlock; block <= lastBlock; ++block)
+    {
+      if (this->CachedBlocks.find(block) == this->CachedBlocks.end())
+      {
+        blocks.push_back(block);
+      }
+    }
+
+    const int direction = this->GetScrollDirection(first);
+    unsigned long expectedSize = this->CacheMemorySize + blocks.size() * this->LastBlockMemorySize;
+    for (int cc = 1; cc <= self->NumberOfPrefetchBlocks; ++cc)
+    {
+      const vtkIdType block = direction > 0 ? lastBlock + cc : firstBlock - cc;
+      if (block < 0 || block > maxBlock)
+      {
+        break;
+      }
+      if (this->CachedBlocks.find(block) != this->CachedBlocks.end())
+      {
+        continue;
+      }
+      expectedSize += this->LastBlockMemorySize;
+      if (expectedSize > maxSize)
+      {
+        break;
+      }
+      prefetch.push_back(block);
+    }
+  }
+
+  /**
+   * Passes the hidden columns down to the streamer so that they are neither
+   * extracted nor delivered. Internal columns and columns with a user-friendly
+   * label, such as the ids needed for selections, are always delivered.
+   * Returns true if the columns left out changed.
+   */
+  bool UpdateColumnsToSkip(vtkSpreadSheetView* self)
+  {
+    auto canSkip = [self](const std::string& name) {
+      bool converted = false;
+      ::get_userfriendly_name(name.c_str(), self, &converted);
+      return !converted && !self->IsColumnInternal(name.c_str());
+    };
+    std::set<std::string> names, labels;
+    std::copy_if(this->HiddenColumnsByName.begin(), this->HiddenColumnsByName.end(),
+      std::inserter(names, names.end()), canSkip);
+    std::copy_if(this->HiddenColumnsByLabel.begin(), this->HiddenColumnsByLabel.end(),
+      std::inserter(labels, labels.end()), canSkip);
+    if (names == this->SkippedColumnNames && labels == this->SkippedColumnLabels)
+    {
+      return false;
+    }
+
+    // a label is the name of the array the column is a component of, if any.
+    self->TableStreamer->RemoveAllColumnsToSkip();
+    for (const auto& name : names)
+    {
+      self->TableStreamer->AddColumnToSkip(name.c_str());
+    }
+    for (const auto& label : labels)
+    {
+      self->TableStreamer->AddArrayToSkip(label.c_str());
+    }
+    this->SkippedColumnNames = std::move(names);
+    this->SkippedColumnLabels = std::move(labels);
+    return true;
+  }
+
+  void ResetStatistics()
+  {
+    this->NumberOfCacheHits = 0;
+    this->NumberOfCacheMisses = 0;
+    this->NumberOfFetchedBlocks = 0;
+    this->TotalFetchTime = 0.0;
+    this->MaximumFetchTime = 0.0;
+  }
+
   vtkIdType MostRecentlyAccessedBlock;
   vtkWeakPointer<vtkSpreadSheetRepresentation> ActiveRepresentation;
   vtkCommand* Observer;
 
   std::set<std::string> HiddenColumnsByName;
   std::set<std::string> HiddenColumnsByLabel;
+  std::set<std::string> SkippedColumnNames;
+  std::set<std::string> SkippedColumnLabels;
 
   std::vector<std::string> OrderedColumnList;
   bool OrderColumnsByList = false;
+
+  unsigned long CacheMemorySize = 0;
+  unsigned long LastBlockMemorySize = 0;
+  std::set<vtkIdType> MissedBlocks;
+  vtkIdType FetchedRows[2] = { -1, -1 };
+  int ScrollDirection = 1;
+
+  vtkIdType NumberOfCacheHits = 0;
+  vtkIdType NumberOfCacheMisses = 0;
+  vtkIdType NumberOfFetchedBlocks = 0;
+  double TotalFetchTime = 0.0;
+  double MaximumFetchTime = 0.0;
 };
 
+namespace
+{
+// Converts the cache size in MBs to the KiBs reported by GetActualMemorySize.
+unsigned long GetCacheSizeInKiB(double cacheSize)
+{
+  return static_cast<unsigned long>(cacheSize * 1024.0);
+}
+}
+
 namespace
 {
 void FetchRMI(void* localArg, void* remoteArg, int remoteArgLength, int)
@@ -765,6 +949,14 @@ void vtkSpreadSheetView::ClearOrderedColumnList()
 void vtkSpreadSheetView::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "CacheSize: " << this->CacheSize << endl;
+  os << indent << "NumberOfPrefetchBlocks: " << this->NumberOfPrefetchBlocks << endl;
+  os << indent << "CacheMemorySize: " << this->GetCacheMemorySize() << endl;
+  os << indent << "NumberOfCacheHits: " << this->GetNumberOfCacheHits() << endl;
+  os << indent << "NumberOfCacheMisses: " << this->GetNumberOfCacheMisses() << endl;
+  os << indent << "NumberOfFetchedBlocks: " << this->GetNumberOfFetchedBlocks() << endl;
+  os << indent << "AverageFetchTime: " << this->GetAverageFetchTime() << endl;
+  os << indent << "MaximumFetchTime: " << this->GetMaximumFetchTime() << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -841,12 +1033,13 @@ void vtkSpreadSheetView::Update()
     vtkSmartPointer<vtkTable> table = previousFirstCachedBlock.second.Dataobject;
     if (table)
     {
-      this->Internals->AddToCache(previousFirstCachedBlock.first, table, 10);
+      this->Internals->AddToCache(
+        previousFirstCachedBlock.first, table, ::GetCacheSizeInKiB(this->CacheSize));
     }
     else // Add an empty block to the cache.
     {
       table = vtkSmartPointer<vtkTable>::New();
-      this->Internals->AddToCache(0, table, 10);
+      this->Internals->AddToCache(0, table, ::GetCacheSizeInKiB(this->CacheSize));
     }
   }
 
@@ -901,6 +1094,13 @@ int vtkSpreadSheetView::StreamToClient()
 
   this->AllReduce(num_rows, num_rows, vtkCommunicator::SUM_OP);
 
+  // hidden columns are not delivered, hence blocks are fetched again when
+  // they change.
+  if (this->Internals->UpdateColumnsToSkip(this))
+  {
+    this->SomethingUpdated = true;
+  }
+
   if (this->NumberOfRows != static_cast<vtkIdType>(num_rows))
   {
     this->SomethingUpdated = true;
@@ -924,18 +1124,74 @@ void vtkSpreadSheetView::OnRepresentationUpdated()
 //----------------------------------------------------------------------------
 vtkTable* vtkSpreadSheetView::FetchBlock(vtkIdType blockindex)
 {
+  this->Internals->CountAccess(blockindex);
   vtkTable* block = this->Internals->GetDataObject(blockindex);
   if (!block)
   {
-    block = this->FetchBlockCallback(blockindex);
-    // use the block returned from the AddToCache since that is cleaned up
-    // to have columns in correct order.
-    block = this->Internals->AddToCache(blockindex, block, 10);
-    this->InvokeEvent(vtkCommand::UpdateEvent, &blockindex);
+    block = this->FetchAndCacheBlock(blockindex);
   }
   return block;
 }
 
+//----------------------------------------------------------------------------
+vtkTable* vtkSpreadSheetView::FetchAndCacheBlock(vtkIdType blockindex)
+{
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  vtkTable* block = this->FetchBlockCallback(blockindex);
+  timer->StopTimer();
+  this->Internals->AddFetchTime(timer->GetElapsedTime());
+
+  // use the block returned from the AddToCache since that is cleaned up
+  // to have columns in correct order.
+  block = this->Internals->AddToCache(blockindex, block, ::GetCacheSizeInKiB(this->CacheSize));
+  this->InvokeEvent(vtkCommand::UpdateEvent, &blockindex);
+  return block;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkSpreadSheetView::FetchRows(vtkIdType first, vtkIdType last)
+{
+  std::vector<vtkIdType> blocks, prefetch;
+  this->Internals->GetBlocksToFetch(
+    this, first, last, ::GetCacheSizeInKiB(this->CacheSize), blocks, prefetch);
+  this->Internals->ScrollDirection = this->Internals->GetScrollDirection(first);
+  this->Internals->FetchedRows[0] = first;
+  this->Internals->FetchedRows[1] = last;
+
+  for (vtkIdType block : blocks)
+  {
+    this->FetchBlock(block);
+  }
+  return static_cast<vtkIdType>(blocks.size());
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkSpreadSheetView::PrefetchRows(vtkIdType first, vtkIdType last)
+{
+  std::vector<vtkIdType> blocks, prefetch;
+  this->Internals->GetBlocksToFetch(
+    this, first, last, ::GetCacheSizeInKiB(this->CacheSize), blocks, prefetch);
+  this->Internals->ScrollDirection = this->Internals->GetScrollDirection(first);
+  this->Internals->FetchedRows[0] = first;
+  this->Internals->FetchedRows[1] = last;
+
+  for (vtkIdType block : prefetch)
+  {
+    this->FetchAndCacheBlock(block);
+  }
+  return static_cast<vtkIdType>(prefetch.size());
+}
+
+//----------------------------------------------------------------------------
+bool vtkSpreadSheetView::IsFetchNeeded(vtkIdType first, vtkIdType last)
+{
+  std::vector<vtkIdType> blocks, prefetch;
+  this->Internals->GetBlocksToFetch(
+    this, first, last, ::GetCacheSizeInKiB(this->CacheSize), blocks, prefetch);
+  return !blocks.empty() || !prefetch.empty();
+}
+
 //----------------------------------------------------------------------------
 vtkTable* vtkSpreadSheetView::FetchBlockCallback(vtkIdType blockindex)
 {
@@ -1057,6 +1313,7 @@ bool vtkSpreadSheetView::IsAvailable(vtkIdType row)
 {
   vtkIdType blockSize = this->TableStreamer->GetBlockSize();
   vtkIdType blockIndex = row / blockSize;
+  this->Internals->CountAccess(blockIndex);
   return this->Internals->GetDataObject(blockIndex) != nullptr;
 }
 
@@ -1159,3 +1416,53 @@ void vtkSpreadSheetView::SetBlockSize(vtkIdType val)
   this->TableStreamer->SetBlockSize(val);
   this->ClearCache();
 }
+
+//----------------------------------------------------------------------------
+vtkIdType vtkSpreadSheetView::GetNumberOfCacheHits()
+{
+  return this->Internals->NumberOfCacheHits;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkSpreadSheetView::GetNumberOfCacheMisses()
+{
+  return this->Internals->NumberOfCacheMisses;
+}
+
+//----------------------------------------------------------------------------
+double vtkSpreadSheetView::GetCacheHitRate()
+{
+  const vtkIdType count = this->Internals->NumberOfCacheHits + this->Internals->NumberOfCacheMisses;
+  return count > 0 ? static_cast<double>(this->Internals->NumberOfCacheHits) / count : 0.0;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkSpreadSheetView::GetNumberOfFetchedBlocks()
+{
+  return this->Internals->NumberOfFetchedBlocks;
+}
+
+//----------------------------------------------------------------------------
+double vtkSpreadSheetView::GetAverageFetchTime()
+{
+  const vtkIdType count = this->Internals->NumberOfFetchedBlocks;
+  return count > 0 ? this->Internals->TotalFetchTime / count : 0.0;
+}
+
+//----------------------------------------------------------------------------
+double vtkSpreadSheetView::GetMaximumFetchTime()
+{
+  return this->Internals->MaximumFetchTime;
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkSpreadSheetView::GetCacheMemorySize()
+{
+  return this->Internals->CacheMemorySize;
+}
+
+//----------------------------------------------------------------------------
+void vtkSpreadSheetView::ResetCacheStatistics()
+{
+  this->Internals->ResetStatistics();
+}
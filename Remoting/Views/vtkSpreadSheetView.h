@@ -206,6 +206,70 @@ public:
    */
   virtual bool IsDataValid(vtkIdType row, vtkIdType col);
 
+  /**
+   * Fetches the blocks for the rows in the range [first, last] that are not
+   * available locally. Returns the number of blocks fetched.
+   * \note CallOnClient
+   */
+  virtual vtkIdType FetchRows(vtkIdType first, vtkIdType last);
+
+  /**
+   * Prefetches up to `NumberOfPrefetchBlocks` blocks past the rows in the
+   * range [first, last], in the direction the range moved in since the
+   * previous call to `FetchRows` or `PrefetchRows`, as long as they are
+   * expected to fit in the cache. This is meant to be called once the rows
+   * fetched by `FetchRows` are shown. Returns the number of blocks fetched.
+   * \note CallOnClient
+   */
+  virtual vtkIdType PrefetchRows(vtkIdType first, vtkIdType last);
+
+  /**
+   * Returns true if `FetchRows(first, last)` or `PrefetchRows(first, last)`
+   * would fetch any block.
+   * \note CallOnClient
+   */
+  virtual bool IsFetchNeeded(vtkIdType first, vtkIdType last);
+
+  ///@{
+  /**
+   * Get/Set the maximum size of the blocks cached on the client, in MBs.
+   * The least recently used blocks are released when the cache gets larger,
+   * the block being fetched is always kept. Default is 100.
+   * \note CallOnClient
+   */
+  vtkSetClampMacro(CacheSize, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(CacheSize, double);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the number of blocks `FetchRows` prefetches in the scroll
+   * direction. 0 disables prefetching. Default is 1.
+   * \note CallOnClient
+   */
+  vtkSetClampMacro(NumberOfPrefetchBlocks, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfPrefetchBlocks, int);
+  ///@}
+
+  ///@{
+  /**
+   * Statistics of the client block cache, to tune `BlockSize` and
+   * `CacheSize` for a given connection. A block counts as one hit the first
+   * time it is used while cached, e.g. after it was prefetched, or as one miss
+   * if it is used before being fetched. Fetch times include prefetches and are
+   * in seconds. `GetCacheMemorySize` returns the size of the cache in KiBs.
+   * \note CallOnClient
+   */
+  vtkIdType GetNumberOfCacheHits();
+  vtkIdType GetNumberOfCacheMisses();
+  double GetCacheHitRate();
+  vtkIdType GetNumberOfFetchedBlocks();
+  double GetAverageFetchTime();
+  double GetMaximumFetchTime();
+  unsigned long GetCacheMemorySize();
+  void ResetCacheStatistics();
+  ///@}
+
   //***************************************************************************
   // Forwarded to vtkSortedTableStreamer.
   /**
@@ -257,9 +321,17 @@ protected:
 
   virtual vtkTable* FetchBlock(vtkIdType blockindex);
 
+  /**
+   * Fetches the block from the server and adds it to the cache, without
+   * counting a cache miss.
+   */
+  vtkTable* FetchAndCacheBlock(vtkIdType blockindex);
+
   bool ShowExtractedSelection = false;
   bool GenerateCellConnectivity = false;
   bool ShowFieldData = false;
+  double CacheSize = 100.0;
+  int NumberOfPrefetchBlocks = 1;
   vtkSortedTableStreamer* TableStreamer;
   vtkMarkSelectedRows* TableSelectionMarker;
   vtkReductionFilter* ReductionFilter;
@@ -47,8 +47,11 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cmath>
 #include <cstdlib>
 #include <algorithm>
+#include <atomic>
 
 #include "CosmoHaloFinder.h"
+#include "ChainingMesh.h"
+#include "ParallelRanges.h"
 
 
 
@@ -63,6 +66,7 @@ CosmoHaloFinder::CosmoHaloFinder()
 {
 
   nmin = 1;
+  numThreads = 1;
 }
 
 /****************************************************************************/
@@ -290,6 +294,13 @@ void CosmoHaloFinder::Writing()
 /****************************************************************************/
 void CosmoHaloFinder::Finding()
 {
+  // The neighbor count of Merge() depends on the order of the merges, so
+  // only plain friends-of-friends is done in parallel
+  if (numThreads > 1 && nmin < 2 && !periodic) {
+    ParallelFOF();
+    return;
+  }
+
   //
   // REORDER particles based on spatial locality
   //
@@ -622,4 +633,125 @@ void CosmoHaloFinder::Merge(
   return;
 }
 
+/****************************************************************************/
+namespace {
+
+// Root of the halo of particle p, halving the path on the way
+int findRoot(vector<std::atomic<int> >& parent, int p)
+{
+  while (true) {
+    int q = parent[p].load();
+    if (q == p)
+      return p;
+    int r = parent[q].load();
+    if (r != q)
+      parent[p].compare_exchange_weak(q, r);
+    p = r;
+  }
+}
+
+// Unite the halos of particles p and q, the lowest root becoming the root
+void uniteHalos(vector<std::atomic<int> >& parent, int p, int q)
+{
+  while (true) {
+    p = findRoot(parent, p);
+    q = findRoot(parent, q);
+    if (p == q)
+      return;
+    if (p < q)
+      std::swap(p, q);
+    int expected = p;
+    if (parent[p].compare_exchange_strong(expected, q))
+      return;
+  }
+}
+}
+
+/****************************************************************************/
+void CosmoHaloFinder::ParallelFOF()
+{
+  POSVEL_T minLoc[numDataDims], maxLoc[numDataDims];
+  for (int dim = 0; dim < numDataDims; dim++) {
+    minLoc[dim] = maxLoc[dim] = data[dim][0];
+    for (int i = 1; i < npart; i++) {
+      minLoc[dim] = min(minLoc[dim], data[dim][i]);
+      maxLoc[dim] = max(maxLoc[dim], data[dim][i]);
+    }
+  }
+
+  // Buckets must be at least as large as the linking length, and are
+  // made larger when that would create more buckets than particles
+  POSVEL_T chainSize = bb;
+  while (true) {
+    double numBuckets = 1.0;
+    for (int dim = 0; dim < numDataDims; dim++)
+      numBuckets *= (int)((maxLoc[dim] - minLoc[dim]) / chainSize) + 1;
+    if (numBuckets <= max(npart, 1))
+      break;
+    chainSize *= 2;
+  }
+
+  ChainingMesh mesh(minLoc, maxLoc, chainSize, npart,
+                    data[dataX], data[dataY], data[dataZ]);
+  int* meshSize = mesh.getMeshSize();
+  int*** buckets = mesh.getBuckets();
+  int* bucketList = mesh.getBucketList();
+
+  vector<std::atomic<int> > parent(npart);
+  for (int i = 0; i < npart; i++)
+    parent[i].store(i);
+
+  //
+  // UNITE the halos of all friends, each thread taking rows of buckets
+  //
+  parallelRanges((long)meshSize[0] * meshSize[1], numThreads,
+                 [&](long begin, long end) {
+    for (long row = begin; row < end; row++) {
+      int bi = (int)(row / meshSize[1]);
+      int bj = (int)(row % meshSize[1]);
+      for (int bk = 0; bk < meshSize[2]; bk++) {
+        for (int ii = buckets[bi][bj][bk]; ii != -1; ii = bucketList[ii]) {
+
+          // Friends are in this bucket or in neighboring ones
+          for (int i = max(bi - 1, 0); i <= min(bi + 1, meshSize[0] - 1); i++)
+          for (int j = max(bj - 1, 0); j <= min(bj + 1, meshSize[1] - 1); j++)
+          for (int k = max(bk - 1, 0); k <= min(bk + 1, meshSize[2] - 1); k++)
+          for (int jj = buckets[i][j][k]; jj != -1; jj = bucketList[jj]) {
+
+            // Each pair is only looked at once
+            if (jj <= ii)
+              continue;
+
+            // Same metric as Merge()
+            POSVEL_T xdist = fabs(data[dataX][jj] - data[dataX][ii]);
+            POSVEL_T ydist = fabs(data[dataY][jj] - data[dataY][ii]);
+            POSVEL_T zdist = fabs(data[dataZ][jj] - data[dataZ][ii]);
+
+            if ((xdist<bb) && (ydist<bb) && (zdist<bb)) {
+              POSVEL_T dist = xdist*xdist + ydist*ydist + zdist*zdist;
+              if (dist < bb*bb)
+                uniteHalos(parent, ii, jj);
+            }
+          }
+        }
+      }
+    }
+  });
+
+  //
+  // BUILD the halo tags and chains, as expected from myFOF()
+  //
+  parallelRanges(npart, numThreads, [&](long begin, long end) {
+    for (long i = begin; i < end; i++)
+      ht[i] = findRoot(parent, (int)i);
+  });
+
+  for (int i = 0; i < npart; i++)
+    halo[i] = -1;
+  for (int i = npart - 1; i >= 0; i--) {
+    nextp[i] = halo[ht[i]];
+    halo[ht[i]] = i;
+  }
+}
+
 } // END namespace cosmotk
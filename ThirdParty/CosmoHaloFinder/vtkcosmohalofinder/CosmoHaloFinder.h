@@ -102,6 +102,15 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // particle is constantly altered so that each particle knows what halo it
 // is part of, and that halo tag is the id of the lowest particle in the halo.
 //
+// When more than one thread is requested, the minimum number of neighbors
+// is one and the box is not periodic, ParallelFOF() is used instead.  It
+// assigns particles to a ChainingMesh with buckets at least as large as the
+// linking length, so that friends are in the same or neighboring buckets,
+// and threads unite the halos of friends in a shared union-find structure.
+// The root of a halo is always its lowest particle so the halo tags are the
+// same as the ones of myFOF(), and the chain of each halo is built in
+// increasing particle order.
+//
 
 #ifndef CosmoHaloFinder_h
 #define CosmoHaloFinder_h
@@ -176,6 +185,7 @@ public:
 
   void setNumberOfParticles(int n)      { npart = n; }
   void setMyProc(int r)                 { myProc = r; }
+  void setNumberOfThreads(int n)        { numThreads = n; }
 
   // For standalone serial halo finder
   POSVEL_T* getXLoc()                   { return xx; }
@@ -207,6 +217,7 @@ private:
   // internal state
   int npart, nhalo, nhalopart;
   int myProc;
+  int numThreads;
 
   // data[][] stores xx[], yy[], zz[].
   POSVEL_T *data[numDataDims];
@@ -232,6 +243,9 @@ private:
   // Recurses through the k-d tree merging particles to create halos
   void myFOF(int, int, int);
   void Merge(int, int, int, int, int);
+
+  // Finds halos with a multithreaded union-find over a chaining mesh
+  void ParallelFOF();
 };
 
 } // END cosmotk namespace
@@ -107,6 +107,9 @@ public:
                                 // which define a single halo
         int nmin = 1);          // The minimum number of neighbors for linking
 
+  // Number of threads used by the serial halo finder on this processor
+  void setNumberOfThreads(int n)        { this->haloFinder.setNumberOfThreads(n); }
+
   // Execute the serial halo finder for this processor
   void executeHaloFinder();
 
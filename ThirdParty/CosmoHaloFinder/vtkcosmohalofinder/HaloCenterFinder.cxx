@@ -49,9 +49,13 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <set>
 #include <math.h>
 #include <assert.h>
+#include <algorithm>
+#include <vector>
 
 #include "Partition.h"
 #include "HaloCenterFinder.h"
+#include "BHTree.h"
+#include "ParallelRanges.h"
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -60,6 +64,16 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 using namespace std;
 
 namespace cosmotk {
+
+namespace {
+// Opening angle of the Barnes Hut potential estimate.  Must be less than
+// 1/sqrt(3) so that a particle is never estimated against its own node.
+const POSVEL_T BH_OPENING_ANGLE = 0.5;
+
+// Number of particles with the lowest estimated potential which get their
+// actual potential calculated
+const long BH_CANDIDATES = 64;
+}
 /////////////////////////////////////////////////////////////////////////
 //
 // HaloCenterFinder takes all particles in a halo and calculations the
@@ -926,6 +940,135 @@ int HaloCenterFinder::mostBoundParticleAStar(POTENTIAL_T* minimumPotential)
   return result;
 }
 
+/////////////////////////////////////////////////////////////////////////
+//
+// Most bound particle using a Barnes Hut tree of the particles in one FOF
+// halo.  The potential of every particle is estimated by walking the tree,
+// using the mass and center of mass of nodes that are far enough from the
+// particle.  The actual potential is then calculated for the particles
+// with the lowest estimates, and the minimum of these is returned.
+//
+// Both passes are split over numThreads threads so that the few very large
+// halos which dominate the cost of center finding use all cores.
+//
+/////////////////////////////////////////////////////////////////////////
+
+int HaloCenterFinder::mostBoundParticleBHTree(
+                        POTENTIAL_T* minimumPotential,
+                        int numThreads)
+{
+  POSVEL_T rsm2 = this->rSmooth*this->rSmooth;
+
+  // Find the bounding box and the average mass of the halo
+  POSVEL_T minLoc[DIMENSION];
+  POSVEL_T maxLoc[DIMENSION];
+  minLoc[0] = maxLoc[0] = this->xx[0];
+  minLoc[1] = maxLoc[1] = this->yy[0];
+  minLoc[2] = maxLoc[2] = this->zz[0];
+  double totalMass = 0.0;
+  for (int p = 0; p < this->particleCount; p++) {
+    if (minLoc[0] > this->xx[p]) minLoc[0] = this->xx[p];
+    if (maxLoc[0] < this->xx[p]) maxLoc[0] = this->xx[p];
+    if (minLoc[1] > this->yy[p]) minLoc[1] = this->yy[p];
+    if (maxLoc[1] < this->yy[p]) maxLoc[1] = this->yy[p];
+    if (minLoc[2] > this->zz[p]) minLoc[2] = this->zz[p];
+    if (maxLoc[2] < this->zz[p]) maxLoc[2] = this->zz[p];
+    totalMass += this->mass[p];
+  }
+  POSVEL_T avgMass = (POSVEL_T)(totalMass / this->particleCount);
+
+  BHTree tree(minLoc, maxLoc, this->particleCount,
+              this->xx, this->yy, this->zz, this->mass, avgMass);
+  vector<SPHParticle*>& sphParticle = tree.getSPHParticle();
+  vector<SPHNode*>& sphNode = tree.getSPHNode();
+  ID_T offset = this->particleCount;
+
+  //////////////////////////////////////////////////////////////////////////
+  //
+  // Estimate the potential of every particle
+  //
+  vector<POSVEL_T> estimate(this->particleCount, 0.0);
+  parallelRanges(this->particleCount, numThreads, [&](long begin, long end) {
+    for (long p = begin; p < end; p++) {
+      POSVEL_T lpot = 0.0;
+      ID_T no = offset;
+      while (no >= 0) {
+        if (no < offset) {
+          // SPHParticle
+          if (no != p) {
+            POSVEL_T xdist = this->xx[p] - this->xx[no];
+            POSVEL_T ydist = this->yy[p] - this->yy[no];
+            POSVEL_T zdist = this->zz[p] - this->zz[no];
+            POSVEL_T dist =
+              sqrt((xdist*xdist) + (ydist*ydist) + (zdist*zdist) + rsm2);
+            if (dist != 0.0)
+              lpot -= this->mass[no] / dist;
+          }
+          no = sphParticle[no]->nextNode;
+        } else {
+          // SPHNode, use it as a whole if far enough, otherwise open it
+          SPHNode* node = sphNode[no - offset];
+          POSVEL_T xdist = this->xx[p] - node->node.info.s[0];
+          POSVEL_T ydist = this->yy[p] - node->node.info.s[1];
+          POSVEL_T zdist = this->zz[p] - node->node.info.s[2];
+          POSVEL_T dist2 = (xdist*xdist) + (ydist*ydist) + (zdist*zdist);
+          POSVEL_T length = max(max(node->length[0], node->length[1]),
+                                node->length[2]);
+          if (length * length <
+              BH_OPENING_ANGLE * BH_OPENING_ANGLE * dist2) {
+            lpot -= node->node.info.mass / sqrt(dist2 + rsm2);
+            no = node->node.info.sibling;
+          } else {
+            no = node->node.info.nextNode;
+          }
+        }
+      }
+      estimate[p] = lpot;
+    }
+  });
+
+  //////////////////////////////////////////////////////////////////////////
+  //
+  // Calculate the actual potential of the particles with lowest estimates
+  //
+  long numCandidates = min(BH_CANDIDATES, this->particleCount);
+  vector<int> candidates(this->particleCount);
+  for (int p = 0; p < this->particleCount; p++)
+    candidates[p] = p;
+  nth_element(candidates.begin(), candidates.begin() + (numCandidates - 1),
+              candidates.end(),
+              [&estimate](int p, int q) { return estimate[p] < estimate[q]; });
+  candidates.resize(numCandidates);
+
+  vector<POTENTIAL_T> actual(numCandidates, 0.0);
+  parallelRanges(numCandidates, numThreads, [&](long begin, long end) {
+    for (long c = begin; c < end; c++) {
+      int p = candidates[c];
+      POTENTIAL_T lpot = 0.0;
+      for (int q = 0; q < this->particleCount; q++) {
+        POSVEL_T xdist = this->xx[p] - this->xx[q];
+        POSVEL_T ydist = this->yy[p] - this->yy[q];
+        POSVEL_T zdist = this->zz[p] - this->zz[q];
+        POSVEL_T dist =
+          sqrt((xdist*xdist) + (ydist*ydist) + (zdist*zdist) + rsm2);
+        if (q != p && dist != 0.0)
+          lpot = (POTENTIAL_T)(lpot - (this->mass[q] / dist));
+      }
+      actual[c] = lpot;
+    }
+  });
+
+  int result = 0;
+  *minimumPotential = MAX_FLOAT;
+  for (long c = 0; c < numCandidates; c++) {
+    if (actual[c] < *minimumPotential) {
+      *minimumPotential = actual[c];
+      result = candidates[c];
+    }
+  }
+  return result;
+}
+
 /////////////////////////////////////////////////////////////////////////
 //
 // Within a bucket calculate the actual values between all particles
@@ -106,6 +106,13 @@ public:
   // Initial guess of A* contains an actual part and an estimated part
   int  mostBoundParticleAStar(POTENTIAL_T* minPotential);
 
+  // Find the halo center using most bound particle with the potential
+  // estimated on a Barnes Hut tree and computed exactly for the particles
+  // with the lowest estimates, using numThreads threads (for large halos)
+  int  mostBoundParticleBHTree(
+        POTENTIAL_T* minPotential,
+        int numThreads);
+
   // Calculate actual values between particles within a bucket
   void aStarThisBucketPart(
         ChainingMesh* haloChain,        // Buckets of particles
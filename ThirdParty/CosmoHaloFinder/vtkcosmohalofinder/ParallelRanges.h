@@ -0,0 +1,89 @@
+/*=========================================================================
+
+Copyright (c) 2007, Los Alamos National Security, LLC
+
+All rights reserved.
+
+Copyright 2007. Los Alamos National Security, LLC.
+This software was produced under U.S. Government contract DE-AC52-06NA25396
+for Los Alamos National Laboratory (LANL), which is operated by
+Los Alamos National Security, LLC for the U.S. Department of Energy.
+The U.S. Government has rights to use, reproduce, and distribute this software.
+NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY,
+EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.
+If software is modified to produce derivative works, such modified software
+should be clearly marked, so as not to confuse it with the version available
+from LANL.
+
+Additionally, redistribution and use in source and binary forms, with or
+without modification, are permitted provided that the following conditions
+are met:
+-   Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+-   Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+-   Neither the name of Los Alamos National Security, LLC, Los Alamos National
+    Laboratory, LANL, the U.S. Government, nor the names of its contributors
+    may be used to endorse or promote products derived from this software
+    without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL LOS ALAMOS NATIONAL SECURITY, LLC OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=========================================================================*/
+
+// .NAME ParallelRanges - split a loop over several threads
+//
+// .SECTION Description
+// parallelRanges() calls a function on ranges [begin, end) which cover
+// [0, count) from numThreads threads.  The ranges are handed out in small
+// chunks as threads become available so that the work is balanced even when
+// the cost of iterations varies a lot, as it does with clustered particles.
+
+#ifndef ParallelRanges_h
+#define ParallelRanges_h
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace cosmotk {
+
+template <typename FuncT>
+void parallelRanges(long count, int numThreads, const FuncT& func)
+{
+  long numRanges = std::min(static_cast<long>(std::max(numThreads, 1)), count);
+  if (numRanges <= 1) {
+    if (count > 0)
+      func(0L, count);
+    return;
+  }
+
+  // Several chunks per thread to balance the work
+  long chunkSize = std::max(count / (numRanges * 16), 1L);
+  std::atomic<long> next(0);
+  std::vector<std::thread> threads;
+  for (long t = 0; t < numRanges; t++) {
+    threads.push_back(std::thread([&]() {
+      long begin;
+      while ((begin = next.fetch_add(chunkSize)) < count)
+        func(begin, std::min(begin + chunkSize, count));
+    }));
+  }
+  for (size_t t = 0; t < threads.size(); t++)
+    threads[t].join();
+}
+
+} // END namespace cosmotk
+#endif
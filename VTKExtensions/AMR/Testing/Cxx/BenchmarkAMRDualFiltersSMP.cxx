@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkAMRDualClip.h"
+#include "vtkAMRDualContour.h"
+#include "vtkDataObject.h"
+#include "vtkHierarchicalFractal.h"
+#include "vtkNew.h"
+#include "vtkNonOverlappingAMR.h"
+#include "vtkSMPTools.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+
+namespace
+{
+template <typename FilterT>
+double TimeExecute(vtkNonOverlappingAMR* input, bool smp, int mergePoints)
+{
+  FilterT::SetUseSMPBlockExecution(smp);
+  vtkNew<FilterT> filter;
+  filter->SetInputData(input);
+  filter->SetInputArrayToProcess(
+    0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, "Fractal Volume Fraction");
+  filter->SetIsoValue(0.5);
+  filter->SetEnableMergePoints(mergePoints);
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  filter->Update();
+  timer->StopTimer();
+  return timer->GetElapsedTime();
+}
+}
+
+// Times vtkAMRDualContour and vtkAMRDualClip on a vtkHierarchicalFractal with
+// the blocks processed serially and with the SMP tools. With merged points,
+// blocks are processed serially in both runs and the timings should match.
+int BenchmarkAMRDualFiltersSMP(int argc, char* argv[])
+{
+  int levels = 6;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument(
+    "--levels", argT::EQUAL_ARGUMENT, &levels, "Maximum level of the hierarchical fractal.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkHierarchicalFractal> fractal;
+  fractal->SetDimensions(8);
+  fractal->SetMaximumLevel(levels);
+  fractal->SetGhostLevels(1);
+  fractal->SetTwoDimensional(0);
+  fractal->SetAsymetric(0);
+  fractal->SetOverlap(0);
+  fractal->Update();
+  vtkNew<vtkNonOverlappingAMR> input;
+  input->ShallowCopy(fractal->GetOutputDataObject(0));
+
+  const bool prevContourSMP = vtkAMRDualContour::GetUseSMPBlockExecution();
+  const bool prevClipSMP = vtkAMRDualClip::GetUseSMPBlockExecution();
+  cout << "Levels: " << levels << ", blocks: " << input->GetTotalNumberOfBlocks()
+       << ", SMP backend: " << vtkSMPTools::GetBackend() << endl;
+  for (const int mergePoints : { 0, 1 })
+  {
+    const double serialContour = TimeExecute<vtkAMRDualContour>(input, false, mergePoints);
+    const double smpContour = TimeExecute<vtkAMRDualContour>(input, true, mergePoints);
+    const double serialClip = TimeExecute<vtkAMRDualClip>(input, false, mergePoints);
+    const double smpClip = TimeExecute<vtkAMRDualClip>(input, true, mergePoints);
+    cout << "EnableMergePoints " << mergePoints << ": contour serial " << serialContour
+         << "s, SMP " << smpContour << "s; clip serial " << serialClip << "s, SMP " << smpClip
+         << "s" << endl;
+  }
+  vtkAMRDualContour::SetUseSMPBlockExecution(prevContourSMP);
+  vtkAMRDualClip::SetUseSMPBlockExecution(prevClipSMP);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkAMRDualClip.h"
+#include "vtkAMRDualContour.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDataObject.h"
+#include "vtkHierarchicalFractal.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkMultiPieceDataSet.h"
+#include "vtkNew.h"
+#include "vtkNonOverlappingAMR.h"
+#include "vtkPointSet.h"
+#include "vtkSmartPointer.h"
+
+namespace
+{
+template <typename FilterT>
+vtkSmartPointer<vtkPointSet> Execute(vtkNonOverlappingAMR* input, bool smp, int mergePoints)
+{
+  FilterT::SetUseSMPBlockExecution(smp);
+  vtkNew<FilterT> filter;
+  filter->SetInputData(input);
+  filter->SetInputArrayToProcess(
+    0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, "Fractal Volume Fraction");
+  filter->SetIsoValue(0.5);
+  filter->SetEnableMergePoints(mergePoints);
+  filter->Update();
+
+  auto output = vtkMultiBlockDataSet::SafeDownCast(filter->GetOutputDataObject(0));
+  auto pieces = vtkMultiPieceDataSet::SafeDownCast(output ? output->GetBlock(0) : nullptr);
+  return vtkPointSet::SafeDownCast(pieces ? pieces->GetPiece(0) : nullptr);
+}
+
+// The pieces of the blocks are appended in the serial order.
+bool CompareExactly(vtkPointSet* serial, vtkPointSet* smp)
+{
+  if (serial->GetNumberOfPoints() != smp->GetNumberOfPoints() ||
+    serial->GetNumberOfCells() != smp->GetNumberOfCells())
+  {
+    cerr << "ERROR: serial and SMP outputs differ in size." << endl;
+    return false;
+  }
+  for (vtkIdType id = 0; id < serial->GetNumberOfPoints(); ++id)
+  {
+    double p1[3], p2[3];
+    serial->GetPoint(id, p1);
+    smp->GetPoint(id, p2);
+    if (p1[0] != p2[0] || p1[1] != p2[1] || p1[2] != p2[2])
+    {
+      cerr << "ERROR: point " << id << " differs." << endl;
+      return false;
+    }
+  }
+  vtkDataArray* blockIds1 = serial->GetCellData()->GetArray("BlockIds");
+  vtkDataArray* blockIds2 = smp->GetCellData()->GetArray("BlockIds");
+  for (vtkIdType id = 0; id < serial->GetNumberOfCells(); ++id)
+  {
+    if (blockIds1->GetTuple1(id) != blockIds2->GetTuple1(id))
+    {
+      cerr << "ERROR: cell " << id << " differs." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestAMRDualFiltersSMP(int, char*[])
+{
+  vtkNew<vtkHierarchicalFractal> fractal;
+  fractal->SetDimensions(8);
+  fractal->SetMaximumLevel(4);
+  fractal->SetGhostLevels(1);
+  fractal->SetTwoDimensional(0);
+  fractal->SetAsymetric(0);
+  fractal->SetOverlap(0);
+  fractal->Update();
+  vtkNew<vtkNonOverlappingAMR> input;
+  input->ShallowCopy(fractal->GetOutputDataObject(0));
+
+  const bool prevContourSMP = vtkAMRDualContour::GetUseSMPBlockExecution();
+  const bool prevClipSMP = vtkAMRDualClip::GetUseSMPBlockExecution();
+  int success = 1;
+  // With merged points, the default of the proxies, blocks are processed
+  // serially whatever the setting, hence the outputs must match as well.
+  for (const int mergePoints : { 0, 1 })
+  {
+    vtkSmartPointer<vtkPointSet> serial = Execute<vtkAMRDualContour>(input, false, mergePoints);
+    vtkSmartPointer<vtkPointSet> smp = Execute<vtkAMRDualContour>(input, true, mergePoints);
+    vtkSmartPointer<vtkPointSet> serialClip = Execute<vtkAMRDualClip>(input, false, mergePoints);
+    vtkSmartPointer<vtkPointSet> smpClip = Execute<vtkAMRDualClip>(input, true, mergePoints);
+    if (!serial || !smp || !serialClip || !smpClip || serial->GetNumberOfCells() == 0 ||
+      serialClip->GetNumberOfCells() == 0)
+    {
+      cerr << "ERROR: missing output with EnableMergePoints " << mergePoints << "." << endl;
+      success = 0;
+    }
+    else if (!CompareExactly(serial, smp) || !CompareExactly(serialClip, smpClip))
+    {
+      cerr << "ERROR: outputs differ with EnableMergePoints " << mergePoints << "." << endl;
+      success = 0;
+    }
+  }
+  vtkAMRDualContour::SetUseSMPBlockExecution(prevContourSMP);
+  vtkAMRDualClip::SetUseSMPBlockExecution(prevClipSMP);
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
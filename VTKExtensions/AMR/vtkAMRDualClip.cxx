@@ -13,6 +13,9 @@
 #include "vtkMultiProcessController.h"
 #include "vtkObject.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 // PV interface
 #include "vtkCallbackCommand.h"
@@ -36,10 +39,37 @@
 #include <cmath>
 #include <ctime>
 
+namespace
+{
+bool UseSMPBlockExecution = true;
+
+// Where the output of a block is in the mesh of the worker that clipped it.
+struct vtkAMRDualClipPiece
+{
+  vtkAMRDualClip* Worker = nullptr;
+  vtkIdType PointStart = 0;
+  vtkIdType NumberOfPoints = 0;
+  vtkIdType CellStart = 0;
+  vtkIdType NumberOfCells = 0;
+};
+}
+
 vtkStandardNewMacro(vtkAMRDualClip);
 
 vtkCxxSetObjectMacro(vtkAMRDualClip, Controller, vtkMultiProcessController);
 
+//----------------------------------------------------------------------------
+void vtkAMRDualClip::SetUseSMPBlockExecution(bool value)
+{
+  UseSMPBlockExecution = value;
+}
+
+//----------------------------------------------------------------------------
+bool vtkAMRDualClip::GetUseSMPBlockExecution()
+{
+  return UseSMPBlockExecution;
+}
+
 // 1: Create meta data just like AMR iso.
 // 2: Assign shared regions just like AMR iso.
 // 3: Copy Ghost layers (low to high) just like AMR iso.
@@ -1052,6 +1082,7 @@ void vtkAMRDualClip::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "EnableDegenerateCells: " << this->EnableDegenerateCells << endl;
   os << indent << "EnableMergePoints: " << this->EnableMergePoints << endl;
   os << indent << "Controller: " << this->Controller << endl;
+  os << indent << "UseSMPBlockExecution: " << UseSMPBlockExecution << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -1172,58 +1203,185 @@ vtkMultiBlockDataSet* vtkAMRDualClip::DoRequestData(
     this->DistributeLevelMasks();
   }
 
-  vtkUnstructuredGrid* mesh = vtkUnstructuredGrid::New();
+  this->InitializeMesh(hbdsInput);
+  mpds->SetPiece(0, this->Mesh);
+
+  if (UseSMPBlockExecution && !this->EnableMergePoints)
+  {
+    this->ProcessBlocksSMP(hbdsInput, arrayNameToProcess);
+  }
+  else
+  {
+    // Loop through blocks
+    int numLevels = hbdsInput->GetNumberOfLevels();
+    int numBlocks;
+    int blockId;
+
+    // Add each block.
+    for (int level = 0; level < numLevels; ++level)
+    {
+      numBlocks = this->Helper->GetNumberOfBlocksInLevel(level);
+      for (blockId = 0; blockId < numBlocks; ++blockId)
+      {
+        vtkAMRDualGridHelperBlock* block = this->Helper->GetBlock(level, blockId);
+        this->ProcessBlock(block, blockId, arrayNameToProcess);
+      }
+    }
+  }
+
+  this->Mesh->SetCells(VTK_TETRA, this->Cells);
+  this->ReleaseMesh();
+
+  mpds->Delete();
+  this->Helper->Delete();
+  this->Helper = nullptr;
+
+  return mbdsOutput0;
+}
+
+//----------------------------------------------------------------------------
+void vtkAMRDualClip::InitializeMesh(vtkNonOverlappingAMR* hbdsInput)
+{
+  this->Mesh = vtkUnstructuredGrid::New();
   this->Points = vtkPoints::New();
   this->Cells = vtkCellArray::New();
-  mesh->SetPoints(this->Points);
-  mpds->SetPiece(0, mesh);
+  this->Mesh->SetPoints(this->Points);
 
   this->BlockIdCellArray = vtkIntArray::New();
   this->BlockIdCellArray->SetName("BlockIds");
-  mesh->GetCellData()->AddArray(this->BlockIdCellArray);
+  this->Mesh->GetCellData()->AddArray(this->BlockIdCellArray);
 
   this->LevelMaskPointArray = vtkUnsignedCharArray::New();
   this->LevelMaskPointArray->SetName("LevelMask");
-  mesh->GetPointData()->AddArray(this->LevelMaskPointArray);
+  this->Mesh->GetPointData()->AddArray(this->LevelMaskPointArray);
 
-  this->Mesh = mesh;
   this->InitializeCopyAttributes(hbdsInput, this->Mesh);
+}
 
-  // Loop through blocks
-  int numLevels = hbdsInput->GetNumberOfLevels();
-  int numBlocks;
-  int blockId;
-
-  // Add each block.
-  for (int level = 0; level < numLevels; ++level)
-  {
-    numBlocks = this->Helper->GetNumberOfBlocksInLevel(level);
-    for (blockId = 0; blockId < numBlocks; ++blockId)
-    {
-      vtkAMRDualGridHelperBlock* block = this->Helper->GetBlock(level, blockId);
-      this->ProcessBlock(block, blockId, arrayNameToProcess);
-    }
-  }
-
+//----------------------------------------------------------------------------
+void vtkAMRDualClip::ReleaseMesh()
+{
   this->BlockIdCellArray->Delete();
   this->BlockIdCellArray = nullptr;
   this->LevelMaskPointArray->Delete();
   this->LevelMaskPointArray = nullptr;
 
-  mesh->SetCells(VTK_TETRA, this->Cells);
-
-  mesh->Delete();
+  this->Mesh->Delete();
   this->Mesh = nullptr;
   this->Points->Delete();
   this->Points = nullptr;
   this->Cells->Delete();
   this->Cells = nullptr;
+}
 
-  mpds->Delete();
-  this->Helper->Delete();
-  this->Helper = nullptr;
+//----------------------------------------------------------------------------
+void vtkAMRDualClip::ProcessBlocksSMP(
+  vtkNonOverlappingAMR* hbdsInput, const char* arrayNameToProcess)
+{
+  // Blocks in the order of the serial loop.
+  std::vector<std::pair<vtkAMRDualGridHelperBlock*, int>> blocks;
+  int numLevels = hbdsInput->GetNumberOfLevels();
+  for (int level = 0; level < numLevels; ++level)
+  {
+    int numBlocks = this->Helper->GetNumberOfBlocksInLevel(level);
+    for (int blockId = 0; blockId < numBlocks; ++blockId)
+    {
+      blocks.emplace_back(this->Helper->GetBlock(level, blockId), blockId);
+    }
+  }
 
-  return mbdsOutput0;
+  // Each thread clips its blocks into the mesh of its own worker. Without
+  // merging points, blocks only share the (read only) helper.
+  std::vector<vtkAMRDualClipPiece> pieces(blocks.size());
+  vtkSMPThreadLocal<vtkSmartPointer<vtkAMRDualClip>> workers;
+  vtkSMPTools::For(0, static_cast<vtkIdType>(blocks.size()), [&](vtkIdType begin, vtkIdType end) {
+    vtkSmartPointer<vtkAMRDualClip>& worker = workers.Local();
+    if (!worker)
+    {
+      worker = vtkSmartPointer<vtkAMRDualClip>::New();
+      worker->IsoValue = this->IsoValue;
+      worker->EnableInternalDecimation = this->EnableInternalDecimation;
+      worker->EnableMergePoints = 0;
+      worker->Helper = this->Helper;
+      worker->InitializeMesh(hbdsInput);
+    }
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      vtkAMRDualClipPiece& piece = pieces[cc];
+      piece.Worker = worker;
+      piece.PointStart = worker->Points->GetNumberOfPoints();
+      piece.CellStart = worker->Cells->GetNumberOfCells();
+      worker->ProcessBlock(blocks[cc].first, blocks[cc].second, arrayNameToProcess);
+      piece.NumberOfPoints = worker->Points->GetNumberOfPoints() - piece.PointStart;
+      piece.NumberOfCells = worker->Cells->GetNumberOfCells() - piece.CellStart;
+    }
+  });
+
+  // Append the pieces in block order, so that the output is the same as the
+  // one of the serial loop.
+  vtkIdType numPoints = 0;
+  vtkIdType numCells = 0;
+  for (const vtkAMRDualClipPiece& piece : pieces)
+  {
+    numPoints += piece.NumberOfPoints;
+    numCells += piece.NumberOfCells;
+  }
+  vtkPointData* outPD = this->Mesh->GetPointData();
+  this->Points->SetNumberOfPoints(numPoints);
+  outPD->SetNumberOfTuples(numPoints);
+  this->Cells->AllocateExact(numCells, 4 * numCells);
+  this->BlockIdCellArray->SetNumberOfTuples(numCells);
+
+  vtkIdType pointStart = 0;
+  vtkIdType cellStart = 0;
+  for (const vtkAMRDualClipPiece& piece : pieces)
+  {
+    vtkAMRDualClip* worker = piece.Worker;
+    if (piece.NumberOfPoints > 0)
+    {
+      this->Points->InsertPoints(
+        pointStart, piece.NumberOfPoints, piece.PointStart, worker->Points);
+      // Point data of the workers are allocated like the one of the mesh.
+      vtkPointData* workerPD = worker->Mesh->GetPointData();
+      for (int i = 0; i < outPD->GetNumberOfArrays(); ++i)
+      {
+        outPD->GetAbstractArray(i)->InsertTuples(
+          pointStart, piece.NumberOfPoints, piece.PointStart, workerPD->GetAbstractArray(i));
+      }
+    }
+    if (piece.NumberOfCells > 0)
+    {
+      this->BlockIdCellArray->InsertTuples(
+        cellStart, piece.NumberOfCells, piece.CellStart, worker->BlockIdCellArray);
+      const vtkIdType shift = pointStart - piece.PointStart;
+      for (vtkIdType cellId = piece.CellStart; cellId < piece.CellStart + piece.NumberOfCells;
+           ++cellId)
+      {
+        vtkIdType npts;
+        const vtkIdType* pts;
+        worker->Cells->GetCellAtId(cellId, npts, pts);
+        vtkIdType pointIds[4];
+        for (vtkIdType i = 0; i < npts; ++i)
+        {
+          pointIds[i] = pts[i] + shift;
+        }
+        this->Cells->InsertNextCell(npts, pointIds);
+      }
+    }
+    pointStart += piece.NumberOfPoints;
+    cellStart += piece.NumberOfCells;
+  }
+
+  // release the workers, and the meshes they hold, on this thread.
+  for (auto& worker : workers)
+  {
+    if (worker)
+    {
+      worker->ReleaseMesh();
+      worker->Helper = nullptr;
+      worker = nullptr;
+    }
+  }
 }
 
 //----------------------------------------------------------------------------
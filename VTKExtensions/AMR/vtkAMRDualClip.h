@@ -67,13 +67,26 @@ public:
   /**
    * This flag causes blocks to share locators so there are no
    * boundary edges between blocks. It does not eliminate
-   * boundary edges between processes.
+   * boundary edges between processes. Since the locators are shared in block
+   * order, blocks are processed serially when it is on.
    */
   vtkSetMacro(EnableMergePoints, int);
   vtkGetMacro(EnableMergePoints, int);
   vtkBooleanMacro(EnableMergePoints, int);
   ///@}
 
+  ///@{
+  /**
+   * When true and EnableMergePoints is off, the blocks of a rank are clipped
+   * concurrently using vtkSMPTools, each thread with its own locator. The
+   * pieces are appended in block order, so the output does not depend on
+   * this setting. Merging points shares locators and level masks between
+   * neighbor blocks in order, hence it is always serial. Default is true.
+   */
+  static void SetUseSMPBlockExecution(bool);
+  static bool GetUseSMPBlockExecution();
+  ///@}
+
   vtkGetObjectMacro(Controller, vtkMultiProcessController);
   virtual void SetController(vtkMultiProcessController*);
 
@@ -109,6 +122,21 @@ protected:
 
   void ProcessBlock(vtkAMRDualGridHelperBlock* block, int blockId, const char* arrayName);
 
+  /**
+   * Clip all the blocks of the helper in parallel and append the result
+   * to Mesh.
+   */
+  void ProcessBlocksSMP(vtkNonOverlappingAMR* input, const char* arrayName);
+
+  ///@{
+  /**
+   * Create and release the output mesh (Mesh, Points, Cells, BlockIdCellArray
+   * and LevelMaskPointArray).
+   */
+  void InitializeMesh(vtkNonOverlappingAMR* input);
+  void ReleaseMesh();
+  ///@}
+
   void ProcessDualCell(vtkAMRDualGridHelperBlock* block, int blockId, int x, int y, int z,
     vtkIdType cornerOffsets[8], vtkDataArray* volumeFractionArray);
 
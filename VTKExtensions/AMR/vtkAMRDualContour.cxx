@@ -12,6 +12,9 @@
 #include "vtkMultiProcessController.h"
 #include "vtkObject.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 // PV interface
 #include "vtkCallbackCommand.h"
@@ -36,10 +39,37 @@
 #include <cmath>
 #include <ctime>
 
+namespace
+{
+bool UseSMPBlockExecution = true;
+
+// Where the output of a block is in the mesh of the worker that contoured it.
+struct vtkAMRDualContourPiece
+{
+  vtkAMRDualContour* Worker = nullptr;
+  vtkIdType PointStart = 0;
+  vtkIdType NumberOfPoints = 0;
+  vtkIdType CellStart = 0;
+  vtkIdType NumberOfCells = 0;
+};
+}
+
 vtkStandardNewMacro(vtkAMRDualContour);
 
 vtkCxxSetObjectMacro(vtkAMRDualContour, Controller, vtkMultiProcessController);
 
+//----------------------------------------------------------------------------
+void vtkAMRDualContour::SetUseSMPBlockExecution(bool value)
+{
+  UseSMPBlockExecution = value;
+}
+
+//----------------------------------------------------------------------------
+bool vtkAMRDualContour::GetUseSMPBlockExecution()
+{
+  return UseSMPBlockExecution;
+}
+
 static int vtkAMRDualIsoEdgeToPointsTable[12][2] = { { 0, 1 }, { 1, 3 }, { 2, 3 }, { 0, 2 },
   { 4, 5 }, { 5, 7 }, { 6, 7 }, { 4, 6 }, { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 } };
 static int vtkAMRDualIsoEdgeToVTKPointsTable[12][2] = { { 0, 1 }, { 1, 2 }, { 3, 2 }, { 0, 3 },
@@ -650,6 +680,7 @@ void vtkAMRDualContour::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "EnableMergePoints: " << this->EnableMergePoints << endl;
   os << indent << "TriangulateCap: " << this->TriangulateCap << endl;
   os << indent << "SkipGhostCopy: " << this->SkipGhostCopy << endl;
+  os << indent << "UseSMPBlockExecution: " << UseSMPBlockExecution << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -781,12 +812,49 @@ vtkMultiBlockDataSet* vtkAMRDualContour::DoRequestData(
 
   mpds->SetNumberOfPieces(0);
 
+  this->InitializeMesh(hbdsInput);
+  mpds->SetPiece(0, this->Mesh);
+
+  // Merging points shares locators between neighbor blocks in level order,
+  // so blocks are only contoured concurrently without it.
+  if (UseSMPBlockExecution && !this->EnableMergePoints)
+  {
+    this->ProcessBlocksSMP(hbdsInput, arrayNameToProcess);
+  }
+  else
+  {
+    // Loop through blocks
+    int numLevels = hbdsInput->GetNumberOfLevels();
+
+    // Add each block.
+    for (int level = 0; level < numLevels; ++level)
+    {
+      int numBlocks = this->Helper->GetNumberOfBlocksInLevel(level);
+      for (int blockId = 0; blockId < numBlocks; ++blockId)
+      {
+        vtkAMRDualGridHelperBlock* block = this->Helper->GetBlock(level, blockId);
+        this->ProcessBlock(block, blockId, arrayNameToProcess);
+      }
+    }
+  }
+
+  this->FinalizeCopyAttributes(this->Mesh);
+
+  this->ReleaseMesh();
+
+  mpds->Delete();
+
+  return mbdsOutput0;
+}
+
+//----------------------------------------------------------------------------
+void vtkAMRDualContour::InitializeMesh(vtkNonOverlappingAMR* hbdsInput)
+{
   this->Mesh = vtkPolyData::New();
   this->Points = vtkPoints::New();
   this->Faces = vtkCellArray::New();
   this->Mesh->SetPoints(this->Points);
   this->Mesh->SetPolys(this->Faces);
-  mpds->SetPiece(0, this->Mesh);
 
   this->InitializeCopyAttributes(hbdsInput, this->Mesh);
 
@@ -794,22 +862,11 @@ vtkMultiBlockDataSet* vtkAMRDualContour::DoRequestData(
   this->BlockIdCellArray = vtkIntArray::New();
   this->BlockIdCellArray->SetName("BlockIds");
   this->Mesh->GetCellData()->AddArray(this->BlockIdCellArray);
+}
 
-  // Loop through blocks
-  int numLevels = hbdsInput->GetNumberOfLevels();
-
-  // Add each block.
-  for (int level = 0; level < numLevels; ++level)
-  {
-    int numBlocks = this->Helper->GetNumberOfBlocksInLevel(level);
-    for (int blockId = 0; blockId < numBlocks; ++blockId)
-    {
-      vtkAMRDualGridHelperBlock* block = this->Helper->GetBlock(level, blockId);
-      this->ProcessBlock(block, blockId, arrayNameToProcess);
-    }
-  }
-
-  this->FinalizeCopyAttributes(this->Mesh);
+//----------------------------------------------------------------------------
+void vtkAMRDualContour::ReleaseMesh()
+{
   this->BlockIdCellArray->Delete();
   this->BlockIdCellArray = nullptr;
 
@@ -819,10 +876,119 @@ vtkMultiBlockDataSet* vtkAMRDualContour::DoRequestData(
   this->Points = nullptr;
   this->Faces->Delete();
   this->Faces = nullptr;
+}
 
-  mpds->Delete();
+//----------------------------------------------------------------------------
+void vtkAMRDualContour::ProcessBlocksSMP(
+  vtkNonOverlappingAMR* hbdsInput, const char* arrayNameToProcess)
+{
+  // Blocks in the order of the serial loop.
+  std::vector<std::pair<vtkAMRDualGridHelperBlock*, int>> blocks;
+  int numLevels = hbdsInput->GetNumberOfLevels();
+  for (int level = 0; level < numLevels; ++level)
+  {
+    int numBlocks = this->Helper->GetNumberOfBlocksInLevel(level);
+    for (int blockId = 0; blockId < numBlocks; ++blockId)
+    {
+      blocks.emplace_back(this->Helper->GetBlock(level, blockId), blockId);
+    }
+  }
 
-  return mbdsOutput0;
+  // Each thread contours its blocks into the mesh of its own worker. Workers
+  // share the (read only) helper. Points are not merged, so no locator is
+  // shared between blocks.
+  std::vector<vtkAMRDualContourPiece> pieces(blocks.size());
+  vtkSMPThreadLocal<vtkSmartPointer<vtkAMRDualContour>> workers;
+  vtkSMPTools::For(0, static_cast<vtkIdType>(blocks.size()), [&](vtkIdType begin, vtkIdType end) {
+    vtkSmartPointer<vtkAMRDualContour>& worker = workers.Local();
+    if (!worker)
+    {
+      worker = vtkSmartPointer<vtkAMRDualContour>::New();
+      worker->IsoValue = this->IsoValue;
+      worker->EnableCapping = this->EnableCapping;
+      worker->TriangulateCap = this->TriangulateCap;
+      worker->EnableMergePoints = 0;
+      worker->Helper = this->Helper;
+      worker->InitializeMesh(hbdsInput);
+    }
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      vtkAMRDualContourPiece& piece = pieces[cc];
+      piece.Worker = worker;
+      piece.PointStart = worker->Points->GetNumberOfPoints();
+      piece.CellStart = worker->Faces->GetNumberOfCells();
+      worker->ProcessBlock(blocks[cc].first, blocks[cc].second, arrayNameToProcess);
+      piece.NumberOfPoints = worker->Points->GetNumberOfPoints() - piece.PointStart;
+      piece.NumberOfCells = worker->Faces->GetNumberOfCells() - piece.CellStart;
+    }
+  });
+
+  // Append the pieces in block order, so that the output does not depend on
+  // how the blocks were scheduled.
+  vtkIdType numPoints = 0;
+  vtkIdType numCells = 0;
+  for (const vtkAMRDualContourPiece& piece : pieces)
+  {
+    numPoints += piece.NumberOfPoints;
+    numCells += piece.NumberOfCells;
+  }
+  vtkPointData* outPD = this->Mesh->GetPointData();
+  this->Points->SetNumberOfPoints(numPoints);
+  outPD->SetNumberOfTuples(numPoints);
+  this->Faces->AllocateEstimate(numCells, 3);
+  this->BlockIdCellArray->SetNumberOfTuples(numCells);
+
+  vtkIdType pointStart = 0;
+  vtkIdType cellStart = 0;
+  std::vector<vtkIdType> pointIds;
+  for (const vtkAMRDualContourPiece& piece : pieces)
+  {
+    vtkAMRDualContour* worker = piece.Worker;
+    if (piece.NumberOfPoints > 0)
+    {
+      this->Points->InsertPoints(
+        pointStart, piece.NumberOfPoints, piece.PointStart, worker->Points);
+      // Point data of the workers are allocated like the one of the mesh.
+      vtkPointData* workerPD = worker->Mesh->GetPointData();
+      for (int i = 0; i < outPD->GetNumberOfArrays(); ++i)
+      {
+        outPD->GetAbstractArray(i)->InsertTuples(
+          pointStart, piece.NumberOfPoints, piece.PointStart, workerPD->GetAbstractArray(i));
+      }
+    }
+    if (piece.NumberOfCells > 0)
+    {
+      this->BlockIdCellArray->InsertTuples(
+        cellStart, piece.NumberOfCells, piece.CellStart, worker->BlockIdCellArray);
+      const vtkIdType shift = pointStart - piece.PointStart;
+      for (vtkIdType cellId = piece.CellStart; cellId < piece.CellStart + piece.NumberOfCells;
+           ++cellId)
+      {
+        vtkIdType npts;
+        const vtkIdType* pts;
+        worker->Faces->GetCellAtId(cellId, npts, pts);
+        pointIds.resize(npts);
+        for (vtkIdType i = 0; i < npts; ++i)
+        {
+          pointIds[i] = pts[i] + shift;
+        }
+        this->Faces->InsertNextCell(npts, pointIds.data());
+      }
+    }
+    pointStart += piece.NumberOfPoints;
+    cellStart += piece.NumberOfCells;
+  }
+
+  // release the workers, and the meshes they hold, on this thread.
+  for (auto& worker : workers)
+  {
+    if (worker)
+    {
+      worker->ReleaseMesh();
+      worker->Helper = nullptr;
+      worker = nullptr;
+    }
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -75,7 +75,8 @@ public:
   /**
    * This flag causes blocks to share locators so there are no
    * boundary edges between blocks. It does not eliminate
-   * boundary edges between processes.
+   * boundary edges between processes. Since the locators are shared in block
+   * order, blocks are processed serially when it is on.
    */
   vtkSetMacro(EnableMergePoints, int);
   vtkGetMacro(EnableMergePoints, int);
@@ -103,6 +104,18 @@ public:
   vtkBooleanMacro(SkipGhostCopy, int);
   ///@}
 
+  ///@{
+  /**
+   * When true and EnableMergePoints is off, the blocks of a rank are contoured
+   * concurrently using vtkSMPTools. The pieces are appended in block order, so
+   * the output does not depend on this setting. Merging points shares
+   * locators between neighbor blocks in order, hence it is always serial.
+   * Default is true.
+   */
+  static void SetUseSMPBlockExecution(bool);
+  static bool GetUseSMPBlockExecution();
+  ///@}
+
   vtkGetObjectMacro(Controller, vtkMultiProcessController);
   virtual void SetController(vtkMultiProcessController*);
 
@@ -145,6 +158,21 @@ protected:
 
   void ProcessBlock(vtkAMRDualGridHelperBlock* block, int blockId, const char* arrayName);
 
+  /**
+   * Contour all the blocks of the helper in parallel and append the result
+   * to Mesh.
+   */
+  void ProcessBlocksSMP(vtkNonOverlappingAMR* input, const char* arrayName);
+
+  ///@{
+  /**
+   * Create and release the output mesh (Mesh, Points, Faces and
+   * BlockIdCellArray).
+   */
+  void InitializeMesh(vtkNonOverlappingAMR* input);
+  void ReleaseMesh();
+  ///@}
+
   void ProcessDualCell(vtkAMRDualGridHelperBlock* block, int blockId, int x, int y, int z,
     vtkIdType cornerOffsets[8], vtkDataArray* volumeFractionArray);
 
@@ -3,14 +3,17 @@
 #include "vtkPVXMLElement.h"
 
 #include "vtkCollection.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkSmartPointer.h"
 
 vtkStandardNewMacro(vtkPVXMLElement);
 
 #include <cctype>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #if defined(_WIN32) && !defined(__CYGWIN__)
 #define SNPRINTF _snprintf
@@ -18,6 +21,15 @@ vtkStandardNewMacro(vtkPVXMLElement);
 #define SNPRINTF snprintf
 #endif
 
+namespace
+{
+bool UseLookupIndices = true;
+
+// Below this number of attributes or nested elements, a linear search is
+// faster than hashing the searched string.
+const size_t LookupIndexThreshold = 16;
+}
+
 struct vtkPVXMLElementInternals
 {
   std::vector<std::string> AttributeNames;
@@ -25,6 +37,140 @@ struct vtkPVXMLElementInternals
   typedef std::vector<vtkSmartPointer<vtkPVXMLElement>> VectorOfElements;
   VectorOfElements NestedElements;
   std::string CharacterData;
+
+  // Indices of the attributes by name and of the nested elements by id, kept
+  // up to date as the element changes once it has enough of them. Lookups
+  // only read them, so that a document may be read from several threads. As
+  // for a linear search, the first attribute or nested element with a given
+  // name or id is found.
+  std::unordered_map<std::string, size_t> AttributeIndex;
+  std::unordered_map<std::string, size_t> NestedElementIndex;
+
+  static const size_t NotFound = static_cast<size_t>(-1);
+
+  //----------------------------------------------------------------------------
+  size_t FindAttribute(const char* name) const
+  {
+    const size_t numAttributes = this->AttributeNames.size();
+    if (!name)
+    {
+      return NotFound;
+    }
+    if (!UseLookupIndices || numAttributes < LookupIndexThreshold)
+    {
+      for (size_t i = 0; i < numAttributes; ++i)
+      {
+        if (strcmp(this->AttributeNames[i].c_str(), name) == 0)
+        {
+          return i;
+        }
+      }
+      return NotFound;
+    }
+    auto iter = this->AttributeIndex.find(name);
+    if (iter == this->AttributeIndex.end())
+    {
+      return NotFound;
+    }
+    return iter->second;
+  }
+
+  //----------------------------------------------------------------------------
+  void AddAttribute(const char* name, const char* value)
+  {
+    this->AttributeNames.push_back(name);
+    this->AttributeValues.push_back(value);
+    const size_t numAttributes = this->AttributeNames.size();
+    if (numAttributes == LookupIndexThreshold)
+    {
+      this->UpdateAttributeIndex();
+    }
+    else if (numAttributes > LookupIndexThreshold)
+    {
+      this->AttributeIndex.emplace(name, numAttributes - 1);
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Rebuilds the index after the attributes were changed as a whole.
+  void UpdateAttributeIndex()
+  {
+    const size_t numAttributes = this->AttributeNames.size();
+    this->AttributeIndex.clear();
+    if (numAttributes < LookupIndexThreshold)
+    {
+      return;
+    }
+    this->AttributeIndex.reserve(numAttributes);
+    for (size_t i = 0; i < numAttributes; ++i)
+    {
+      this->AttributeIndex.emplace(this->AttributeNames[i], i);
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  vtkPVXMLElement* FindNestedElement(const char* id) const
+  {
+    const size_t numNested = this->NestedElements.size();
+    if (!UseLookupIndices || numNested < LookupIndexThreshold)
+    {
+      return this->FindNestedElementLinear(id);
+    }
+    auto iter = this->NestedElementIndex.find(id);
+    return iter != this->NestedElementIndex.end() ? this->NestedElements[iter->second].GetPointer()
+                                                  : nullptr;
+  }
+
+  //----------------------------------------------------------------------------
+  vtkPVXMLElement* FindNestedElementLinear(const char* id) const
+  {
+    for (auto& nested : this->NestedElements)
+    {
+      const char* nid = nested->GetId();
+      if (nid && strcmp(nid, id) == 0)
+      {
+        return nested;
+      }
+    }
+    return nullptr;
+  }
+
+  //----------------------------------------------------------------------------
+  void AddNestedElement(vtkPVXMLElement* element)
+  {
+    this->NestedElements.push_back(element);
+    const size_t numNested = this->NestedElements.size();
+    const char* id = element->GetId();
+    if (numNested == LookupIndexThreshold)
+    {
+      this->UpdateNestedElementIndex();
+    }
+    else if (numNested > LookupIndexThreshold && id)
+    {
+      this->NestedElementIndex.emplace(id, numNested - 1);
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Rebuilds the index after nested elements were removed or replaced, or
+  // after the id of one of them changed.
+  void UpdateNestedElementIndex()
+  {
+    const size_t numNested = this->NestedElements.size();
+    this->NestedElementIndex.clear();
+    if (numNested < LookupIndexThreshold)
+    {
+      return;
+    }
+    this->NestedElementIndex.reserve(numNested);
+    for (size_t i = 0; i < numNested; ++i)
+    {
+      if (const char* nid = this->NestedElements[i]->GetId())
+      {
+        this->NestedElementIndex.emplace(nid, i);
+      }
+    }
+  }
 };
 
 // Function to check if a string is full of whitespace characters.
@@ -40,6 +186,62 @@ static bool vtkIsSpace(const std::string& str)
   return true;
 }
 
+namespace
+{
+// Flags of the binary form telling which of the name and id are set.
+enum
+{
+  BINARY_HAS_NAME = 0x1,
+  BINARY_HAS_ID = 0x2
+};
+
+void WriteBinaryValue(std::string& buffer, vtkTypeUInt32 value)
+{
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void WriteBinaryString(std::string& buffer, const std::string& str)
+{
+  WriteBinaryValue(buffer, static_cast<vtkTypeUInt32>(str.size()));
+  buffer.append(str);
+}
+
+bool ReadBinaryValue(const char*& data, const char* end, vtkTypeUInt32& value)
+{
+  if (static_cast<size_t>(end - data) < sizeof(value))
+  {
+    return false;
+  }
+  memcpy(&value, data, sizeof(value));
+  data += sizeof(value);
+  return true;
+}
+
+bool ReadBinaryString(const char*& data, const char* end, std::string& str)
+{
+  vtkTypeUInt32 length;
+  if (!ReadBinaryValue(data, end, length) || static_cast<size_t>(end - data) < length)
+  {
+    return false;
+  }
+  str.assign(data, length);
+  data += length;
+  return true;
+}
+}
+
+//----------------------------------------------------------------------------
+void vtkPVXMLElement::SetUseLookupIndices(bool value)
+{
+  UseLookupIndices = value;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVXMLElement::GetUseLookupIndices()
+{
+  return UseLookupIndices;
+}
+
 //----------------------------------------------------------------------------
 vtkPVXMLElement::vtkPVXMLElement()
 {
@@ -132,8 +334,7 @@ void vtkPVXMLElement::AddAttribute(const char* attrName, const char* attrValue)
     return;
   }
 
-  this->Internal->AttributeNames.push_back(attrName);
-  this->Internal->AttributeValues.push_back(attrValue);
+  this->Internal->AddAttribute(attrName, attrValue);
 }
 
 //----------------------------------------------------------------------------
@@ -144,16 +345,12 @@ void vtkPVXMLElement::SetAttribute(const char* attrName, const char* attrValue)
     return;
   }
 
-  // iterate over the names, and find if the attribute name exists.
-  size_t numAttributes = this->Internal->AttributeNames.size();
-  size_t i;
-  for (i = 0; i < numAttributes; ++i)
+  // find if the attribute name exists.
+  const size_t i = this->Internal->FindAttribute(attrName);
+  if (i != vtkPVXMLElementInternals::NotFound)
   {
-    if (strcmp(this->Internal->AttributeNames[i].c_str(), attrName) == 0)
-    {
-      this->Internal->AttributeValues[i] = attrValue;
-      return;
-    }
+    this->Internal->AttributeValues[i] = attrValue;
+    return;
   }
   // add the attribute.
   this->AddAttribute(attrName, attrValue);
@@ -164,6 +361,7 @@ void vtkPVXMLElement::ReadXMLAttributes(const char** atts)
 {
   this->Internal->AttributeNames.clear();
   this->Internal->AttributeValues.clear();
+  this->Internal->AttributeIndex.clear();
 
   if (atts)
   {
@@ -187,6 +385,7 @@ void vtkPVXMLElement::ReadXMLAttributes(const char** atts)
 void vtkPVXMLElement::RemoveAllNestedElements()
 {
   this->Internal->NestedElements.clear();
+  this->Internal->UpdateNestedElementIndex();
 }
 
 //----------------------------------------------------------------------------
@@ -199,6 +398,7 @@ void vtkPVXMLElement::RemoveNestedElement(vtkPVXMLElement* element)
     if (iter->GetPointer() == element)
     {
       this->Internal->NestedElements.erase(iter);
+      this->Internal->UpdateNestedElementIndex();
       break;
     }
   }
@@ -213,6 +413,7 @@ void vtkPVXMLElement::ReplaceNestedElement(
     if (elem.GetPointer() == elementToReplace)
     {
       elem = element;
+      this->Internal->UpdateNestedElementIndex();
       break;
     }
   }
@@ -231,7 +432,7 @@ void vtkPVXMLElement::AddNestedElement(vtkPVXMLElement* element, int setParent)
   {
     element->SetParent(this);
   }
-  this->Internal->NestedElements.push_back(element);
+  this->Internal->AddNestedElement(element);
 }
 
 //----------------------------------------------------------------------------
@@ -243,16 +444,9 @@ void vtkPVXMLElement::AddCharacterData(const char* data, int length)
 //----------------------------------------------------------------------------
 const char* vtkPVXMLElement::GetAttributeOrDefault(const char* name, const char* notFound)
 {
-  size_t numAttributes = this->Internal->AttributeNames.size();
-  size_t i;
-  for (i = 0; i < numAttributes; ++i)
-  {
-    if (strcmp(this->Internal->AttributeNames[i].c_str(), name) == 0)
-    {
-      return this->Internal->AttributeValues[i].c_str();
-    }
-  }
-  return notFound;
+  const size_t i = this->Internal->FindAttribute(name);
+  return i != vtkPVXMLElementInternals::NotFound ? this->Internal->AttributeValues[i].c_str()
+                                                 : notFound;
 }
 //----------------------------------------------------------------------------
 const char* vtkPVXMLElement::GetCharacterData()
@@ -352,17 +546,7 @@ vtkPVXMLElement* vtkPVXMLElement::LookupElement(const char* id)
 //----------------------------------------------------------------------------
 vtkPVXMLElement* vtkPVXMLElement::FindNestedElement(const char* id)
 {
-  size_t numberOfNestedElements = this->Internal->NestedElements.size();
-  size_t i;
-  for (i = 0; i < numberOfNestedElements; ++i)
-  {
-    const char* nid = this->Internal->NestedElements[i]->GetId();
-    if (nid && strcmp(nid, id) == 0)
-    {
-      return this->Internal->NestedElements[i];
-    }
-  }
-  return nullptr;
+  return id ? this->Internal->FindNestedElement(id) : nullptr;
 }
 
 //----------------------------------------------------------------------------
@@ -395,20 +579,15 @@ vtkPVXMLElement* vtkPVXMLElement::LookupElementInScope(const char* id)
   const char* end = id;
   while (*end && (*end != '.'))
     ++end;
-  unsigned int len = end - id;
-  char* name = new char[len + 1];
-  strncpy(name, id, len);
-  name[len] = '\0';
+  const std::string name(id, end - id);
 
   // Find the qualifier in this scope.
-  vtkPVXMLElement* next = this->FindNestedElement(name);
+  vtkPVXMLElement* next = this->FindNestedElement(name.c_str());
   if (next && (*end == '.'))
   {
     // Lookup rest of qualifiers in nested scope.
     next = next->LookupElementInScope(end + 1);
   }
-
-  delete[] name;
   return next;
 }
 
@@ -419,25 +598,20 @@ vtkPVXMLElement* vtkPVXMLElement::LookupElementUpScope(const char* id)
   const char* end = id;
   while (*end && (*end != '.'))
     ++end;
-  unsigned int len = end - id;
-  char* name = new char[len + 1];
-  strncpy(name, id, len);
-  name[len] = '\0';
+  const std::string name(id, end - id);
 
   // Find most closely nested occurrence of first qualifier.
   vtkPVXMLElement* curScope = this;
   vtkPVXMLElement* start = nullptr;
   while (curScope && !start)
   {
-    start = curScope->FindNestedElement(name);
+    start = curScope->FindNestedElement(name.c_str());
     curScope = curScope->GetParent();
   }
   if (start && (*end == '.'))
   {
     start = start->LookupElementInScope(end + 1);
   }
-
-  delete[] name;
   return start;
 }
 
@@ -699,6 +873,7 @@ void vtkPVXMLElement::Merge(vtkPVXMLElement* element, const char* attributeName)
       newElement->SetId((*iter)->GetId());
       newElement->Internal->AttributeNames = (*iter)->Internal->AttributeNames;
       newElement->Internal->AttributeValues = (*iter)->Internal->AttributeValues;
+      newElement->Internal->UpdateAttributeIndex();
       this->AddNestedElement(newElement);
       newElement->Merge(*iter, attributeName);
     }
@@ -712,6 +887,11 @@ void vtkPVXMLElement::CopyTo(vtkPVXMLElement* other)
   other->SetId(GetId());
   other->Internal->AttributeNames = this->Internal->AttributeNames;
   other->Internal->AttributeValues = this->Internal->AttributeValues;
+  other->Internal->UpdateAttributeIndex();
+  if (other->Parent)
+  {
+    other->Parent->Internal->UpdateNestedElementIndex();
+  }
   other->AddCharacterData(
     this->Internal->CharacterData.c_str(), static_cast<int>(this->Internal->CharacterData.size()));
 
@@ -733,6 +913,11 @@ void vtkPVXMLElement::CopyAttributesTo(vtkPVXMLElement* other)
   other->SetId(GetId());
   other->Internal->AttributeNames = this->Internal->AttributeNames;
   other->Internal->AttributeValues = this->Internal->AttributeValues;
+  other->Internal->UpdateAttributeIndex();
+  if (other->Parent)
+  {
+    other->Parent->Internal->UpdateNestedElementIndex();
+  }
   other->AddCharacterData(
     this->Internal->CharacterData.c_str(), static_cast<int>(this->Internal->CharacterData.size()));
 }
@@ -766,6 +951,7 @@ void vtkPVXMLElement::RemoveAttribute(const char* name)
     {
       this->Internal->AttributeNames.erase(nameIterator);
       this->Internal->AttributeValues.erase(valueIterator);
+      this->Internal->UpdateAttributeIndex();
       return;
     }
     nameIterator++;
@@ -774,3 +960,102 @@ void vtkPVXMLElement::RemoveAttribute(const char* name)
 }
 
 //----------------------------------------------------------------------------
+void vtkPVXMLElement::WriteBinary(std::string& buffer)
+{
+  WriteBinaryValue(buffer, (this->Name ? BINARY_HAS_NAME : 0) | (this->Id ? BINARY_HAS_ID : 0));
+  if (this->Name)
+  {
+    WriteBinaryString(buffer, this->Name);
+  }
+  if (this->Id)
+  {
+    WriteBinaryString(buffer, this->Id);
+  }
+  const size_t numAttributes = this->Internal->AttributeNames.size();
+  WriteBinaryValue(buffer, static_cast<vtkTypeUInt32>(numAttributes));
+  for (size_t i = 0; i < numAttributes; ++i)
+  {
+    WriteBinaryString(buffer, this->Internal->AttributeNames[i]);
+    WriteBinaryString(buffer, this->Internal->AttributeValues[i]);
+  }
+  WriteBinaryString(buffer, this->Internal->CharacterData);
+  WriteBinaryValue(buffer, static_cast<vtkTypeUInt32>(this->Internal->NestedElements.size()));
+  for (auto& nested : this->Internal->NestedElements)
+  {
+    nested->WriteBinary(buffer);
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkPVXMLElement> vtkPVXMLElement::ReadBinary(const char* data, size_t length)
+{
+  auto element = vtkSmartPointer<vtkPVXMLElement>::New();
+  if (!data || !element->ReadBinaryContents(data, data + length))
+  {
+    return nullptr;
+  }
+  return element;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVXMLElement::ReadBinaryContents(const char*& data, const char* end)
+{
+  vtkTypeUInt32 flags;
+  std::string str;
+  if (!ReadBinaryValue(data, end, flags))
+  {
+    return false;
+  }
+  if (flags & BINARY_HAS_NAME)
+  {
+    if (!ReadBinaryString(data, end, str))
+    {
+      return false;
+    }
+    this->SetName(str.c_str());
+  }
+  if (flags & BINARY_HAS_ID)
+  {
+    if (!ReadBinaryString(data, end, str))
+    {
+      return false;
+    }
+    this->SetId(str.c_str());
+  }
+
+  vtkTypeUInt32 numAttributes;
+  // each attribute takes at least two lengths.
+  if (!ReadBinaryValue(data, end, numAttributes) ||
+    numAttributes > static_cast<size_t>(end - data) / (2 * sizeof(vtkTypeUInt32)))
+  {
+    return false;
+  }
+  this->Internal->AttributeNames.resize(numAttributes);
+  this->Internal->AttributeValues.resize(numAttributes);
+  for (vtkTypeUInt32 i = 0; i < numAttributes; ++i)
+  {
+    if (!ReadBinaryString(data, end, this->Internal->AttributeNames[i]) ||
+      !ReadBinaryString(data, end, this->Internal->AttributeValues[i]))
+    {
+      return false;
+    }
+  }
+  this->Internal->UpdateAttributeIndex();
+
+  vtkTypeUInt32 numNested;
+  if (!ReadBinaryString(data, end, this->Internal->CharacterData) ||
+    !ReadBinaryValue(data, end, numNested))
+  {
+    return false;
+  }
+  for (vtkTypeUInt32 i = 0; i < numNested; ++i)
+  {
+    vtkNew<vtkPVXMLElement> nested;
+    if (!nested->ReadBinaryContents(data, end))
+    {
+      return false;
+    }
+    this->AddNestedElement(nested);
+  }
+  return true;
+}
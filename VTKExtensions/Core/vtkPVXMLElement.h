@@ -12,6 +12,7 @@
 
 #include "vtkObject.h"
 #include "vtkPVVTKExtensionsCoreModule.h" // needed for export macro
+#include "vtkSmartPointer.h"              // needed for vtkSmartPointer.
 
 #include <string> // for std::string
 
@@ -251,6 +252,32 @@ public:
    */
   void CopyAttributesTo(vtkPVXMLElement* other);
 
+  ///@{
+  /**
+   * Serialize this element and its nested elements in a compact binary form,
+   * appended to `buffer`, and create an element back from it. Reading this
+   * form is much faster than parsing XML, but it is only meant for caches
+   * written and read by the same build: integers are stored in the native
+   * byte order. ReadBinary() returns nullptr if `data` is truncated or
+   * invalid.
+   */
+  void WriteBinary(std::string& buffer);
+  static vtkSmartPointer<vtkPVXMLElement> ReadBinary(const char* data, size_t length);
+  ///@}
+
+  ///@{
+  /**
+   * When set, elements with many attributes or nested elements look them up
+   * by name or by id using hash tables, kept up to date as they are added,
+   * instead of comparing with each of them. This speeds up GetAttribute(),
+   * FindNestedElement() and LookupElement() on large documents such as state
+   * files. Lookups do not modify the element, so they can be done from several
+   * threads. The results do not depend on this setting. Default is true.
+   */
+  static void SetUseLookupIndices(bool);
+  static bool GetUseLookupIndices();
+  ///@}
+
 protected:
   vtkPVXMLElement();
   ~vtkPVXMLElement() override;
@@ -272,6 +299,7 @@ protected:
   vtkPVXMLElement* LookupElementInScope(const char* id);
   vtkPVXMLElement* LookupElementUpScope(const char* id);
   void SetParent(vtkPVXMLElement* parent);
+  bool ReadBinaryContents(const char*& data, const char* end);
 
   friend class vtkPVXMLParser;
 
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "HaloFinderTestHelpers.h"
+
+#include "vtkSMPTools.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+
+namespace
+{
+const double RL = 128.0;
+const int NP = 128;
+
+double TimeFindCenters(vtkUnstructuredGrid* input, int largeHaloThreshold, int numThreads)
+{
+  vtkSMPTools::Initialize(numThreads);
+  vtkNew<vtkPANLHaloFinder> haloFinder;
+  haloFinder->SetInputData(input);
+  haloFinder->SetRL(RL);
+  haloFinder->SetNP(NP);
+  haloFinder->SetPMin(100);
+  haloFinder->SetCenterFindingMode(vtkPANLHaloFinder::MOST_BOUND_PARTICLE);
+  haloFinder->SetLargeHaloThreshold(largeHaloThreshold);
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  haloFinder->Update();
+  timer->StopTimer();
+  return timer->GetElapsedTime();
+}
+
+int runCenterFindingBenchmark(int argc, char* argv[])
+{
+  int numHalos = 64;
+  int numParticles = 100000;
+  int threshold = 1;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument("--halos", argT::EQUAL_ARGUMENT, &numHalos, "Number of halos.");
+  arg.AddArgument("--particles", argT::EQUAL_ARGUMENT, &numParticles,
+    "Number of particles in the smallest halo.");
+  arg.AddArgument("--threshold", argT::EQUAL_ARGUMENT, &threshold,
+    "LargeHaloThreshold of the run using the tree estimate.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return 0;
+  }
+
+  vtkSmartPointer<vtkUnstructuredGrid> input =
+    HaloFinderTestHelpers::MakeNFWHalos(numHalos, numParticles, RL);
+
+  const double serialTime = TimeFindCenters(input, 0, 1);
+  const double smpTime = TimeFindCenters(input, 0, 0);
+  const double treeTime = TimeFindCenters(input, threshold, 0);
+
+  cout << "Halos: " << numHalos << ", particles: " << input->GetNumberOfPoints()
+       << ", SMP backend: " << vtkSMPTools::GetBackend() << endl;
+  cout << "Serial: " << serialTime << "s, SMP: " << smpTime << "s, SMP with tree (threshold "
+       << threshold << "): " << treeTime << "s" << endl;
+  return 1;
+}
+}
+
+// Times the most bound particle center finding of vtkPANLHaloFinder on
+// synthetic NFW halos, serially, with the SMP tools, and with the tree estimate
+// for the halos above the given threshold.
+int BenchmarkHaloFinderCenterFinding(int argc, char* argv[])
+{
+  return HaloFinderTestHelpers::RunWithMPIController(argc, argv, runCenterFindingBenchmark);
+}
@@ -4,19 +4,27 @@
 
 #include "vtkActor.h"
 #include "vtkCompositePolyDataMapper.h"
+#include "vtkFloatArray.h"
+#include "vtkMPIController.h"
 #include "vtkMaskPoints.h"
 #include "vtkNew.h"
 #include "vtkPANLHaloFinder.h"
 #include "vtkPGenericIOReader.h"
 #include "vtkPointData.h"
+#include "vtkPoints.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderWindowInteractor.h"
 #include "vtkRenderer.h"
 #include "vtkSmartPointer.h"
 #include "vtkTestUtilities.h"
 #include "vtkThreshold.h"
+#include "vtkTypeInt64Array.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <vtk_mpi.h>
+
+#include <cmath>
+#include <random>
 #include <set>
 
 namespace HaloFinderTestHelpers
@@ -92,6 +100,95 @@ inline bool pointDataHasTheseArrays(vtkPointData* pd, const std::set<std::string
   return true;
 }
 
+inline double NFWMass(double x)
+{
+  return std::log(1.0 + x) - x / (1.0 + x);
+}
+
+// Generate `numHalos` halos following an NFW profile of concentration 5 and
+// virial radius 2, on a regular grid of halo centers in a box of size `rl`.
+inline vtkSmartPointer<vtkUnstructuredGrid> MakeNFWHalos(int numHalos, int numParticles, double rl)
+{
+  const double concentration = 5.0;
+  const double rvir = 2.0;
+  const double rs = rvir / concentration;
+  const int haloesPerAxis = static_cast<int>(std::ceil(std::cbrt(numHalos)));
+  const double spacing = rl / haloesPerAxis;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::normal_distribution<double> normal(0.0, 1.0);
+
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkFloatArray> vx, vy, vz;
+  vtkNew<vtkTypeInt64Array> id;
+  vx->SetName("vx");
+  vy->SetName("vy");
+  vz->SetName("vz");
+  id->SetName("id");
+  vtkIdType tag = 0;
+  for (int halo = 0; halo < numHalos; ++halo)
+  {
+    const int i = halo % haloesPerAxis;
+    const int j = (halo / haloesPerAxis) % haloesPerAxis;
+    const int k = halo / (haloesPerAxis * haloesPerAxis);
+    const double center[3] = { (i + 0.5) * spacing, (j + 0.5) * spacing, (k + 0.5) * spacing };
+    // Halos get between 1 and 10 times `numParticles` particles.
+    const int count = numParticles * (1 + halo % 10);
+    for (int p = 0; p < count; ++p)
+    {
+      // Invert the enclosed mass profile by bisection.
+      const double target = uniform(generator) * NFWMass(concentration);
+      double low = 0.0, high = concentration;
+      for (int iter = 0; iter < 40; ++iter)
+      {
+        const double mid = 0.5 * (low + high);
+        if (NFWMass(mid) < target)
+        {
+          low = mid;
+        }
+        else
+        {
+          high = mid;
+        }
+      }
+      const double r = 0.5 * (low + high) * rs;
+      double dir[3] = { normal(generator), normal(generator), normal(generator) };
+      const double norm = std::sqrt(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+      points->InsertNextPoint(center[0] + r * dir[0] / norm, center[1] + r * dir[1] / norm,
+        center[2] + r * dir[2] / norm);
+      vx->InsertNextValue(normal(generator));
+      vy->InsertNextValue(normal(generator));
+      vz->InsertNextValue(normal(generator));
+      id->InsertNextValue(tag++);
+    }
+  }
+
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  grid->GetPointData()->AddArray(vx);
+  grid->GetPointData()->AddArray(vy);
+  grid->GetPointData()->AddArray(vz);
+  grid->GetPointData()->AddArray(id);
+  return grid;
+}
+
+// Run `test` with an MPI controller set as the global controller, as the halo
+// finders require. `test` returns 1 on success.
+inline int RunWithMPIController(int argc, char* argv[], int (*test)(int, char*[]))
+{
+  MPI_Init(&argc, &argv);
+
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize();
+  vtkMultiProcessController::SetGlobalController(controller.GetPointer());
+
+  int retVal = test(argc, argv);
+
+  controller->Finalize();
+  return !retVal;
+}
+
 inline HaloFinderTestVTKObjects SetupHaloFinderTest(int argc, char* argv[],
   vtkPANLHaloFinder::CenterFindingType centerFinding = vtkPANLHaloFinder::NONE,
   bool findSubhalos = false)
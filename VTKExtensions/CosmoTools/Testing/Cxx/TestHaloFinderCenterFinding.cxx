@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "HaloFinderTestHelpers.h"
+
+#include "vtkDataArray.h"
+#include "vtkSMPTools.h"
+
+namespace
+{
+const double RL = 128.0;
+const int NP = 128;
+
+vtkSmartPointer<vtkDataArray> FindCenters(
+  vtkUnstructuredGrid* input, int largeHaloThreshold, int numThreads)
+{
+  vtkSMPTools::Initialize(numThreads);
+  vtkNew<vtkPANLHaloFinder> haloFinder;
+  haloFinder->SetInputData(input);
+  haloFinder->SetRL(RL);
+  haloFinder->SetNP(NP);
+  haloFinder->SetPMin(100);
+  haloFinder->SetCenterFindingMode(vtkPANLHaloFinder::MOST_BOUND_PARTICLE);
+  haloFinder->SetLargeHaloThreshold(largeHaloThreshold);
+  haloFinder->Update();
+  return haloFinder->GetOutput(1)->GetPointData()->GetArray("fof_center");
+}
+
+int runCenterFindingTest(int, char*[])
+{
+  const int numHalos = 8;
+  const int numParticles = 2000;
+  vtkSmartPointer<vtkUnstructuredGrid> input =
+    HaloFinderTestHelpers::MakeNFWHalos(numHalos, numParticles, RL);
+
+  vtkSmartPointer<vtkDataArray> serial = FindCenters(input, 0, 1);
+  vtkSmartPointer<vtkDataArray> smp = FindCenters(input, 0, 0);
+  vtkSmartPointer<vtkDataArray> tree = FindCenters(input, 1, 0);
+  // The sparse outskirts of halos may not be linked, but every halo must be found.
+  if (!serial || !smp || !tree || serial->GetNumberOfTuples() < numHalos ||
+    smp->GetNumberOfTuples() != serial->GetNumberOfTuples() ||
+    tree->GetNumberOfTuples() != serial->GetNumberOfTuples())
+  {
+    cerr << "ERROR: wrong number of halo centers." << endl;
+    return 0;
+  }
+
+  // Processing halos in parallel must not change the centers, and the tree
+  // estimate must find the same most bound particle, up to ties between
+  // particles very close to each other.
+  for (vtkIdType halo = 0; halo < serial->GetNumberOfTuples(); ++halo)
+  {
+    double c1[3], c2[3], c3[3];
+    serial->GetTuple(halo, c1);
+    smp->GetTuple(halo, c2);
+    tree->GetTuple(halo, c3);
+    if (c1[0] != c2[0] || c1[1] != c2[1] || c1[2] != c2[2])
+    {
+      cerr << "ERROR: center of halo " << halo << " differs in parallel." << endl;
+      return 0;
+    }
+    const double dist2 = (c1[0] - c3[0]) * (c1[0] - c3[0]) + (c1[1] - c3[1]) * (c1[1] - c3[1]) +
+      (c1[2] - c3[2]) * (c1[2] - c3[2]);
+    if (dist2 > 1e-4)
+    {
+      cerr << "ERROR: center of halo " << halo << " differs with the tree estimate." << endl;
+      return 0;
+    }
+  }
+
+  return 1;
+}
+}
+
+int TestHaloFinderCenterFinding(int argc, char* argv[])
+{
+  return HaloFinderTestHelpers::RunWithMPIController(argc, argv, runCenterFindingTest);
+}
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "HaloFinderTestHelpers.h"
+
+#include "vtkDataArray.h"
+#include "vtkSMPTools.h"
+#include "vtkTestingObjectFactory.h"
+
+#include <string>
+
+namespace
+{
+const double RL = 128.0;
+const int NP = 128;
+
+vtkSmartPointer<vtkPANLHaloFinder> FindHalos(vtkUnstructuredGrid* input, int numThreads)
+{
+  auto haloFinder = vtkSmartPointer<vtkPANLHaloFinder>::New();
+  haloFinder->SetInputData(input);
+  haloFinder->SetRL(RL);
+  haloFinder->SetNP(NP);
+  haloFinder->SetPMin(100);
+  haloFinder->SetNumberOfThreads(numThreads);
+  haloFinder->Update();
+  return haloFinder;
+}
+
+bool CompareArrays(vtkPointData* serial, vtkPointData* threaded, const char* name)
+{
+  vtkDataArray* array1 = serial->GetArray(name);
+  vtkDataArray* array2 = threaded->GetArray(name);
+  if (!array1 || !array2 || array1->GetNumberOfTuples() != array2->GetNumberOfTuples())
+  {
+    cerr << "ERROR: " << name << " arrays differ in size." << endl;
+    return false;
+  }
+  for (vtkIdType id = 0; id < array1->GetNumberOfTuples(); ++id)
+  {
+    if (array1->GetTuple1(id) != array2->GetTuple1(id))
+    {
+      cerr << "ERROR: " << name << " differs at " << id << "." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int runThreadsTest(int, char*[])
+{
+  const int numHalos = 27;
+  const int numParticles = 2000;
+  vtkSmartPointer<vtkUnstructuredGrid> input =
+    HaloFinderTestHelpers::MakeNFWHalos(numHalos, numParticles, RL);
+
+  vtkSmartPointer<vtkPANLHaloFinder> serial = FindHalos(input, 1);
+  vtkSmartPointer<vtkPANLHaloFinder> threaded = FindHalos(input, 0);
+
+  // Halos and the halo of each particle must be the same.
+  if (serial->GetOutput(1)->GetNumberOfPoints() < numHalos ||
+    !CompareArrays(serial->GetOutput(0)->GetPointData(), threaded->GetOutput(0)->GetPointData(),
+      "fof_halo_tag") ||
+    !CompareArrays(serial->GetOutput(1)->GetPointData(), threaded->GetOutput(1)->GetPointData(),
+      "fof_halo_tag") ||
+    !CompareArrays(serial->GetOutput(1)->GetPointData(), threaded->GetOutput(1)->GetPointData(),
+      "fof_halo_count"))
+  {
+    return 0;
+  }
+
+  return 1;
+}
+}
+
+int TestHaloFinderThreads(int argc, char* argv[])
+{
+  // NumberOfThreads 0 uses as many threads as the SMP backend, so the
+  // threaded pass is not run with the sequential backend.
+  if (std::string(vtkSMPTools::GetBackend()) == "Sequential" ||
+    vtkSMPTools::GetEstimatedNumberOfThreads() < 2)
+  {
+    cout << "This test requires an SMP backend with more than one thread." << endl;
+    return VTK_SKIP_RETURN_CODE;
+  }
+  return HaloFinderTestHelpers::RunWithMPIController(argc, argv, runThreadsTest);
+}
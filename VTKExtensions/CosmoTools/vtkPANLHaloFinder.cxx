@@ -14,6 +14,8 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkTypeInt64Array.h"
 #include "vtkUnstructuredGrid.h"
 
@@ -26,6 +28,7 @@
 #include "SubHaloFinder.h"
 
 #include <cassert>
+#include <memory>
 #include <vector>
 
 namespace
@@ -51,20 +54,16 @@ public:
         maxNumParticles = haloCounts[i];
       }
     }
-    this->actualIndex.resize(maxNumParticles);
-    this->xLoc.resize(maxNumParticles);
-    this->yLoc.resize(maxNumParticles);
-    this->zLoc.resize(maxNumParticles);
-    this->xVel.resize(maxNumParticles);
-    this->yVel.resize(maxNumParticles);
-    this->zVel.resize(maxNumParticles);
-    this->mass.resize(maxNumParticles);
-    this->id.resize(maxNumParticles);
+    this->Resize(maxNumParticles);
   }
 
   void SetCurrentHalo(int haloIdx)
   {
     this->size = this->counts[haloIdx];
+    if (static_cast<size_t>(this->size) > this->actualIndex.size())
+    {
+      this->Resize(this->size);
+    }
 
     fofProperties->extractInformation(haloIdx, &this->actualIndex[0], &this->xLoc[0],
       &this->yLoc[0], &this->zLoc[0], &this->xVel[0], &this->yVel[0], &this->zVel[0],
@@ -94,6 +93,19 @@ public:
   int GetNumberOfParticlesInCurrentHalo() { return this->size; }
 
 private:
+  void Resize(int numParticles)
+  {
+    this->actualIndex.resize(numParticles);
+    this->xLoc.resize(numParticles);
+    this->yLoc.resize(numParticles);
+    this->zLoc.resize(numParticles);
+    this->xVel.resize(numParticles);
+    this->yVel.resize(numParticles);
+    this->zVel.resize(numParticles);
+    this->mass.resize(numParticles);
+    this->id.resize(numParticles);
+  }
+
   int* counts;
   cosmotk::FOFHaloProperties* fofProperties;
 
@@ -203,6 +215,7 @@ vtkPANLHaloFinder::vtkPANLHaloFinder()
   this->BetaFactor = 0.0;
   this->NP = 1024;
   this->NMin = 1;
+  this->NumberOfThreads = 1;
   this->PMin = 10000;
   this->MinFOFSubhaloSize = 10000;
   this->MinCandidateSize = 200;
@@ -210,6 +223,7 @@ vtkPANLHaloFinder::vtkPANLHaloFinder()
   this->NumNeighbors = 20;
 
   this->CenterFindingMode = NONE;
+  this->LargeHaloThreshold = 0;
   this->SmoothingLength = 0.0;
   this->OmegaDM = 0.26627;
   this->OmegaNU = 0.0;
@@ -362,6 +376,8 @@ void vtkPANLHaloFinder::ExecuteHaloFinder(
   this->Internal->haloFinder = new cosmotk::CosmoHaloFinderP();
   this->Internal->haloFinder->setParameters(
     "", this->RL, this->DeadSize, this->NP, this->PMin, this->BB, this->NMin);
+  this->Internal->haloFinder->setNumberOfThreads(
+    this->NumberOfThreads > 0 ? this->NumberOfThreads : vtkSMPTools::GetEstimatedNumberOfThreads());
   this->Internal->haloFinder->setParticles(this->Internal->xx.size(), &this->Internal->xx[0],
     &this->Internal->yy[0], &this->Internal->zz[0], &this->Internal->vx[0], &this->Internal->vy[0],
     &this->Internal->vz[0], &this->Internal->potential[0], &this->Internal->tag[0],
@@ -646,7 +662,9 @@ void vtkPANLHaloFinder::ExecuteSubHaloFinder(
 void vtkPANLHaloFinder::FindCenters(
   vtkUnstructuredGrid* allParticles, vtkUnstructuredGrid* fofProperties)
 {
-  if (this->CenterFindingMode == vtkPANLHaloFinder::NONE)
+  if (this->CenterFindingMode != MOST_BOUND_PARTICLE &&
+    this->CenterFindingMode != MOST_CONNECTED_PARTICLE &&
+    this->CenterFindingMode != HIST_CENTER_FINDING)
   {
     return;
   }
@@ -661,9 +679,26 @@ void vtkPANLHaloFinder::FindCenters(
   centers->SetNumberOfComponents(3);
   centers->SetNumberOfTuples(numberOfFOFHalos);
 
-  ExtractHalo haloData(numberOfFOFHalos, fofHaloCount, this->Internal->fof);
+  // Halos are independent so small ones are processed in parallel, while
+  // large ones are processed one after the other using all the threads.
+  const int numThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  std::vector<int> smallHalos;
+  std::vector<int> largeHalos;
   for (int halo = 0; halo < numberOfFOFHalos; ++halo)
   {
+    if (this->CenterFindingMode == MOST_BOUND_PARTICLE && this->LargeHaloThreshold > 0 &&
+      fofHaloCount[halo] >= this->LargeHaloThreshold)
+    {
+      largeHalos.push_back(halo);
+    }
+    else
+    {
+      smallHalos.push_back(halo);
+    }
+  }
+
+  // Find the center of the current halo of `haloData` and store it in `centers`.
+  auto findCenter = [&](ExtractHalo& haloData, int halo, bool large) {
     haloData.SetCurrentHalo(halo);
     cosmotk::HaloCenterFinder centerFinder;
     haloData.SetParticles(centerFinder);
@@ -673,7 +708,11 @@ void vtkPANLHaloFinder::FindCenters(
     if (this->CenterFindingMode == MOST_BOUND_PARTICLE)
     {
       float minPotential;
-      if (haloData.GetNumberOfParticlesInCurrentHalo() < MBP_THRESHOLD)
+      if (large)
+      {
+        centerIndex = centerFinder.mostBoundParticleBHTree(&minPotential, numThreads);
+      }
+      else if (haloData.GetNumberOfParticlesInCurrentHalo() < MBP_THRESHOLD)
       {
         centerIndex = centerFinder.mostBoundParticleN2(&minPotential);
       }
@@ -693,23 +732,44 @@ void vtkPANLHaloFinder::FindCenters(
         centerIndex = centerFinder.mostConnectedParticleChainMesh();
       }
     }
-    else if (this->CenterFindingMode == HIST_CENTER_FINDING)
-    {
-      centerIndex = centerFinder.mostConnectedParticleHist();
-    }
     else
     {
-      return;
+      centerIndex = centerFinder.mostConnectedParticleHist();
     }
     float center[] = { 0.0, 0.0, 0.0 };
     if (centerIndex >= 0)
     {
-      double* point = allParticles->GetPoint(haloData.GetActualIndex(centerIndex));
+      double point[3];
+      allParticles->GetPoint(haloData.GetActualIndex(centerIndex), point);
       center[0] = point[0];
       center[1] = point[1];
       center[2] = point[2];
     }
     centers->SetTypedTuple(halo, center);
+  };
+
+  vtkSMPThreadLocal<std::shared_ptr<ExtractHalo>> localHaloData;
+  cosmotk::FOFHaloProperties* fof = this->Internal->fof;
+  vtkSMPTools::For(0, static_cast<vtkIdType>(smallHalos.size()), 1,
+    [&](vtkIdType begin, vtkIdType end) {
+      std::shared_ptr<ExtractHalo>& haloData = localHaloData.Local();
+      if (!haloData)
+      {
+        haloData = std::make_shared<ExtractHalo>(0, fofHaloCount, fof);
+      }
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        findCenter(*haloData, smallHalos[i], false);
+      }
+    });
+
+  if (!largeHalos.empty())
+  {
+    ExtractHalo haloData(0, fofHaloCount, fof);
+    for (int halo : largeHalos)
+    {
+      findCenter(haloData, halo, true);
+    }
   }
   fofProperties->GetPointData()->AddArray(centers.GetPointer());
 }
@@ -147,6 +147,18 @@ public:
   vtkGetMacro(NMin, int);
   ///@}
 
+  ///@{
+  /**
+   * Gets/Sets the number of threads used to find the friends-of-friends halos
+   * on each process.  0 uses as many threads as the SMP tools.  More than one
+   * thread is only used when NMin is 1.  The halos are the same, but the
+   * particles of a halo may be listed in a different order.
+   * Default: 1
+   */
+  vtkSetClampMacro(NumberOfThreads, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfThreads, int);
+  ///@}
+
   ///@{
   /**
    * Gets/Sets the minimum number of particles required for a halo candidate to
@@ -212,6 +224,21 @@ public:
   vtkGetMacro(CenterFindingMode, int);
   ///@}
 
+  ///@{
+  /**
+   * Gets/Sets the number of particles above which the most bound particle of
+   * a halo is found using a Barnes Hut estimate of the potential, with the
+   * actual potential only computed for the particles with the lowest
+   * estimates.  Such halos are processed one at a time using all the threads,
+   * while smaller halos are processed in parallel.  0 disables it.  The tree
+   * estimate may pick another particle than the exact search when particles
+   * have nearly the same potential, so it is not enabled by default.
+   * Default: 0
+   */
+  vtkSetClampMacro(LargeHaloThreshold, int, 0, VTK_INT_MAX);
+  vtkGetMacro(LargeHaloThreshold, int);
+  ///@}
+
   ///@{
   /**
    * Gets/Sets the smoothing length used by the center finders
@@ -288,6 +315,7 @@ protected:
   double BetaFactor;
   int NP;
   int NMin;
+  int NumberOfThreads;
   int PMin;
   long MinFOFSubhaloSize;
   int MinCandidateSize;
@@ -298,6 +326,7 @@ protected:
 
   // Center finding parameters
   int CenterFindingMode;
+  int LargeHaloThreshold;
   double SmoothingLength;
   double OmegaNU;
   double OmegaDM;
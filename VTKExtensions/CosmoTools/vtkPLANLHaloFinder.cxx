@@ -26,6 +26,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
@@ -146,6 +147,7 @@ vtkPLANLHaloFinder::vtkPLANLHaloFinder()
   this->Overlap = 5;
   this->BB = .2;
   this->PMin = 100;
+  this->NumberOfThreads = 1;
 
   this->ComputeSOD = 0;
   this->CenterFindingMethod = AVERAGE;
@@ -524,6 +526,8 @@ void vtkPLANLHaloFinder::ComputeFOFHalos(
 
   // STEP 2: Initialize halo-finder parameters
   this->HaloFinder->setParameters("", this->RL, this->Overlap, this->NP, this->PMin, this->BB);
+  this->HaloFinder->setNumberOfThreads(
+    this->NumberOfThreads > 0 ? this->NumberOfThreads : vtkSMPTools::GetEstimatedNumberOfThreads());
   this->HaloFinder->setParticles(this->Particles->xx.size(), &this->Particles->xx[0],
     &this->Particles->yy[0], &this->Particles->zz[0], &this->Particles->vx[0],
     &this->Particles->vy[0], &this->Particles->vz[0], &this->Particles->potential[0],
@@ -108,6 +108,17 @@ public:
   vtkGetMacro(BB, float);
   ///@}
 
+  ///@{
+  /**
+   * Specify the number of threads used to find the FOF halos on each process,
+   * 0 to use as many threads as the SMP tools.  The halos are the same, but
+   * the particles of a halo may be listed in a different order.
+   * (default 1)
+   */
+  vtkSetClampMacro(NumberOfThreads, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfThreads, int);
+  ///@}
+
   ///@{
   /**
    * Turn on calculation of SOD halos
@@ -255,6 +266,8 @@ protected:
   int PMin;      // The minimum particles for a halo
   float BB;      // The linking length
 
+  int NumberOfThreads; // Threads used to find FOF halos
+
   int CenterFindingMethod; // Halo center detection method
   int ComputeSOD;          // Turn on Spherical OverDensity (SOD) halos
 
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCellType.h"
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVGeometryFilter.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTimerLog.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+
+namespace
+{
+// A grid of `res`^3 hexahedra, offset along x by `offset`.
+vtkSmartPointer<vtkUnstructuredGrid> MakeUnstructuredGrid(int res, double offset)
+{
+  const int n = res + 1;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(n * n * n);
+  for (int k = 0; k < n; ++k)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        points->SetPoint(i + n * (j + n * k), offset + i, j, k);
+      }
+    }
+  }
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  grid->Allocate(res * res * res);
+  for (int k = 0; k < res; ++k)
+  {
+    for (int j = 0; j < res; ++j)
+    {
+      for (int i = 0; i < res; ++i)
+      {
+        const vtkIdType p0 = i + n * (j + n * k);
+        const vtkIdType ids[8] = { p0, p0 + 1, p0 + 1 + n, p0 + n, p0 + n * n, p0 + 1 + n * n,
+          p0 + 1 + n + n * n, p0 + n + n * n };
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, ids);
+      }
+    }
+  }
+  return grid;
+}
+
+vtkSmartPointer<vtkImageData> MakeImageData(int res, double offset)
+{
+  auto image = vtkSmartPointer<vtkImageData>::New();
+  image->SetDimensions(res + 1, res + 1, res + 1);
+  image->SetOrigin(offset, 0, 0);
+  return image;
+}
+
+vtkSmartPointer<vtkMultiBlockDataSet> MakeMultiBlock(int numBlocks, int res)
+{
+  auto mb = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  mb->SetNumberOfBlocks(numBlocks);
+  for (int cc = 0; cc < numBlocks; ++cc)
+  {
+    vtkSmartPointer<vtkDataSet> block;
+    if (cc % 2 == 0)
+    {
+      block = MakeUnstructuredGrid(res, 2.0 * res * cc);
+    }
+    else
+    {
+      block = MakeImageData(res, 2.0 * res * cc);
+    }
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("values");
+    values->SetNumberOfTuples(block->GetNumberOfPoints());
+    for (vtkIdType id = 0; id < block->GetNumberOfPoints(); ++id)
+    {
+      values->SetValue(id, cc + id);
+    }
+    block->GetPointData()->AddArray(values);
+    mb->SetBlock(cc, block);
+  }
+  return mb;
+}
+
+double TimeExecute(vtkMultiBlockDataSet* input, bool smp)
+{
+  vtkPVGeometryFilter::SetUseSMPBlockExecution(smp);
+  vtkNew<vtkPVGeometryFilter> filter;
+  filter->SetUseOutline(0);
+  filter->SetInputData(input);
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  filter->Update();
+  timer->StopTimer();
+  return timer->GetElapsedTime();
+}
+}
+
+// Times vtkPVGeometryFilter on a multiblock of small unstructured grids and
+// images, with the blocks executed one after the other and with vtkSMPTools.
+int BenchmarkPVGeometryFilterBlocks(int argc, char* argv[])
+{
+  int numBlocks = 10000;
+  int res = 4;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument("--blocks", argT::EQUAL_ARGUMENT, &numBlocks, "Number of blocks.");
+  arg.AddArgument("--resolution", argT::EQUAL_ARGUMENT, &res, "Number of cells per axis.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkSmartPointer<vtkMultiBlockDataSet> input = MakeMultiBlock(numBlocks, res);
+
+  const bool prevUseSMPBlockExecution = vtkPVGeometryFilter::GetUseSMPBlockExecution();
+  const double serialTime = TimeExecute(input, false);
+  const double smpTime = TimeExecute(input, true);
+  vtkPVGeometryFilter::SetUseSMPBlockExecution(prevUseSMPBlockExecution);
+
+  cout << "Blocks: " << numBlocks << ", SMP backend: " << vtkSMPTools::GetBackend() << endl;
+  cout << "Serial: " << serialTime << "s, SMP: " << smpTime << "s" << endl;
+  return EXIT_SUCCESS;
+}
@@ -10,10 +10,12 @@
 #include "vtkSmartPointer.h"
 #include "vtkSquirtCompressor.h"
 #include "vtkTesting.h"
+#include "vtkTiledLZ4Compressor.h"
 #include "vtkTimerLog.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkZlibImageCompressor.h"
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <vtksys/CommandLineArguments.hxx>
@@ -69,6 +71,77 @@ bool DoTest(Data& data, vtkImageCompressor* compressor, vtkUnsignedCharArray* in
   return true;
 }
 
+// Sends two frames through a pair of delta mode compressors, the second one
+// only differing from the first on a few pixels, and checks that the
+// decompressed frames match the inputs and that the delta frame is smaller.
+bool DoDeltaTest(Data& data, vtkUnsignedCharArray* input)
+{
+  vtkNew<vtkTiledLZ4Compressor> sender;
+  sender->SetDeltaMode(true);
+  sender->SetLossLessMode(1);
+  sender->SetTileSize(16 * 1024);
+  vtkNew<vtkTiledLZ4Compressor> receiver;
+  receiver->RestoreConfiguration(sender->SaveConfiguration());
+
+  vtkNew<vtkUnsignedCharArray> frame;
+  frame->DeepCopy(input);
+  vtkIdType sizes[2] = { 0, 0 };
+  for (int cc = 0; cc < 2; ++cc)
+  {
+    if (cc == 1)
+    {
+      const vtkIdType numValues = frame->GetNumberOfValues();
+      for (vtkIdType idx = numValues / 3; idx < std::min(numValues, numValues / 3 + 64); ++idx)
+      {
+        frame->SetValue(idx, static_cast<unsigned char>(frame->GetValue(idx) + 1));
+      }
+    }
+
+    vtkNew<vtkUnsignedCharArray> compressed;
+    vtkNew<vtkUnsignedCharArray> decompressed;
+    decompressed->SetNumberOfComponents(frame->GetNumberOfComponents());
+    decompressed->SetNumberOfTuples(frame->GetNumberOfTuples());
+
+    vtkNew<vtkTimerLog> timer;
+    sender->SetInput(frame);
+    sender->SetOutput(compressed);
+    timer->StartTimer();
+    if (!sender->Compress())
+    {
+      return false;
+    }
+    timer->StopTimer();
+    data.CompressTime += timer->GetElapsedTime();
+
+    receiver->SetInput(compressed);
+    receiver->SetOutput(decompressed);
+    timer->StartTimer();
+    if (!receiver->Decompress())
+    {
+      return false;
+    }
+    timer->StopTimer();
+    data.DecompressTime += timer->GetElapsedTime();
+
+    if (!std::equal(frame->GetPointer(0), frame->GetPointer(0) + frame->GetNumberOfValues(),
+          decompressed->GetPointer(0)))
+    {
+      cerr << "ERROR: decompressed frame " << cc << " does not match its input." << endl;
+      return false;
+    }
+    sizes[cc] = compressed->GetNumberOfValues();
+  }
+
+  if (sizes[1] >= sizes[0])
+  {
+    cerr << "ERROR: delta frame (" << sizes[1] << ") is not smaller than the key frame ("
+         << sizes[0] << ")." << endl;
+    return false;
+  }
+  data.CompressedSize = sizes[1];
+  return true;
+}
+
 int TestImageCompressors(int argc, char* argv[])
 {
   int max_count = 10;
@@ -133,6 +206,26 @@ int TestImageCompressors(int argc, char* argv[])
       }
     }
 
+    vtkNew<vtkTiledLZ4Compressor> tiledLZ4;
+    tiledLZ4->SetQuality(0);
+    if (!DoTest(datas["Tiled LZ4 (quality: 0)"], tiledLZ4.Get(), input))
+    {
+      return TEST_FAILED;
+    }
+    if (test_lossy)
+    {
+      tiledLZ4->SetQuality(3);
+      tiledLZ4->SetLossLessMode(0);
+      if (!DoTest(datas["Tiled LZ4 (quality: 3)"], tiledLZ4.Get(), input))
+      {
+        return TEST_FAILED;
+      }
+    }
+    if (!DoDeltaTest(datas["Tiled LZ4 (delta frame)"], input))
+    {
+      return TEST_FAILED;
+    }
+
     vtkNew<vtkSquirtCompressor> squirt;
     squirt->SetSquirtLevel(0);
     if (!DoTest(datas["SQUIRT (squirt-level: 0)"], squirt.Get(), input))
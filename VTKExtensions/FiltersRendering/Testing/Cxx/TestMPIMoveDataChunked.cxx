@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCellArray.h"
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkIntArray.h"
+#include "vtkMPIController.h"
+#include "vtkMPIMoveData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+
+namespace
+{
+// A chain of line segments whose size depends on the rank so that every
+// piece has a different payload, none of them a multiple of the chunk size.
+vtkSmartPointer<vtkPolyData> MakePiece(int rank)
+{
+  const vtkIdType numPts = 1000 + 137 * rank;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numPts);
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("scalars");
+  scalars->SetNumberOfTuples(numPts);
+  vtkNew<vtkIntArray> ids;
+  ids->SetName("ids");
+  ids->SetNumberOfComponents(2);
+  ids->SetNumberOfTuples(numPts);
+  vtkNew<vtkCellArray> lines;
+  for (vtkIdType cc = 0; cc < numPts; ++cc)
+  {
+    points->SetPoint(cc, cc, rank, 0.5 * cc);
+    scalars->SetValue(cc, rank * 1000.0 + cc / 7.0);
+    ids->SetTypedComponent(cc, 0, rank);
+    ids->SetTypedComponent(cc, 1, static_cast<int>(cc));
+    if (cc > 0)
+    {
+      const vtkIdType line[2] = { cc - 1, cc };
+      lines->InsertNextCell(2, line);
+    }
+  }
+  auto pd = vtkSmartPointer<vtkPolyData>::New();
+  pd->SetPoints(points);
+  pd->SetLines(lines);
+  pd->GetPointData()->AddArray(scalars);
+  pd->GetPointData()->AddArray(ids);
+  return pd;
+}
+
+vtkSmartPointer<vtkPolyData> Move(
+  vtkMultiProcessController* controller, vtkPolyData* input, bool clone, bool chunked)
+{
+  vtkMPIMoveData::SetUseChunkedMarshaling(chunked);
+  vtkNew<vtkMPIMoveData> mover;
+  mover->SetController(controller);
+  mover->SetServerToDataServer();
+  mover->SetOutputDataType(VTK_POLY_DATA);
+  if (clone)
+  {
+    mover->SetMoveModeToClone();
+  }
+  else
+  {
+    mover->SetMoveModeToCollect();
+  }
+  mover->SetInputData(input);
+  mover->Update();
+  return vtkPolyData::SafeDownCast(mover->GetOutputDataObject(0));
+}
+
+bool CompareArrays(vtkDataArray* expected, vtkDataArray* actual, const char* name)
+{
+  if (!expected || !actual || expected->GetNumberOfComponents() != actual->GetNumberOfComponents() ||
+    expected->GetNumberOfTuples() != actual->GetNumberOfTuples())
+  {
+    cerr << "ERROR: '" << name << "' layouts differ." << endl;
+    return false;
+  }
+  const int numComps = expected->GetNumberOfComponents();
+  for (vtkIdType tuple = 0; tuple < expected->GetNumberOfTuples(); ++tuple)
+  {
+    for (int comp = 0; comp < numComps; ++comp)
+    {
+      if (expected->GetComponent(tuple, comp) != actual->GetComponent(tuple, comp))
+      {
+        cerr << "ERROR: '" << name << "' differs at tuple " << tuple << "." << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool Compare(vtkPolyData* expected, vtkPolyData* actual)
+{
+  if (!expected || !actual)
+  {
+    cerr << "ERROR: missing output." << endl;
+    return false;
+  }
+  if (expected->GetNumberOfPoints() != actual->GetNumberOfPoints() ||
+    expected->GetNumberOfCells() != actual->GetNumberOfCells())
+  {
+    cerr << "ERROR: expected " << expected->GetNumberOfPoints() << " points and "
+         << expected->GetNumberOfCells() << " cells, got " << actual->GetNumberOfPoints()
+         << " points and " << actual->GetNumberOfCells() << " cells." << endl;
+    return false;
+  }
+  if (expected->GetNumberOfPoints() == 0)
+  {
+    return true;
+  }
+  if (!CompareArrays(expected->GetPoints()->GetData(), actual->GetPoints()->GetData(), "points") ||
+    !CompareArrays(expected->GetLines()->GetConnectivityArray(),
+      actual->GetLines()->GetConnectivityArray(), "connectivity") ||
+    !CompareArrays(
+      expected->GetLines()->GetOffsetsArray(), actual->GetLines()->GetOffsetsArray(), "offsets"))
+  {
+    return false;
+  }
+  for (const char* name : { "scalars", "ids" })
+  {
+    if (!CompareArrays(expected->GetPointData()->GetArray(name),
+          actual->GetPointData()->GetArray(name), name))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestMPIMoveDataChunked(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+  const int rank = controller->GetLocalProcessId();
+  const int numProcs = controller->GetNumberOfProcesses();
+
+  const bool prevChunked = vtkMPIMoveData::GetUseChunkedMarshaling();
+  const vtkIdType prevChunkSize = vtkMPIMoveData::GetMarshalingChunkSize();
+  // smallest allowed chunk so that every array spans several messages.
+  vtkMPIMoveData::SetMarshalingChunkSize(1024);
+
+  auto piece = MakePiece(rank);
+  vtkIdType expectedPoints = 0;
+  for (int cc = 0; cc < numProcs; ++cc)
+  {
+    expectedPoints += 1000 + 137 * cc;
+  }
+
+  int success = 1;
+  for (const bool clone : { false, true })
+  {
+    auto legacy = Move(controller, piece, clone, false);
+    auto chunked = Move(controller, piece, clone, true);
+    if (clone || rank == 0)
+    {
+      if (!Compare(legacy, chunked))
+      {
+        cerr << "ERROR: " << (clone ? "clone" : "collect") << " outputs differ on rank " << rank
+             << "." << endl;
+        success = 0;
+      }
+      else if (chunked->GetNumberOfPoints() != expectedPoints)
+      {
+        cerr << "ERROR: expected " << expectedPoints << " gathered points, got "
+             << chunked->GetNumberOfPoints() << "." << endl;
+        success = 0;
+      }
+    }
+  }
+
+  vtkMPIMoveData::SetUseChunkedMarshaling(prevChunked);
+  vtkMPIMoveData::SetMarshalingChunkSize(prevChunkSize);
+
+  int allSuccess = 0;
+  controller->AllReduce(&success, &allSuccess, 1, vtkCommunicator::LOGICAL_AND_OP);
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return allSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCellArray.h"
+#include "vtkCellType.h"
+#include "vtkDataArray.h"
+#include "vtkDataObjectTreeIterator.h"
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVGeometryFilter.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+namespace
+{
+// A grid of `res`^3 hexahedra, offset along x by `offset`.
+vtkSmartPointer<vtkUnstructuredGrid> MakeUnstructuredGrid(int res, double offset)
+{
+  const int n = res + 1;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(n * n * n);
+  for (int k = 0; k < n; ++k)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        points->SetPoint(i + n * (j + n * k), offset + i, j, k);
+      }
+    }
+  }
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  grid->Allocate(res * res * res);
+  for (int k = 0; k < res; ++k)
+  {
+    for (int j = 0; j < res; ++j)
+    {
+      for (int i = 0; i < res; ++i)
+      {
+        const vtkIdType p0 = i + n * (j + n * k);
+        const vtkIdType ids[8] = { p0, p0 + 1, p0 + 1 + n, p0 + n, p0 + n * n, p0 + 1 + n * n,
+          p0 + 1 + n + n * n, p0 + n + n * n };
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, ids);
+      }
+    }
+  }
+  return grid;
+}
+
+vtkSmartPointer<vtkImageData> MakeImageData(int res, double offset)
+{
+  auto image = vtkSmartPointer<vtkImageData>::New();
+  image->SetDimensions(res + 1, res + 1, res + 1);
+  image->SetOrigin(offset, 0, 0);
+  return image;
+}
+
+vtkSmartPointer<vtkMultiBlockDataSet> MakeMultiBlock(int numBlocks, int res)
+{
+  auto mb = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  mb->SetNumberOfBlocks(numBlocks);
+  for (int cc = 0; cc < numBlocks; ++cc)
+  {
+    // leave a few blocks empty to check that the structure is preserved.
+    if (cc % 97 == 13)
+    {
+      continue;
+    }
+    vtkSmartPointer<vtkDataSet> block;
+    if (cc % 2 == 0)
+    {
+      block = MakeUnstructuredGrid(res, 2.0 * res * cc);
+    }
+    else
+    {
+      block = MakeImageData(res, 2.0 * res * cc);
+    }
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("values");
+    values->SetNumberOfTuples(block->GetNumberOfPoints());
+    for (vtkIdType id = 0; id < block->GetNumberOfPoints(); ++id)
+    {
+      values->SetValue(id, cc + id);
+    }
+    block->GetPointData()->AddArray(values);
+    mb->SetBlock(cc, block);
+  }
+  return mb;
+}
+
+vtkSmartPointer<vtkMultiBlockDataSet> Execute(vtkMultiBlockDataSet* input, bool smp)
+{
+  vtkPVGeometryFilter::SetUseSMPBlockExecution(smp);
+  vtkNew<vtkPVGeometryFilter> filter;
+  filter->SetUseOutline(0);
+  filter->SetInputData(input);
+  filter->Update();
+  return vtkMultiBlockDataSet::SafeDownCast(filter->GetOutputDataObject(0));
+}
+
+bool Compare(vtkMultiBlockDataSet* serial, vtkMultiBlockDataSet* smp)
+{
+  if (serial->GetNumberOfBlocks() != smp->GetNumberOfBlocks())
+  {
+    cerr << "ERROR: number of blocks differ." << endl;
+    return false;
+  }
+  for (unsigned int cc = 0; cc < serial->GetNumberOfBlocks(); ++cc)
+  {
+    auto pd1 = vtkPolyData::SafeDownCast(serial->GetBlock(cc));
+    auto pd2 = vtkPolyData::SafeDownCast(smp->GetBlock(cc));
+    if ((pd1 == nullptr) != (pd2 == nullptr))
+    {
+      cerr << "ERROR: block " << cc << " is missing." << endl;
+      return false;
+    }
+    if (!pd1)
+    {
+      continue;
+    }
+    if (pd1->GetNumberOfPoints() != pd2->GetNumberOfPoints() ||
+      pd1->GetNumberOfCells() != pd2->GetNumberOfCells() ||
+      pd1->GetPointData()->GetNumberOfArrays() != pd2->GetPointData()->GetNumberOfArrays())
+    {
+      cerr << "ERROR: block " << cc << " differs." << endl;
+      return false;
+    }
+    vtkDataArray* values1 = pd1->GetPointData()->GetArray("values");
+    vtkDataArray* values2 = pd2->GetPointData()->GetArray("values");
+    for (vtkIdType id = 0; id < pd1->GetNumberOfPoints(); ++id)
+    {
+      double p1[3], p2[3];
+      pd1->GetPoint(id, p1);
+      pd2->GetPoint(id, p2);
+      if (p1[0] != p2[0] || p1[1] != p2[1] || p1[2] != p2[2] ||
+        values1->GetTuple1(id) != values2->GetTuple1(id))
+      {
+        cerr << "ERROR: point " << id << " of block " << cc << " differs." << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestPVGeometryFilterBlocks(int, char*[])
+{
+  vtkSmartPointer<vtkMultiBlockDataSet> input = MakeMultiBlock(1000, 4);
+
+  const bool prevUseSMPBlockExecution = vtkPVGeometryFilter::GetUseSMPBlockExecution();
+  vtkSmartPointer<vtkMultiBlockDataSet> serial = Execute(input, false);
+  vtkSmartPointer<vtkMultiBlockDataSet> smp = Execute(input, true);
+  vtkPVGeometryFilter::SetUseSMPBlockExecution(prevUseSMPBlockExecution);
+  if (!serial || !smp || !Compare(serial, smp))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
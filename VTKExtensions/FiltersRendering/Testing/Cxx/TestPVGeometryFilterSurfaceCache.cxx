@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCellData.h"
+#include "vtkCellType.h"
+#include "vtkDoubleArray.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVGeometryFilter.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+namespace
+{
+// A grid of 3x3x3 hexahedra, offset along x by `offset`.
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid(double offset)
+{
+  const int res = 3;
+  const int n = res + 1;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(n * n * n);
+  for (int k = 0; k < n; ++k)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        points->SetPoint(i + n * (j + n * k), offset + i, j, k);
+      }
+    }
+  }
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  grid->Allocate(res * res * res);
+  for (int k = 0; k < res; ++k)
+  {
+    for (int j = 0; j < res; ++j)
+    {
+      for (int i = 0; i < res; ++i)
+      {
+        const vtkIdType p0 = i + n * (j + n * k);
+        const vtkIdType ids[8] = { p0, p0 + 1, p0 + 1 + n, p0 + n, p0 + n * n, p0 + 1 + n * n,
+          p0 + 1 + n + n * n, p0 + n + n * n };
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, ids);
+      }
+    }
+  }
+  return grid;
+}
+
+void AddArray(vtkDataSetAttributes* attributes, const char* name, vtkIdType count, double scale)
+{
+  vtkNew<vtkDoubleArray> array;
+  array->SetName(name);
+  array->SetNumberOfTuples(count);
+  for (vtkIdType cc = 0; cc < count; ++cc)
+  {
+    array->SetValue(cc, scale * cc);
+  }
+  attributes->AddArray(array);
+}
+
+bool CompareArrays(vtkDataSetAttributes* expected, vtkDataSetAttributes* actual)
+{
+  if (expected->GetNumberOfArrays() != actual->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int cc = 0; cc < expected->GetNumberOfArrays(); ++cc)
+  {
+    vtkDataArray* array1 = expected->GetArray(cc);
+    vtkDataArray* array2 = array1 ? actual->GetArray(array1->GetName()) : nullptr;
+    if (!array1)
+    {
+      continue;
+    }
+    if (!array2 || array1->GetNumberOfTuples() != array2->GetNumberOfTuples() ||
+      array1->GetNumberOfComponents() != array2->GetNumberOfComponents())
+    {
+      return false;
+    }
+    for (vtkIdType id = 0; id < array1->GetNumberOfTuples(); ++id)
+    {
+      for (int comp = 0; comp < array1->GetNumberOfComponents(); ++comp)
+      {
+        if (array1->GetComponent(id, comp) != array2->GetComponent(id, comp))
+        {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// Compare the output of `filter` with the one of a filter that does not cache surfaces.
+bool Check(vtkPVGeometryFilter* filter, vtkMultiBlockDataSet* input, vtkIdType expectedReused)
+{
+  vtkNew<vtkPVGeometryFilter> reference;
+  reference->SetUseOutline(0);
+  reference->SetGenerateCellNormals(filter->GetGenerateCellNormals());
+  reference->SetCacheSurfaces(false);
+  reference->SetInputData(input);
+  reference->Update();
+  filter->Update();
+  if (filter->GetNumberOfReusedSurfaces() != expectedReused)
+  {
+    cerr << "ERROR: " << filter->GetNumberOfReusedSurfaces() << " surfaces were reused instead of "
+         << expectedReused << "." << endl;
+    return false;
+  }
+  auto expected = vtkMultiBlockDataSet::SafeDownCast(reference->GetOutputDataObject(0));
+  auto actual = vtkMultiBlockDataSet::SafeDownCast(filter->GetOutputDataObject(0));
+  for (unsigned int cc = 0; cc < input->GetNumberOfBlocks(); ++cc)
+  {
+    auto pd1 = vtkPolyData::SafeDownCast(expected->GetBlock(cc));
+    auto pd2 = vtkPolyData::SafeDownCast(actual->GetBlock(cc));
+    if (!pd1 || !pd2 || pd1->GetNumberOfPoints() != pd2->GetNumberOfPoints() ||
+      pd1->GetNumberOfCells() != pd2->GetNumberOfCells() ||
+      !CompareArrays(pd1->GetPointData(), pd2->GetPointData()) ||
+      !CompareArrays(pd1->GetCellData(), pd2->GetCellData()))
+    {
+      cerr << "ERROR: block " << cc << " differs from the reference." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestPVGeometryFilterSurfaceCache(int, char*[])
+{
+  const unsigned int numBlocks = 4;
+  vtkNew<vtkMultiBlockDataSet> input;
+  for (unsigned int cc = 0; cc < numBlocks; ++cc)
+  {
+    vtkSmartPointer<vtkUnstructuredGrid> grid = MakeGrid(10.0 * cc);
+    AddArray(grid->GetPointData(), "pvalues", grid->GetNumberOfPoints(), 1.0);
+    AddArray(grid->GetCellData(), "cvalues", grid->GetNumberOfCells(), 1.0);
+    input->SetBlock(cc, grid);
+  }
+
+  vtkNew<vtkPVGeometryFilter> filter;
+  filter->SetUseOutline(0);
+  filter->SetInputData(input);
+  if (!Check(filter, input, 0))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Adding and changing arrays only re-projects the attributes.
+  for (unsigned int cc = 0; cc < numBlocks; ++cc)
+  {
+    auto grid = vtkUnstructuredGrid::SafeDownCast(input->GetBlock(cc));
+    AddArray(grid->GetPointData(), "pvalues", grid->GetNumberOfPoints(), 2.0);
+    AddArray(grid->GetCellData(), "other", grid->GetNumberOfCells(), 3.0);
+  }
+  input->Modified();
+  if (!Check(filter, input, numBlocks))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Moving the points of a block extracts its surface again.
+  auto grid = vtkUnstructuredGrid::SafeDownCast(input->GetBlock(1));
+  grid->GetPoints()->SetPoint(0, -1.0, -1.0, -1.0);
+  grid->GetPoints()->Modified();
+  input->Modified();
+  if (!Check(filter, input, numBlocks - 1))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Changing the filter does not reuse surfaces, and the arrays it generates
+  // are cached too.
+  filter->SetGenerateCellNormals(1);
+  if (!Check(filter, input, 0))
+  {
+    return EXIT_FAILURE;
+  }
+  input->Modified();
+  if (!Check(filter, input, numBlocks))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCharArray.h"
+#include "vtkCommunicator.h"
+#include "vtkDummyController.h"
+#include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkSmartPointer.h"
+#include "vtkSortedTableStreamer.h"
+#include "vtkSplitColumnComponents.h"
+#include "vtkTable.h"
+
+#include <string>
+
+namespace
+{
+const int NumberOfAttributes = 293;
+
+// A particle table with ids, positions, velocities and other attributes, for
+// 300 columns once the velocity components are split.
+vtkSmartPointer<vtkTable> MakeParticles(vtkIdType numParticles)
+{
+  auto table = vtkSmartPointer<vtkTable>::New();
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName("id");
+  ids->SetNumberOfTuples(numParticles);
+  for (vtkIdType cc = 0; cc < numParticles; ++cc)
+  {
+    ids->SetValue(cc, cc);
+  }
+  table->AddColumn(ids);
+
+  auto addColumn = [&](const std::string& name, int numComps, int seed) {
+    vtkNew<vtkFloatArray> array;
+    array->SetName(name.c_str());
+    array->SetNumberOfComponents(numComps);
+    array->SetNumberOfTuples(numParticles);
+    for (vtkIdType cc = 0; cc < numParticles * numComps; ++cc)
+    {
+      array->SetValue(cc, static_cast<float>((cc * 7919 + seed * 104729) % 100003));
+    }
+    table->AddColumn(array);
+  };
+  addColumn("x", 1, 1);
+  addColumn("y", 1, 2);
+  addColumn("z", 1, 3);
+  addColumn("velocity", 3, 4);
+  for (int cc = 0; cc < NumberOfAttributes; ++cc)
+  {
+    addColumn("attr_" + std::to_string(cc), 1, cc + 5);
+  }
+
+  vtkNew<vtkSplitColumnComponents> split;
+  split->SetInputData(table);
+  split->SetCalculateMagnitudes(false);
+  split->SetNamingMode(vtkSplitColumnComponents::NUMBERS_WITH_UNDERSCORES);
+  split->Update();
+  return split->GetOutput();
+}
+
+// Fetches every block, sorted by a column, as when scrolling through the
+// whole table, and returns the ids of the rows in order.
+vtkSmartPointer<vtkIdTypeArray> Scroll(
+  vtkSortedTableStreamer* streamer, vtkIdType numRows, vtkIdType& numColumns, vtkIdType& bytes)
+{
+  auto ids = vtkSmartPointer<vtkIdTypeArray>::New();
+  const vtkIdType numBlocks = (numRows + streamer->GetBlockSize() - 1) / streamer->GetBlockSize();
+  bytes = 0;
+  for (vtkIdType block = 0; block < numBlocks; ++block)
+  {
+    streamer->SetBlock(block);
+    streamer->Update();
+    vtkTable* output = streamer->GetOutput();
+    numColumns = output->GetNumberOfColumns();
+
+    // the size of the block as delivered to the client.
+    vtkNew<vtkCharArray> buffer;
+    vtkCommunicator::MarshalDataObject(output, buffer);
+    bytes += buffer->GetNumberOfTuples();
+
+    auto blockIds = vtkIdTypeArray::SafeDownCast(output->GetColumnByName("id"));
+    for (vtkIdType cc = 0; blockIds && cc < blockIds->GetNumberOfTuples(); ++cc)
+    {
+      ids->InsertNextValue(blockIds->GetValue(cc));
+    }
+  }
+  return ids;
+}
+
+bool Compare(vtkIdTypeArray* expected, vtkIdTypeArray* actual)
+{
+  if (expected->GetNumberOfTuples() != actual->GetNumberOfTuples())
+  {
+    cerr << "ERROR: " << actual->GetNumberOfTuples() << " rows instead of "
+         << expected->GetNumberOfTuples() << "." << endl;
+    return false;
+  }
+  for (vtkIdType cc = 0; cc < expected->GetNumberOfTuples(); ++cc)
+  {
+    if (expected->GetValue(cc) != actual->GetValue(cc))
+    {
+      cerr << "ERROR: row " << cc << " differs." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestColumns(vtkPartitionedDataSet* input, vtkIdType numRows, bool sampleSort)
+{
+  vtkSortedTableStreamer::SetUseSampleSort(sampleSort);
+  const char* path = sampleSort ? "sample sort" : "histogram";
+
+  vtkNew<vtkDummyController> controller;
+  vtkNew<vtkSortedTableStreamer> streamer;
+  streamer->SetController(controller);
+  streamer->SetInputData(input);
+  streamer->SetBlockSize(1024);
+  // sorting by a column that is left out must still be possible.
+  streamer->SetColumnNameToSort("attr_0");
+
+  vtkIdType allColumns, allBytes;
+  vtkSmartPointer<vtkIdTypeArray> allIds = Scroll(streamer, numRows, allColumns, allBytes);
+
+  // only show the ids, positions and velocities.
+  for (int cc = 0; cc < NumberOfAttributes; ++cc)
+  {
+    streamer->AddColumnToSkip(("attr_" + std::to_string(cc)).c_str());
+  }
+  vtkIdType shownColumns, shownBytes;
+  vtkSmartPointer<vtkIdTypeArray> shownIds = Scroll(streamer, numRows, shownColumns, shownBytes);
+
+  // skipping an array skips all its components.
+  streamer->AddArrayToSkip("velocity");
+  vtkIdType noVelocityColumns, noVelocityBytes;
+  vtkSmartPointer<vtkIdTypeArray> noVelocityIds =
+    Scroll(streamer, numRows, noVelocityColumns, noVelocityBytes);
+
+  if (allColumns != 300 || shownColumns != 7 || noVelocityColumns != 4)
+  {
+    cerr << "ERROR: " << path << " returned a wrong number of columns " << allColumns << ", "
+         << shownColumns << ", " << noVelocityColumns << "." << endl;
+    return false;
+  }
+  if (!Compare(allIds, shownIds) || !Compare(allIds, noVelocityIds))
+  {
+    cerr << "ERROR: " << path << " rows differ once columns are left out." << endl;
+    return false;
+  }
+  if (shownBytes >= allBytes / 10)
+  {
+    cerr << "ERROR: " << path << " moved " << shownBytes << " bytes instead of at most "
+         << allBytes / 10 << "." << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestSortedTableStreamerColumns(int, char*[])
+{
+  const vtkIdType numRows = 20000;
+  vtkSmartPointer<vtkTable> particles = MakeParticles(numRows);
+  if (particles->GetNumberOfColumns() != 300)
+  {
+    cerr << "ERROR: " << particles->GetNumberOfColumns() << " columns instead of 300." << endl;
+    return EXIT_FAILURE;
+  }
+  vtkNew<vtkPartitionedDataSet> input;
+  input->SetPartition(0, particles);
+
+  const bool prevUseSampleSort = vtkSortedTableStreamer::GetUseSampleSort();
+  bool success = true;
+  for (const bool sampleSort : { true, false })
+  {
+    success &= TestColumns(input, numRows, sampleSort);
+  }
+  vtkSortedTableStreamer::SetUseSampleSort(prevUseSampleSort);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCommunicator.h"
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkSmartPointer.h"
+#include "vtkSortedTableStreamer.h"
+#include "vtkTable.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+// Ranks hold different numbers of rows so that blocks straddle ranks unevenly.
+vtkIdType NumberOfRows(int rank)
+{
+  return 500 + 97 * rank;
+}
+
+// "value" is unique across all ranks (7919 is coprime with the prime 100003),
+// "repeated" has many equal values.
+double Value(vtkIdType gid)
+{
+  return static_cast<double>((gid * 7919) % 100003);
+}
+double Repeated(vtkIdType gid)
+{
+  return static_cast<double>(gid % 37);
+}
+
+vtkSmartPointer<vtkTable> MakeTable(int rank)
+{
+  vtkIdType offset = 0;
+  for (int cc = 0; cc < rank; ++cc)
+  {
+    offset += NumberOfRows(cc);
+  }
+  const vtkIdType numRows = NumberOfRows(rank);
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName("id");
+  ids->SetNumberOfTuples(numRows);
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("value");
+  values->SetNumberOfTuples(numRows);
+  vtkNew<vtkDoubleArray> repeated;
+  repeated->SetName("repeated");
+  repeated->SetNumberOfTuples(numRows);
+  for (vtkIdType cc = 0; cc < numRows; ++cc)
+  {
+    ids->SetValue(cc, offset + cc);
+    values->SetValue(cc, Value(offset + cc));
+    repeated->SetValue(cc, Repeated(offset + cc));
+  }
+  auto table = vtkSmartPointer<vtkTable>::New();
+  table->AddColumn(ids);
+  table->AddColumn(values);
+  table->AddColumn(repeated);
+  return table;
+}
+
+// Fetches every block and returns the content of `column` in order. Only the
+// merging process has the rows of a block, so the blocks are summed over all
+// ranks, which leaves the rows of that process.
+std::vector<double> Scroll(vtkMPIController* controller, vtkPartitionedDataSet* input,
+  const char* sortColumn, const char* column, bool invert, bool sampleSort, vtkIdType numRows,
+  vtkIdType blockSize)
+{
+  vtkSortedTableStreamer::SetUseSampleSort(sampleSort);
+  vtkNew<vtkSortedTableStreamer> streamer;
+  streamer->SetController(controller);
+  streamer->SetInputData(input);
+  streamer->SetBlockSize(blockSize);
+  streamer->SetColumnNameToSort(sortColumn);
+  streamer->SetSelectedComponent(0);
+  streamer->SetInvertOrder(invert ? 1 : 0);
+
+  std::vector<double> result;
+  std::vector<double> local(blockSize + 1), global(blockSize + 1);
+  for (vtkIdType block = 0; block * blockSize < numRows; ++block)
+  {
+    streamer->SetBlock(block);
+    streamer->Update();
+    vtkTable* output = streamer->GetOutput();
+    std::fill(local.begin(), local.end(), 0.0);
+    auto array = vtkDataArray::SafeDownCast(output->GetColumnByName(column));
+    const vtkIdType size = array ? std::min(array->GetNumberOfTuples(), blockSize) : 0;
+    local[blockSize] = static_cast<double>(size);
+    for (vtkIdType cc = 0; cc < size; ++cc)
+    {
+      local[cc] = array->GetComponent(cc, 0);
+    }
+    controller->AllReduce(local.data(), global.data(), blockSize + 1, vtkCommunicator::SUM_OP);
+    result.insert(result.end(), global.begin(),
+      global.begin() + static_cast<vtkIdType>(global[blockSize]));
+  }
+  return result;
+}
+
+bool Compare(const std::vector<double>& expected, const std::vector<double>& actual,
+  const char* column, const char* path)
+{
+  if (expected.size() != actual.size())
+  {
+    cerr << "ERROR: " << path << " returned " << actual.size() << " rows of '" << column
+         << "' instead of " << expected.size() << "." << endl;
+    return false;
+  }
+  for (size_t cc = 0; cc < expected.size(); ++cc)
+  {
+    if (expected[cc] != actual[cc])
+    {
+      cerr << "ERROR: " << path << " differs in '" << column << "' at row " << cc << ": expected "
+           << expected[cc] << ", got " << actual[cc] << "." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestSortedTableStreamerMPI(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+  const int rank = controller->GetLocalProcessId();
+  const int numProcs = controller->GetNumberOfProcesses();
+
+  vtkNew<vtkPartitionedDataSet> input;
+  input->SetPartition(0, MakeTable(rank));
+
+  vtkIdType numRows = 0;
+  for (int cc = 0; cc < numProcs; ++cc)
+  {
+    numRows += NumberOfRows(cc);
+  }
+  std::vector<std::pair<double, double>> rows(numRows);
+  for (vtkIdType gid = 0; gid < numRows; ++gid)
+  {
+    rows[gid] = { Value(gid), static_cast<double>(gid) };
+  }
+  std::sort(rows.begin(), rows.end());
+
+  const bool prevUseSampleSort = vtkSortedTableStreamer::GetUseSampleSort();
+  const vtkIdType blockSize = 256;
+  int success = 1;
+  for (const bool invert : { false, true })
+  {
+    std::vector<double> expectedValues, expectedIds;
+    for (const auto& row : rows)
+    {
+      expectedValues.push_back(row.first);
+      expectedIds.push_back(row.second);
+    }
+    if (invert)
+    {
+      std::reverse(expectedValues.begin(), expectedValues.end());
+      std::reverse(expectedIds.begin(), expectedIds.end());
+    }
+
+    // unique values: the order of the rows is fully determined.
+    for (const bool sampleSort : { true, false })
+    {
+      const char* path = sampleSort ? "sample sort" : "histogram";
+      auto values =
+        Scroll(controller, input, "value", "value", invert, sampleSort, numRows, blockSize);
+      auto ids = Scroll(controller, input, "value", "id", invert, sampleSort, numRows, blockSize);
+      if (!Compare(expectedValues, values, "value", path) ||
+        !Compare(expectedIds, ids, "id", path))
+      {
+        success = 0;
+      }
+    }
+
+    // repeated values: the order of equal rows is not specified, but the
+    // sorted values must be the same with both paths.
+    auto sampled =
+      Scroll(controller, input, "repeated", "repeated", invert, true, numRows, blockSize);
+    auto histogram =
+      Scroll(controller, input, "repeated", "repeated", invert, false, numRows, blockSize);
+    if (!Compare(histogram, sampled, "repeated", "sample sort"))
+    {
+      success = 0;
+    }
+  }
+  vtkSortedTableStreamer::SetUseSampleSort(prevUseSampleSort);
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -6,7 +6,10 @@
 #include "vtkAllToNRedistributeCompositePolyData.h"
 #include "vtkCellData.h"
 #include "vtkCharArray.h"
+#include "vtkCellArray.h"
 #include "vtkCompositeDataIterator.h"
+#include "vtkDataObjectTree.h"
+#include "vtkDataObjectTreeIterator.h"
 #include "vtkDataObjectTypes.h"
 #include "vtkGenericDataObjectReader.h"
 #include "vtkGenericDataObjectWriter.h"
@@ -17,25 +20,34 @@
 #include "vtkMultiBlockDataSet.h"
 #include "vtkMultiProcessController.h"
 #include "vtkMultiProcessControllerHelper.h"
+#include "vtkMultiProcessStream.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkOutlineFilter.h"
 #include "vtkPVLogger.h"
 #include "vtkPVSession.h"
 #include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
 #include "vtkProcessModule.h"
 #include "vtkSmartPointer.h"
 #include "vtkSocketCommunicator.h"
 #include "vtkSocketController.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTimerLog.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
 
 #include "vtk_zlib.h"
+#include <algorithm>
 #include <sstream>
-#include <vector>
-
+#include <string>
 #include <vector>
 
 bool vtkMPIMoveData::UseZLibCompression = false;
+bool vtkMPIMoveData::UseChunkedMarshaling = false;
+vtkIdType vtkMPIMoveData::MarshalingChunkSize = 64 * 1024 * 1024;
 
 namespace
 {
@@ -70,6 +82,397 @@ void unsetGlobalIdsAttribute(vtkDataObject* piece)
 }
 };
 
+//-----------------------------------------------------------------------------
+// Helpers for the chunked marshaling path. Each piece is split into a
+// skeleton, which goes through the legacy writer, and a list of payload arrays
+// that are transferred as raw memory. The metadata needed by the receiver to
+// pre-allocate the payload arrays is exchanged using vtkMultiProcessStream.
+namespace vtkMPIMoveDataChunked
+{
+// Tag used for the point-to-point payload messages.
+constexpr int PAYLOAD_TAG = 23485;
+
+enum ArrayRoles
+{
+  POINTS = 0,
+  TOPOLOGY = 1,
+  POINT_DATA = 2,
+  CELL_DATA = 3
+};
+
+struct ArrayMetaData
+{
+  int Role = POINTS;
+  std::string Name;
+  int DataType = VTK_VOID;
+  int NumberOfComponents = 1;
+  vtkTypeInt64 NumberOfTuples = 0;
+  int AttributeType = -1;
+};
+
+struct LeafMetaData
+{
+  unsigned int FlatIndex = 0;
+  int DataObjectType = VTK_POLY_DATA;
+  std::vector<ArrayMetaData> Arrays;
+};
+
+struct Piece
+{
+  vtkSmartPointer<vtkDataObject> Skeleton;
+  std::vector<LeafMetaData> Leaves;
+  // Payload arrays for all leaves, in the order described by `Leaves`.
+  std::vector<vtkSmartPointer<vtkDataArray>> Payload;
+};
+
+bool IsTransferable(vtkAbstractArray* array)
+{
+  auto da = vtkDataArray::SafeDownCast(array);
+  return da != nullptr && da->GetDataType() != VTK_BIT && da->HasStandardMemoryLayout();
+}
+
+// Returns the arrays defining the cells of the dataset, in a fixed order.
+void GetTopologyArrays(vtkDataSet* ds, std::vector<vtkDataArray*>& arrays)
+{
+  if (auto pd = vtkPolyData::SafeDownCast(ds))
+  {
+    vtkCellArray* cellArrays[] = { pd->GetVerts(), pd->GetLines(), pd->GetPolys(),
+      pd->GetStrips() };
+    for (vtkCellArray* ca : cellArrays)
+    {
+      arrays.push_back(ca ? ca->GetOffsetsArray() : nullptr);
+      arrays.push_back(ca ? ca->GetConnectivityArray() : nullptr);
+    }
+  }
+  else if (auto ug = vtkUnstructuredGrid::SafeDownCast(ds))
+  {
+    if (ug->GetNumberOfCells() > 0)
+    {
+      vtkCellArray* ca = ug->GetCells();
+      arrays.push_back(ug->GetCellTypesArray());
+      arrays.push_back(ca ? ca->GetOffsetsArray() : nullptr);
+      arrays.push_back(ca ? ca->GetConnectivityArray() : nullptr);
+    }
+  }
+}
+
+// Returns true if all the bulk arrays of the leaf can be sent as raw memory.
+bool CanDetach(vtkDataObject* dobj)
+{
+  auto ds = vtkPointSet::SafeDownCast(dobj);
+  if (!vtkPolyData::SafeDownCast(ds) && !vtkUnstructuredGrid::SafeDownCast(ds))
+  {
+    return false;
+  }
+  auto ug = vtkUnstructuredGrid::SafeDownCast(ds);
+  if (ug && ug->GetFaces() != nullptr)
+  {
+    // polyhedral cells are not supported.
+    return false;
+  }
+  if (ds->GetPoints() && !IsTransferable(ds->GetPoints()->GetData()))
+  {
+    return false;
+  }
+
+  std::vector<vtkDataArray*> topology;
+  GetTopologyArrays(ds, topology);
+  if (!std::all_of(topology.begin(), topology.end(), IsTransferable))
+  {
+    return false;
+  }
+
+  vtkDataSetAttributes* attributes[] = { ds->GetPointData(), ds->GetCellData() };
+  for (vtkDataSetAttributes* dsa : attributes)
+  {
+    for (int cc = 0, max = dsa->GetNumberOfArrays(); cc < max; ++cc)
+    {
+      if (!IsTransferable(dsa->GetAbstractArray(cc)))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Returns an empty instance of the leaf that only keeps its field data.
+vtkSmartPointer<vtkDataObject> NewPlaceholder(vtkDataObject* leaf)
+{
+  auto placeholder = vtk::TakeSmartPointer(leaf->NewInstance());
+  placeholder->GetFieldData()->ShallowCopy(leaf->GetFieldData());
+  return placeholder;
+}
+
+void Detach(vtkPointSet* ds, unsigned int flatIndex, Piece& piece)
+{
+  LeafMetaData meta;
+  meta.FlatIndex = flatIndex;
+  meta.DataObjectType = ds->GetDataObjectType();
+
+  auto add = [&](int role, vtkDataArray* array, int attributeType) {
+    ArrayMetaData amd;
+    amd.Role = role;
+    amd.Name = array->GetName() ? array->GetName() : "";
+    amd.DataType = array->GetDataType();
+    amd.NumberOfComponents = array->GetNumberOfComponents();
+    amd.NumberOfTuples = array->GetNumberOfTuples();
+    amd.AttributeType = attributeType;
+    meta.Arrays.push_back(amd);
+    piece.Payload.emplace_back(array);
+  };
+
+  if (ds->GetPoints())
+  {
+    add(POINTS, ds->GetPoints()->GetData(), -1);
+  }
+
+  std::vector<vtkDataArray*> topology;
+  GetTopologyArrays(ds, topology);
+  for (vtkDataArray* array : topology)
+  {
+    add(TOPOLOGY, array, -1);
+  }
+
+  vtkPointData* pd = ds->GetPointData();
+  for (int cc = 0, max = pd->GetNumberOfArrays(); cc < max; ++cc)
+  {
+    add(POINT_DATA, pd->GetArray(cc), pd->IsArrayAnAttribute(cc));
+  }
+  vtkCellData* cd = ds->GetCellData();
+  for (int cc = 0, max = cd->GetNumberOfArrays(); cc < max; ++cc)
+  {
+    add(CELL_DATA, cd->GetArray(cc), cd->IsArrayAnAttribute(cc));
+  }
+
+  piece.Leaves.push_back(std::move(meta));
+}
+
+// Splits the data object into a skeleton and payload arrays. The payload
+// arrays are the arrays of the data object itself; nothing is copied.
+Piece Split(vtkDataObject* data)
+{
+  Piece piece;
+  if (auto tree = vtkDataObjectTree::SafeDownCast(data))
+  {
+    auto skeleton = vtk::TakeSmartPointer(tree->NewInstance());
+    skeleton->CopyStructure(tree);
+
+    auto iter = vtk::TakeSmartPointer(tree->NewTreeIterator());
+    iter->VisitOnlyLeavesOn();
+    iter->SkipEmptyNodesOn();
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      vtkDataObject* leaf = iter->GetCurrentDataObject();
+      if (CanDetach(leaf))
+      {
+        Detach(vtkPointSet::SafeDownCast(leaf), iter->GetCurrentFlatIndex(), piece);
+        skeleton->SetDataSet(iter, NewPlaceholder(leaf));
+      }
+      else
+      {
+        skeleton->SetDataSet(iter, leaf);
+      }
+    }
+    piece.Skeleton = skeleton;
+  }
+  else if (CanDetach(data))
+  {
+    Detach(vtkPointSet::SafeDownCast(data), 0, piece);
+    piece.Skeleton = NewPlaceholder(data);
+  }
+  else
+  {
+    piece.Skeleton = data;
+  }
+  return piece;
+}
+
+void Serialize(const std::vector<LeafMetaData>& leaves, vtkMultiProcessStream& stream)
+{
+  stream << static_cast<unsigned int>(leaves.size());
+  for (const auto& leaf : leaves)
+  {
+    stream << leaf.FlatIndex << leaf.DataObjectType
+           << static_cast<unsigned int>(leaf.Arrays.size());
+    for (const auto& amd : leaf.Arrays)
+    {
+      stream << amd.Role << amd.Name << amd.DataType << amd.NumberOfComponents
+             << amd.NumberOfTuples << amd.AttributeType;
+    }
+  }
+}
+
+void Deserialize(vtkMultiProcessStream& stream, std::vector<LeafMetaData>& leaves)
+{
+  unsigned int numLeaves = 0;
+  stream >> numLeaves;
+  leaves.resize(numLeaves);
+  for (auto& leaf : leaves)
+  {
+    unsigned int numArrays = 0;
+    stream >> leaf.FlatIndex >> leaf.DataObjectType >> numArrays;
+    leaf.Arrays.resize(numArrays);
+    for (auto& amd : leaf.Arrays)
+    {
+      stream >> amd.Role >> amd.Name >> amd.DataType >> amd.NumberOfComponents >>
+        amd.NumberOfTuples >> amd.AttributeType;
+    }
+  }
+}
+
+// Allocates the payload arrays described by the metadata of a remote piece.
+void AllocatePayload(Piece& piece)
+{
+  piece.Payload.clear();
+  for (const auto& leaf : piece.Leaves)
+  {
+    for (const auto& amd : leaf.Arrays)
+    {
+      auto array = vtk::TakeSmartPointer(vtkDataArray::CreateDataArray(amd.DataType));
+      array->SetNumberOfComponents(amd.NumberOfComponents);
+      array->SetNumberOfTuples(amd.NumberOfTuples);
+      if (!amd.Name.empty())
+      {
+        array->SetName(amd.Name.c_str());
+      }
+      piece.Payload.push_back(array);
+    }
+  }
+}
+
+// Invokes `functor(char* ptr, vtkIdType length)` for each chunk of the array's
+// memory and returns the total number of bytes.
+template <typename FunctorT>
+vtkIdType ForEachChunk(vtkDataArray* array, vtkIdType chunkSize, FunctorT&& functor)
+{
+  const vtkIdType total =
+    static_cast<vtkIdType>(array->GetNumberOfValues()) * array->GetDataTypeSize();
+  if (total > 0)
+  {
+    char* ptr = static_cast<char*>(array->GetVoidPointer(0));
+    for (vtkIdType offset = 0; offset < total; offset += chunkSize)
+    {
+      functor(ptr + offset, std::min(chunkSize, total - offset));
+    }
+  }
+  return total;
+}
+
+vtkSmartPointer<vtkDataSet> AssembleLeaf(
+  const LeafMetaData& leaf, const Piece& piece, size_t& payloadIndex)
+{
+  auto ds = vtk::TakeSmartPointer(
+    vtkPointSet::SafeDownCast(vtkDataObjectTypes::NewDataObject(leaf.DataObjectType)));
+  if (!ds)
+  {
+    return nullptr;
+  }
+
+  std::vector<vtkDataArray*> topology;
+  for (const auto& amd : leaf.Arrays)
+  {
+    vtkDataArray* array = piece.Payload[payloadIndex++];
+    switch (amd.Role)
+    {
+      case POINTS:
+      {
+        vtkNew<vtkPoints> points;
+        points->SetData(array);
+        ds->SetPoints(points);
+        break;
+      }
+      case TOPOLOGY:
+        topology.push_back(array);
+        break;
+      case POINT_DATA:
+      case CELL_DATA:
+      {
+        vtkDataSetAttributes* dsa = amd.Role == POINT_DATA
+          ? static_cast<vtkDataSetAttributes*>(ds->GetPointData())
+          : static_cast<vtkDataSetAttributes*>(ds->GetCellData());
+        const int idx = dsa->AddArray(array);
+        if (amd.AttributeType >= 0)
+        {
+          dsa->SetActiveAttribute(idx, amd.AttributeType);
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+
+  if (auto pd = vtkPolyData::SafeDownCast(ds))
+  {
+    if (topology.size() == 8)
+    {
+      vtkNew<vtkCellArray> verts, lines, polys, strips;
+      verts->SetData(topology[0], topology[1]);
+      lines->SetData(topology[2], topology[3]);
+      polys->SetData(topology[4], topology[5]);
+      strips->SetData(topology[6], topology[7]);
+      pd->SetVerts(verts);
+      pd->SetLines(lines);
+      pd->SetPolys(polys);
+      pd->SetStrips(strips);
+    }
+  }
+  else if (auto ug = vtkUnstructuredGrid::SafeDownCast(ds))
+  {
+    if (topology.size() == 3)
+    {
+      vtkNew<vtkCellArray> cells;
+      cells->SetData(topology[1], topology[2]);
+      ug->SetCells(vtkUnsignedCharArray::SafeDownCast(topology[0]), cells);
+    }
+  }
+  return ds;
+}
+
+// Puts the received payload arrays back into the skeleton of a remote piece.
+vtkSmartPointer<vtkDataObject> Assemble(const Piece& piece)
+{
+  size_t payloadIndex = 0;
+  auto tree = vtkDataObjectTree::SafeDownCast(piece.Skeleton);
+  if (tree == nullptr)
+  {
+    if (piece.Leaves.empty())
+    {
+      return piece.Skeleton;
+    }
+    vtkSmartPointer<vtkDataSet> leaf = AssembleLeaf(piece.Leaves[0], piece, payloadIndex);
+    if (leaf == nullptr)
+    {
+      return piece.Skeleton;
+    }
+    leaf->GetFieldData()->ShallowCopy(piece.Skeleton->GetFieldData());
+    return leaf;
+  }
+
+  auto iter = vtk::TakeSmartPointer(tree->NewTreeIterator());
+  iter->VisitOnlyLeavesOn();
+  iter->SkipEmptyNodesOn();
+  auto meta = piece.Leaves.begin();
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal() && meta != piece.Leaves.end();
+       iter->GoToNextItem())
+  {
+    if (iter->GetCurrentFlatIndex() != meta->FlatIndex)
+    {
+      continue;
+    }
+    vtkSmartPointer<vtkDataSet> leaf = AssembleLeaf(*meta, piece, payloadIndex);
+    if (leaf)
+    {
+      leaf->GetFieldData()->ShallowCopy(iter->GetCurrentDataObject()->GetFieldData());
+    }
+    tree->SetDataSet(iter, leaf);
+    ++meta;
+  }
+  return piece.Skeleton;
+}
+}
+
 vtkStandardNewMacro(vtkMPIMoveData);
 
 vtkCxxSetObjectMacro(vtkMPIMoveData, Controller, vtkMultiProcessController);
@@ -166,6 +569,30 @@ bool vtkMPIMoveData::GetUseZLibCompression()
   return vtkMPIMoveData::UseZLibCompression;
 }
 
+//----------------------------------------------------------------------------
+void vtkMPIMoveData::SetUseChunkedMarshaling(bool b)
+{
+  vtkMPIMoveData::UseChunkedMarshaling = b;
+}
+
+//----------------------------------------------------------------------------
+bool vtkMPIMoveData::GetUseChunkedMarshaling()
+{
+  return vtkMPIMoveData::UseChunkedMarshaling;
+}
+
+//----------------------------------------------------------------------------
+void vtkMPIMoveData::SetMarshalingChunkSize(vtkIdType size)
+{
+  vtkMPIMoveData::MarshalingChunkSize = std::max<vtkIdType>(size, 1024);
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkMPIMoveData::GetMarshalingChunkSize()
+{
+  return vtkMPIMoveData::MarshalingChunkSize;
+}
+
 //----------------------------------------------------------------------------
 int vtkMPIMoveData::FillInputPortInformation(int, vtkInformation* info)
 {
@@ -541,17 +968,37 @@ void vtkMPIMoveData::DataServerGatherAll(vtkDataObject* input, vtkDataObject* ou
     return;
   }
 
+  if (vtkMPIMoveData::UseChunkedMarshaling && !output->IsA("vtkImageData"))
+  {
+    this->DataServerGatherAllChunked(input, output);
+    return;
+  }
+
   vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "gather-all");
 
-  int idx;
-  auto com = this->Controller->GetCommunicator();
-  if (com == nullptr)
+  if (this->Controller->GetCommunicator() == nullptr)
   {
     vtkErrorMacro("MPICommunicator neededfor this operation.");
     return;
   }
   this->ClearBuffer();
   this->MarshalDataToBuffer(input);
+  this->AllGatherMarshaledBuffer();
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "gathered %lld bytes",
+    static_cast<long long>(this->BufferTotalLength));
+
+  this->ReconstructDataFromBuffer(output);
+
+  // int fixme; // Do not clear buffers here
+  this->ClearBuffer();
+}
+
+//-----------------------------------------------------------------------------
+void vtkMPIMoveData::AllGatherMarshaledBuffer()
+{
+  int numProcs = this->Controller->GetNumberOfProcesses();
+  auto com = this->Controller->GetCommunicator();
+  int idx;
 
   // Save a copy of the buffer so we can receive into the buffer.
   // We will be responsiblefor deleting the buffer.
@@ -583,10 +1030,7 @@ void vtkMPIMoveData::DataServerGatherAll(vtkDataObject* input, vtkDataObject* ou
   com->AllGatherV(
     inBuffer, this->Buffers, inBufferLength, this->BufferLengths, this->BufferOffsets);
 
-  this->ReconstructDataFromBuffer(output);
-
-  // int fixme; // Do not clear buffers here
-  this->ClearBuffer();
+  delete[] inBuffer;
 }
 
 //-----------------------------------------------------------------------------
@@ -614,17 +1058,44 @@ void vtkMPIMoveData::DataServerGatherToZero(vtkDataObject* input, vtkDataObject*
 
   vtkTimerLog::MarkStartEvent("Dataserver gathering to 0");
 
+  if (vtkMPIMoveData::UseChunkedMarshaling && !output->IsA("vtkImageData"))
+  {
+    this->DataServerGatherToZeroChunked(input, output);
+    vtkTimerLog::MarkEndEvent("Dataserver gathering to 0");
+    return;
+  }
+
   vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "gather-to-0");
-  int idx;
   int myId = this->Controller->GetLocalProcessId();
-  auto com = this->Controller->GetCommunicator();
-  if (com == nullptr)
+  if (this->Controller->GetCommunicator() == nullptr)
   {
     vtkErrorMacro("MPICommunicator neededfor this operation.");
     return;
   }
   this->ClearBuffer();
   this->MarshalDataToBuffer(input);
+  this->GatherMarshaledBufferToZero();
+
+  if (myId == 0)
+  {
+    vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "gathered %lld bytes",
+      static_cast<long long>(this->BufferTotalLength));
+    this->ReconstructDataFromBuffer(output);
+  }
+
+  // int fixme; // Do not clear buffers here
+  this->ClearBuffer();
+
+  vtkTimerLog::MarkEndEvent("Dataserver gathering to 0");
+}
+
+//-----------------------------------------------------------------------------
+void vtkMPIMoveData::GatherMarshaledBufferToZero()
+{
+  int numProcs = this->Controller->GetNumberOfProcesses();
+  int myId = this->Controller->GetLocalProcessId();
+  auto com = this->Controller->GetCommunicator();
+  int idx;
 
   // Save a copy of the buffer so we can receive into the buffer.
   // We will be responsiblefor deleting the buffer.
@@ -662,18 +1133,228 @@ void vtkMPIMoveData::DataServerGatherToZero(vtkDataObject* input, vtkDataObject*
     inBuffer, this->Buffers, inBufferLength, this->BufferLengths, this->BufferOffsets, 0);
   this->NumberOfBuffers = numProcs;
 
-  if (myId == 0)
+  delete[] inBuffer;
+  inBuffer = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+void vtkMPIMoveData::DataServerGatherAllChunked(vtkDataObject* input, vtkDataObject* output)
+{
+  using namespace vtkMPIMoveDataChunked;
+  vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "gather-all (chunked)");
+
+  const int numProcs = this->Controller->GetNumberOfProcesses();
+  const int myId = this->Controller->GetLocalProcessId();
+  auto com = this->Controller->GetCommunicator();
+  if (com == nullptr)
   {
-    this->ReconstructDataFromBuffer(output);
+    vtkErrorMacro("MPICommunicator neededfor this operation.");
+    return;
   }
 
-  // int fixme; // Do not clear buffers here
-  this->ClearBuffer();
+  vtkSmartPointer<vtkDataObject> localData = input;
+  if (localData == nullptr)
+  {
+    localData = vtk::TakeSmartPointer(vtkDataObjectTypes::NewDataObject(this->OutputDataType));
+  }
 
-  delete[] inBuffer;
-  inBuffer = nullptr;
+  std::vector<Piece> pieces(numProcs);
+  {
+    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "exchange headers");
+    pieces[myId] = Split(localData);
+    vtkMultiProcessStream header;
+    Serialize(pieces[myId].Leaves, header);
+    std::vector<vtkMultiProcessStream> headers;
+    this->Controller->AllGather(header, headers);
+    for (int cc = 0; cc < numProcs; ++cc)
+    {
+      if (cc != myId)
+      {
+        Deserialize(headers[cc], pieces[cc].Leaves);
+        AllocatePayload(pieces[cc]);
+      }
+    }
+  }
 
-  vtkTimerLog::MarkEndEvent("Dataserver gathering to 0");
+  vtkIdType skeletonBytes = 0;
+  {
+    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "exchange skeletons");
+    this->ClearBuffer();
+    this->MarshalDataToBuffer(pieces[myId].Skeleton);
+    this->AllGatherMarshaledBuffer();
+    skeletonBytes = this->BufferTotalLength;
+    std::vector<vtkSmartPointer<vtkDataObject>> skeletons;
+    this->ReconstructPiecesFromBuffer(skeletons, false, myId);
+    this->ClearBuffer();
+    for (int cc = 0; cc < numProcs; ++cc)
+    {
+      if (cc != myId)
+      {
+        pieces[cc].Skeleton = skeletons[cc];
+      }
+    }
+  }
+
+  // Each rank broadcasts its own arrays, chunk by chunk, straight from the
+  // array memory. The other ranks receive directly into the pre-sized arrays.
+  vtkIdType payloadBytes = 0;
+  vtkIdType numChunks = 0;
+  {
+    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "exchange arrays");
+    for (int cc = 0; cc < numProcs; ++cc)
+    {
+      for (auto& array : pieces[cc].Payload)
+      {
+        payloadBytes += ForEachChunk(
+          array, vtkMPIMoveData::MarshalingChunkSize, [&](char* ptr, vtkIdType length) {
+            com->Broadcast(ptr, length, cc);
+            ++numChunks;
+          });
+      }
+    }
+  }
+
+  std::vector<vtkSmartPointer<vtkDataObject>> merged(numProcs);
+  {
+    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "reconstruct");
+    for (int cc = 0; cc < numProcs; ++cc)
+    {
+      if (cc == myId)
+      {
+        merged[cc] = vtk::TakeSmartPointer(localData->NewInstance());
+        merged[cc]->ShallowCopy(localData);
+      }
+      else
+      {
+        merged[cc] = Assemble(pieces[cc]);
+      }
+      // reconstructing data distributted on MPI node, so global ids are valid
+      unsetGlobalIdsAttribute(merged[cc]);
+    }
+    vtkMPIMoveDataMerge(merged, output);
+  }
+
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(),
+    "gathered %lld bytes (skeletons: %lld bytes, arrays: %lld bytes in %lld chunks)",
+    static_cast<long long>(skeletonBytes + payloadBytes), static_cast<long long>(skeletonBytes),
+    static_cast<long long>(payloadBytes), static_cast<long long>(numChunks));
+}
+
+//-----------------------------------------------------------------------------
+void vtkMPIMoveData::DataServerGatherToZeroChunked(vtkDataObject* input, vtkDataObject* output)
+{
+  using namespace vtkMPIMoveDataChunked;
+  vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "gather-to-0 (chunked)");
+
+  const int numProcs = this->Controller->GetNumberOfProcesses();
+  const int myId = this->Controller->GetLocalProcessId();
+  auto com = this->Controller->GetCommunicator();
+  if (com == nullptr)
+  {
+    vtkErrorMacro("MPICommunicator neededfor this operation.");
+    return;
+  }
+
+  vtkSmartPointer<vtkDataObject> localData = input;
+  if (localData == nullptr)
+  {
+    localData = vtk::TakeSmartPointer(vtkDataObjectTypes::NewDataObject(this->OutputDataType));
+  }
+
+  // Only the root needs the pieces from the other ranks.
+  std::vector<Piece> pieces(myId == 0 ? numProcs : 1);
+  Piece& localPiece = pieces[0];
+  {
+    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "gather headers");
+    localPiece = Split(localData);
+    vtkMultiProcessStream header;
+    Serialize(localPiece.Leaves, header);
+    std::vector<vtkMultiProcessStream> headers;
+    this->Controller->Gather(header, headers, 0);
+    if (myId == 0)
+    {
+      for (int cc = 1; cc < numProcs; ++cc)
+      {
+        Deserialize(headers[cc], pieces[cc].Leaves);
+        AllocatePayload(pieces[cc]);
+      }
+    }
+  }
+
+  vtkIdType skeletonBytes = 0;
+  {
+    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "gather skeletons");
+    this->ClearBuffer();
+    this->MarshalDataToBuffer(localPiece.Skeleton);
+    skeletonBytes = this->BufferTotalLength;
+    this->GatherMarshaledBufferToZero();
+    if (myId == 0)
+    {
+      skeletonBytes = this->BufferTotalLength;
+      std::vector<vtkSmartPointer<vtkDataObject>> skeletons;
+      this->ReconstructPiecesFromBuffer(skeletons, false, 0);
+      for (int cc = 1; cc < numProcs; ++cc)
+      {
+        pieces[cc].Skeleton = skeletons[cc];
+      }
+    }
+    this->ClearBuffer();
+  }
+
+  // Satellites send their arrays straight from the array memory, chunk by
+  // chunk. The root receives directly into the pre-sized arrays.
+  vtkIdType payloadBytes = 0;
+  vtkIdType numChunks = 0;
+  {
+    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "gather arrays");
+    if (myId == 0)
+    {
+      for (int cc = 1; cc < numProcs; ++cc)
+      {
+        for (auto& array : pieces[cc].Payload)
+        {
+          payloadBytes += ForEachChunk(
+            array, vtkMPIMoveData::MarshalingChunkSize, [&](char* ptr, vtkIdType length) {
+              com->Receive(ptr, length, cc, PAYLOAD_TAG);
+              ++numChunks;
+            });
+        }
+      }
+    }
+    else
+    {
+      for (auto& array : localPiece.Payload)
+      {
+        payloadBytes += ForEachChunk(
+          array, vtkMPIMoveData::MarshalingChunkSize, [&](char* ptr, vtkIdType length) {
+            com->Send(ptr, length, 0, PAYLOAD_TAG);
+            ++numChunks;
+          });
+      }
+    }
+  }
+
+  if (myId == 0)
+  {
+    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "reconstruct");
+    std::vector<vtkSmartPointer<vtkDataObject>> merged(numProcs);
+    merged[0] = vtk::TakeSmartPointer(localData->NewInstance());
+    merged[0]->ShallowCopy(localData);
+    unsetGlobalIdsAttribute(merged[0]);
+    for (int cc = 1; cc < numProcs; ++cc)
+    {
+      merged[cc] = Assemble(pieces[cc]);
+      // reconstructing data distributted on MPI node, so global ids are valid
+      unsetGlobalIdsAttribute(merged[cc]);
+    }
+    vtkMPIMoveDataMerge(merged, output);
+  }
+
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(),
+    "%s %lld bytes (skeletons: %lld bytes, arrays: %lld bytes in %lld chunks)",
+    (myId == 0 ? "received" : "sent"), static_cast<long long>(skeletonBytes + payloadBytes),
+    static_cast<long long>(skeletonBytes), static_cast<long long>(payloadBytes),
+    static_cast<long long>(numChunks));
 }
 
 //-----------------------------------------------------------------------------
@@ -1022,9 +1703,23 @@ void vtkMPIMoveData::ReconstructDataFromBuffer(vtkDataObject* data)
 
   bool is_image_data = data->IsA("vtkImageData") != 0;
   std::vector<vtkSmartPointer<vtkDataObject>> pieces;
+  this->ReconstructPiecesFromBuffer(pieces, is_image_data);
+  vtkMPIMoveDataMerge(pieces, data);
+}
 
+//-----------------------------------------------------------------------------
+void vtkMPIMoveData::ReconstructPiecesFromBuffer(
+  std::vector<vtkSmartPointer<vtkDataObject>>& pieces, bool is_image_data, int skip)
+{
+  pieces.clear();
   for (int idx = 0; idx < this->NumberOfBuffers; ++idx)
   {
+    if (idx == skip || this->Buffers == nullptr)
+    {
+      pieces.emplace_back(nullptr);
+      continue;
+    }
+
     char* bufferArray = this->Buffers + this->BufferOffsets[idx];
     vtkIdType bufferLength = this->BufferLengths[idx];
 
@@ -1101,8 +1796,6 @@ void vtkMPIMoveData::ReconstructDataFromBuffer(vtkDataObject* data)
     delete[] realBuffer;
     realBuffer = nullptr;
   }
-
-  vtkMPIMoveDataMerge(pieces, data);
 }
 
 //-----------------------------------------------------------------------------
@@ -17,6 +17,9 @@
 
 #include "vtkPVVTKExtensionsFiltersRenderingModule.h" //needed for exports
 #include "vtkPassInputTypeAlgorithm.h"
+#include "vtkSmartPointer.h" // for vtkSmartPointer
+
+#include <vector> // for std::vector
 
 class vtkMultiProcessController;
 class vtkSocketController;
@@ -102,6 +105,34 @@ public:
   static bool GetUseZLibCompression();
   ///@}
 
+  ///@{
+  /**
+   * When set to true, the gather operations on the data server (used for
+   * COLLECT and CLONE modes) use a chunked marshaling path. Instead of
+   * serializing the complete dataset into a single contiguous buffer, only a
+   * light-weight skeleton of each piece goes through the legacy writer. The
+   * points, topology and attribute arrays of vtkPolyData and
+   * vtkUnstructuredGrid leaves are sent straight from the vtkDataArray memory
+   * in chunks of at most `MarshalingChunkSize` bytes and received directly
+   * into pre-sized arrays. False by default. This must be set consistently on
+   * all data server ranks.
+   *
+   * Bytes transferred and time spent in each stage are logged under
+   * `PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY()`.
+   */
+  static void SetUseChunkedMarshaling(bool b);
+  static bool GetUseChunkedMarshaling();
+  ///@}
+
+  ///@{
+  /**
+   * Maximum size, in bytes, of a single message used by the chunked
+   * marshaling path. Default is 64 MiB. Values smaller than 1 KiB are clamped.
+   */
+  static void SetMarshalingChunkSize(vtkIdType size);
+  static vtkIdType GetMarshalingChunkSize();
+  ///@}
+
   /**
    * vtkMPIMoveData doesn't necessarily generate a valid output data on all the
    * involved processes (depending on the MoveMode and Server ivars). This
@@ -146,6 +177,8 @@ protected:
   void DataServerAllToN(vtkDataObject* inData, vtkDataObject* outData, int n);
   void DataServerGatherAll(vtkDataObject* input, vtkDataObject* output);
   void DataServerGatherToZero(vtkDataObject* input, vtkDataObject* output);
+  void DataServerGatherAllChunked(vtkDataObject* input, vtkDataObject* output);
+  void DataServerGatherToZeroChunked(vtkDataObject* input, vtkDataObject* output);
   void DataServerSendToRenderServer(vtkDataObject* output);
   void RenderServerReceiveFromDataServer(vtkDataObject* output);
   void DataServerZeroSendToRenderServerZero(vtkDataObject* data);
@@ -164,6 +197,23 @@ protected:
   void MarshalDataToBuffer(vtkDataObject* data);
   void ReconstructDataFromBuffer(vtkDataObject* data);
 
+  ///@{
+  /**
+   * Helpers to collect the single buffer produced by MarshalDataToBuffer
+   * from all ranks (or to rank 0). On return, the buffer ivars describe one
+   * buffer per rank.
+   */
+  void AllGatherMarshaledBuffer();
+  void GatherMarshaledBufferToZero();
+  ///@}
+
+  /**
+   * Reads each buffer into a data object, without merging them. The buffer
+   * at index `skip` (if any) is not read and a nullptr is placed in its slot.
+   */
+  void ReconstructPiecesFromBuffer(
+    std::vector<vtkSmartPointer<vtkDataObject>>& pieces, bool isImageData, int skip = -1);
+
   int MoveMode;
   int Server;
 
@@ -186,6 +236,8 @@ private:
   void operator=(const vtkMPIMoveData&) = delete;
 
   static bool UseZLibCompression;
+  static bool UseChunkedMarshaling;
+  static vtkIdType MarshalingChunkSize;
 };
 
 #endif
@@ -25,6 +25,8 @@
 #include "vtkGenericDataSet.h"
 #include "vtkGenericGeometryFilter.h"
 #include "vtkGeometryFilter.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkHyperTreeGrid.h"
 #include "vtkHyperTreeGridFeatureEdges.h"
 #include "vtkHyperTreeGridGeometry.h"
@@ -48,6 +50,8 @@
 #include "vtkRecoverGeometryWireframe.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkRectilinearGridOutlineFilter.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
@@ -60,8 +64,12 @@
 #include "vtkUnstructuredGrid.h"
 #include "vtkUnstructuredGridGeometryFilter.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -83,6 +91,182 @@ void GetValidWholeExtent(T* ds, const int wholeExt[6], int validWholeExt[6])
   }
 }
 
+namespace
+{
+bool UseSMPBlockExecution = true;
+
+// Returns the modification times of what the surface of `ds` depends on, but
+// the attributes other than the ghost arrays. Returns an empty vector for the
+// types of datasets whose surface is not cached.
+std::vector<vtkMTimeType> GetGeometryKey(vtkDataSet* ds)
+{
+  std::vector<vtkMTimeType> key;
+  auto add = [&key](vtkObject* object) { key.push_back(object ? object->GetMTime() : 0); };
+  auto addCells = [&add](vtkCellArray* cells) {
+    add(cells);
+    add(cells ? cells->GetOffsetsArray() : nullptr);
+    add(cells ? cells->GetConnectivityArray() : nullptr);
+  };
+  if (auto ug = vtkUnstructuredGrid::SafeDownCast(ds))
+  {
+    key.push_back(VTK_UNSTRUCTURED_GRID);
+    add(ug->GetPoints());
+    addCells(ug->GetCells());
+    add(ug->GetCellTypesArray());
+    add(ug->GetFaces());
+    add(ug->GetFaceLocations());
+  }
+  else if (auto pd = vtkPolyData::SafeDownCast(ds))
+  {
+    key.push_back(VTK_POLY_DATA);
+    add(pd->GetPoints());
+    addCells(pd->GetVerts());
+    addCells(pd->GetLines());
+    addCells(pd->GetPolys());
+    addCells(pd->GetStrips());
+  }
+  else
+  {
+    return key;
+  }
+  add(ds->GetPointData()->GetArray(vtkDataSetAttributes::GhostArrayName()));
+  add(ds->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()));
+  return key;
+}
+
+// Returns the ids stored in the array `name` of `attributes`, provided they
+// all are valid ids of an input with `count` elements.
+vtkSmartPointer<vtkIdList> GetIdMap(vtkDataSetAttributes* attributes, const char* name,
+  vtkIdType numberOfTuples, vtkIdType count)
+{
+  vtkIdTypeArray* array = vtkIdTypeArray::SafeDownCast(attributes->GetArray(name));
+  if (!array || array->GetNumberOfComponents() != 1 ||
+    array->GetNumberOfTuples() != numberOfTuples)
+  {
+    return nullptr;
+  }
+  auto ids = vtkSmartPointer<vtkIdList>::New();
+  ids->SetNumberOfIds(numberOfTuples);
+  for (vtkIdType cc = 0; cc < numberOfTuples; ++cc)
+  {
+    const vtkIdType id = array->GetValue(cc);
+    if (id < 0 || id >= count)
+    {
+      return nullptr;
+    }
+    ids->SetId(cc, id);
+  }
+  return ids;
+}
+
+// Splits the arrays of `output` between the ones passed from `input` and the
+// ones generated by the filter, which are added to `surface`. The names of the
+// input arrays that were not passed are added to `dropped`.
+bool SplitArrays(vtkDataSetAttributes* input, vtkDataSetAttributes* output,
+  vtkDataSetAttributes* surface, std::set<std::string>& dropped)
+{
+  for (int cc = 0; cc < output->GetNumberOfArrays(); ++cc)
+  {
+    vtkAbstractArray* array = output->GetAbstractArray(cc);
+    if (!array->GetName())
+    {
+      return false;
+    }
+    if (!input->GetAbstractArray(array->GetName()))
+    {
+      surface->AddArray(array);
+    }
+  }
+  for (int type = 0; type < vtkDataSetAttributes::NUM_ATTRIBUTES; ++type)
+  {
+    vtkAbstractArray* attribute = output->GetAbstractAttribute(type);
+    if (attribute && surface->GetAbstractArray(attribute->GetName()))
+    {
+      surface->SetActiveAttribute(attribute->GetName(), type);
+    }
+  }
+  for (int cc = 0; cc < input->GetNumberOfArrays(); ++cc)
+  {
+    const char* name = input->GetAbstractArray(cc)->GetName();
+    if (!name)
+    {
+      return false;
+    }
+    if (!output->GetAbstractArray(name))
+    {
+      dropped.insert(name);
+    }
+  }
+  return true;
+}
+
+// Fills `output` with the arrays of `input` gathered at `ids`, and the arrays
+// generated by the filter cached in `surface`.
+void GatherArrays(vtkDataSetAttributes* input, vtkDataSetAttributes* surface, vtkIdList* ids,
+  const std::set<std::string>& dropped, vtkDataSetAttributes* output)
+{
+  for (int cc = 0; cc < input->GetNumberOfArrays(); ++cc)
+  {
+    vtkAbstractArray* array = input->GetAbstractArray(cc);
+    if (!array->GetName() || dropped.count(array->GetName()) != 0)
+    {
+      continue;
+    }
+    auto gathered = vtkSmartPointer<vtkAbstractArray>::Take(array->NewInstance());
+    gathered->SetName(array->GetName());
+    gathered->SetNumberOfComponents(array->GetNumberOfComponents());
+    gathered->CopyComponentNames(array);
+    gathered->SetNumberOfTuples(ids->GetNumberOfIds());
+    array->GetTuples(ids, gathered);
+    output->AddArray(gathered);
+  }
+  for (int type = 0; type < vtkDataSetAttributes::NUM_ATTRIBUTES; ++type)
+  {
+    vtkAbstractArray* attribute = input->GetAbstractAttribute(type);
+    if (attribute && output->GetAbstractArray(attribute->GetName()))
+    {
+      output->SetActiveAttribute(attribute->GetName(), type);
+    }
+  }
+  for (int cc = 0; cc < surface->GetNumberOfArrays(); ++cc)
+  {
+    vtkAbstractArray* array = surface->GetAbstractArray(cc);
+    if (!output->GetAbstractArray(array->GetName()))
+    {
+      output->AddArray(array);
+    }
+  }
+  for (int type = 0; type < vtkDataSetAttributes::NUM_ATTRIBUTES; ++type)
+  {
+    vtkAbstractArray* attribute = surface->GetAbstractAttribute(type);
+    if (attribute && !output->GetAbstractAttribute(type))
+    {
+      output->SetActiveAttribute(attribute->GetName(), type);
+    }
+  }
+}
+}
+
+class vtkPVGeometryFilter::vtkSurfaceCache
+{
+public:
+  struct Leaf
+  {
+    std::vector<vtkMTimeType> Key;
+    vtkMTimeType FilterMTime = 0;
+    // The points and cells of the surface, and the arrays generated by the
+    // filter, including the original ids.
+    vtkSmartPointer<vtkPolyData> Surface;
+    vtkSmartPointer<vtkIdList> PointIds;
+    vtkSmartPointer<vtkIdList> CellIds;
+    // Names of the input arrays that are not passed to the surface.
+    std::set<std::string> DroppedPointArrays;
+    std::set<std::string> DroppedCellArrays;
+  };
+
+  std::map<unsigned int, Leaf> Leaves;
+};
+
 vtkStandardNewMacro(vtkPVGeometryFilter);
 vtkCxxSetObjectMacro(vtkPVGeometryFilter, Controller, vtkMultiProcessController);
 vtkInformationKeyMacro(vtkPVGeometryFilter, POINT_OFFSETS, IntegerVector);
@@ -140,6 +324,18 @@ public:
   int Commutative() override { return 1; }
 };
 
+//----------------------------------------------------------------------------
+void vtkPVGeometryFilter::SetUseSMPBlockExecution(bool value)
+{
+  UseSMPBlockExecution = value;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVGeometryFilter::GetUseSMPBlockExecution()
+{
+  return UseSMPBlockExecution;
+}
+
 //----------------------------------------------------------------------------
 vtkPVGeometryFilter::vtkPVGeometryFilter()
 {
@@ -186,6 +382,10 @@ vtkPVGeometryFilter::vtkPVGeometryFilter()
 
   this->HideInternalAMRFaces = true;
   this->UseNonOverlappingAMRMetaDataForOutlines = true;
+
+  this->CacheSurfaces = true;
+  this->NumberOfReusedSurfaces = 0;
+  this->SurfaceCache.reset(new vtkSurfaceCache());
 }
 
 //----------------------------------------------------------------------------
@@ -499,6 +699,11 @@ int vtkPVGeometryFilter::RequestData(
 {
   this->GeometryFilter->SetRemoveGhostInterfaces(!this->GenerateFeatureEdges);
   vtkDataObject* input = vtkDataObject::GetData(inputVector[0], 0);
+  this->NumberOfReusedSurfaces = 0;
+  if (!vtkDataObjectTree::SafeDownCast(input))
+  {
+    this->ClearSurfaceCache();
+  }
   if (vtkCompositeDataSet::SafeDownCast(input))
   {
     vtkTimerLog::MarkStartEvent("vtkPVGeometryFilter::RequestData");
@@ -938,46 +1143,104 @@ int vtkPVGeometryFilter::RequestDataObjectTree(
   inIter->VisitOnlyLeavesOn();
   inIter->SkipEmptyNodesOn();
 
-  // get a block count for progress scaling.
-  unsigned int totNumBlocks = 0;
+  // collect the leaves first, so that they can be processed concurrently.
+  std::vector<vtkDataObject*> blocks;
+  std::vector<unsigned int> flatIndices;
   for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem())
   {
-    ++totNumBlocks;
+    if (vtkDataObject* block = inIter->GetCurrentDataObject())
+    {
+      blocks.push_back(block);
+      flatIndices.push_back(inIter->GetCurrentFlatIndex());
+    }
   }
+  const vtkIdType numBlocks = static_cast<vtkIdType>(blocks.size());
 
   int* wholeExtent =
     vtkStreamingDemandDrivenPipeline::GetWholeExtent(inputVector[0]->GetInformationObject(0));
-  int numInputs = 0;
-  for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem())
-  {
-    vtkDataObject* block = inIter->GetCurrentDataObject();
-    if (!block)
-    {
-      continue;
-    }
-
+  std::vector<vtkSmartPointer<vtkPolyData>> outputs(numBlocks);
+  std::vector<int> outlineFlags(numBlocks, 0);
+  std::atomic<vtkIdType> numReused(0);
+  this->PrepareSurfaceCache(flatIndices);
+  auto executeLeaf = [&](vtkPVGeometryFilter* self, vtkIdType cc) {
     vtkNew<vtkPolyData> tmpOut;
     vtkHyperTreeGrid* inputHTG = vtkHyperTreeGrid::SafeDownCast(input);
-    if (this->GenerateFeatureEdges && inputHTG)
+    if (self->GenerateFeatureEdges && inputHTG)
     {
-      this->GenerateFeatureEdgesHTG(inputHTG, tmpOut);
+      self->GenerateFeatureEdgesHTG(inputHTG, tmpOut);
+    }
+    else if (this->ReuseSurface(blocks[cc], flatIndices[cc], tmpOut))
+    {
+      self->OutlineFlag = 0;
+      ++numReused;
     }
     else
     {
-      this->ExecuteBlock(block, tmpOut, 0, 0, 1, 0, wholeExtent);
-      this->CleanupOutputData(tmpOut, 0);
+      self->ExecuteBlock(blocks[cc], tmpOut, 0, 0, 1, 0, wholeExtent);
+      self->CleanupOutputData(tmpOut, 0);
+      this->StoreSurface(blocks[cc], flatIndices[cc], tmpOut);
     }
+    outlineFlags[cc] = self->OutlineFlag;
     // skip empty nodes.
     if (tmpOut->GetNumberOfPoints() > 0)
     {
-      output->SetDataSet(inIter, tmpOut);
+      self->AddCompositeIndex(tmpOut, flatIndices[cc]);
+      outputs[cc] = tmpOut;
+    }
+  };
 
-      const unsigned int current_flat_index = inIter->GetCurrentFlatIndex();
-      this->AddCompositeIndex(tmpOut, current_flat_index);
+  if (UseSMPBlockExecution && numBlocks > 1)
+  {
+    // Blocks are not communicated about (doCommunicate is 0), hence the only
+    // state shared between blocks is the internal filters. Each thread uses
+    // its own geometry filter configured as this one.
+    vtkSMPThreadLocal<vtkSmartPointer<vtkPVGeometryFilter>> workers;
+    vtkSMPTools::For(0, numBlocks, [&](vtkIdType begin, vtkIdType end) {
+      vtkSmartPointer<vtkPVGeometryFilter>& worker = workers.Local();
+      if (!worker)
+      {
+        worker = vtkSmartPointer<vtkPVGeometryFilter>::New();
+        this->CopyBlockExecutionSettings(worker);
+      }
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        executeLeaf(worker, cc);
+      }
+    });
+    // release the workers, and the objects they hold, on this thread.
+    for (auto& worker : workers)
+    {
+      worker = nullptr;
+    }
+    this->UpdateProgress(1.0);
+  }
+  else
+  {
+    for (vtkIdType cc = 0; cc < numBlocks; ++cc)
+    {
+      executeLeaf(this, cc);
+      this->UpdateProgress(static_cast<float>(cc + 1) / numBlocks);
     }
+  }
+  if (numBlocks > 0)
+  {
+    this->OutlineFlag = outlineFlags.back();
+  }
+  this->NumberOfReusedSurfaces = numReused;
 
-    numInputs++;
-    this->UpdateProgress(static_cast<float>(numInputs) / totNumBlocks);
+  // assign the outputs in the order of the blocks, so that the result does
+  // not depend on how the blocks were scheduled.
+  vtkIdType cc = 0;
+  for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem())
+  {
+    if (cc < numBlocks && inIter->GetCurrentDataObject() == blocks[cc])
+    {
+      if (outputs[cc])
+      {
+        output->SetDataSet(inIter, outputs[cc]);
+      }
+      ++cc;
+    }
   }
   vtkTimerLog::MarkEndEvent("vtkPVGeometryFilter::ExecuteCompositeDataSet");
 
@@ -1822,10 +2085,137 @@ void vtkPVGeometryFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "PassThroughPointIds: " << (this->PassThroughPointIds ? "on" : "off") << endl;
   os << indent << "GenerateProcessIds: " << (this->GenerateProcessIds ? "on" : "off") << endl;
   os << indent << "HideInternalAMRFaces: " << (this->HideInternalAMRFaces ? "on" : "off") << endl;
+  os << indent << "CacheSurfaces: " << (this->CacheSurfaces ? "on" : "off") << endl;
+  os << indent << "NumberOfReusedSurfaces: " << this->NumberOfReusedSurfaces << endl;
   os << indent << "UseNonOverlappingAMRMetaDataForOutlines: "
      << (this->UseNonOverlappingAMRMetaDataForOutlines ? "on" : "off") << endl;
 }
 
+//----------------------------------------------------------------------------
+void vtkPVGeometryFilter::CopyBlockExecutionSettings(vtkPVGeometryFilter* worker)
+{
+  worker->SetUseOutline(this->UseOutline);
+  worker->SetGenerateFeatureEdges(this->GenerateFeatureEdges);
+  worker->SetBlockColorsDistinctValues(this->BlockColorsDistinctValues);
+  worker->SetGenerateCellNormals(this->GenerateCellNormals);
+  worker->SetTriangulate(this->Triangulate);
+  worker->SetNonlinearSubdivisionLevel(this->NonlinearSubdivisionLevel);
+  worker->SetMatchBoundariesIgnoringCellOrder(this->MatchBoundariesIgnoringCellOrder);
+  worker->SetController(this->Controller);
+  worker->SetGenerateProcessIds(this->GenerateProcessIds);
+  worker->SetPassThroughCellIds(this->PassThroughCellIds);
+  worker->SetPassThroughPointIds(this->PassThroughPointIds);
+  worker->SetHideInternalAMRFaces(this->HideInternalAMRFaces);
+  worker->SetUseNonOverlappingAMRMetaDataForOutlines(
+    this->UseNonOverlappingAMRMetaDataForOutlines);
+  worker->GeometryFilter->SetRemoveGhostInterfaces(!this->GenerateFeatureEdges);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeometryFilter::ClearSurfaceCache()
+{
+  this->SurfaceCache->Leaves.clear();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeometryFilter::PrepareSurfaceCache(const std::vector<unsigned int>& indices)
+{
+  if (!this->CacheSurfaces)
+  {
+    this->ClearSurfaceCache();
+    return;
+  }
+  std::map<unsigned int, vtkSurfaceCache::Leaf> leaves;
+  for (unsigned int index : indices)
+  {
+    auto iter = this->SurfaceCache->Leaves.find(index);
+    if (iter != this->SurfaceCache->Leaves.end())
+    {
+      leaves[index] = std::move(iter->second);
+    }
+    else
+    {
+      leaves[index] = vtkSurfaceCache::Leaf();
+    }
+  }
+  this->SurfaceCache->Leaves.swap(leaves);
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVGeometryFilter::ReuseSurface(
+  vtkDataObject* input, unsigned int index, vtkPolyData* output)
+{
+  auto iter = this->SurfaceCache->Leaves.find(index);
+  vtkDataSet* ds = vtkDataSet::SafeDownCast(input);
+  if (!this->CacheSurfaces || !ds || iter == this->SurfaceCache->Leaves.end())
+  {
+    return false;
+  }
+  const vtkSurfaceCache::Leaf& leaf = iter->second;
+  if (!leaf.Surface || leaf.FilterMTime != this->GetMTime() || leaf.Key != GetGeometryKey(ds))
+  {
+    return false;
+  }
+
+  output->CopyStructure(leaf.Surface);
+  output->GetFieldData()->PassData(input->GetFieldData());
+  GatherArrays(ds->GetPointData(), leaf.Surface->GetPointData(), leaf.PointIds,
+    leaf.DroppedPointArrays, output->GetPointData());
+  GatherArrays(ds->GetCellData(), leaf.Surface->GetCellData(), leaf.CellIds,
+    leaf.DroppedCellArrays, output->GetCellData());
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeometryFilter::StoreSurface(
+  vtkDataObject* input, unsigned int index, vtkPolyData* output)
+{
+  auto iter = this->SurfaceCache->Leaves.find(index);
+  if (iter == this->SurfaceCache->Leaves.end())
+  {
+    return;
+  }
+  vtkSurfaceCache::Leaf& leaf = iter->second;
+  leaf = vtkSurfaceCache::Leaf();
+
+  vtkDataSet* ds = vtkDataSet::SafeDownCast(input);
+  if (!this->CacheSurfaces || !ds)
+  {
+    return;
+  }
+  std::vector<vtkMTimeType> key = GetGeometryKey(ds);
+  if (key.empty())
+  {
+    return;
+  }
+  // the surface can only be reused if every point and every cell comes from
+  // the input.
+  vtkSmartPointer<vtkIdList> pointIds = GetIdMap(output->GetPointData(), "vtkOriginalPointIds",
+    output->GetNumberOfPoints(), ds->GetNumberOfPoints());
+  vtkSmartPointer<vtkIdList> cellIds = GetIdMap(output->GetCellData(), "vtkOriginalCellIds",
+    output->GetNumberOfCells(), ds->GetNumberOfCells());
+  if (!pointIds || !cellIds)
+  {
+    return;
+  }
+
+  vtkNew<vtkPolyData> surface;
+  surface->CopyStructure(output);
+  if (!SplitArrays(ds->GetPointData(), output->GetPointData(), surface->GetPointData(),
+        leaf.DroppedPointArrays) ||
+    !SplitArrays(
+      ds->GetCellData(), output->GetCellData(), surface->GetCellData(), leaf.DroppedCellArrays))
+  {
+    leaf = vtkSurfaceCache::Leaf();
+    return;
+  }
+  leaf.Key = std::move(key);
+  leaf.FilterMTime = this->GetMTime();
+  leaf.Surface = surface;
+  leaf.PointIds = pointIds;
+  leaf.CellIds = cellIds;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVGeometryFilter::SetPassThroughCellIds(int newvalue)
 {
@@ -6,6 +6,14 @@
  *
  * This filter defaults to using the outline filter unless the input
  * is a structured volume.
+ *
+ * For composite datasets, the surface extracted for each unstructured grid or
+ * polydata leaf is cached along with the original point and cell ids. When the
+ * filter re-executes and the points, cells and ghost arrays of a leaf are
+ * unchanged, the attributes of the leaf are gathered onto the cached surface
+ * instead of extracting it again. This requires PassThroughPointIds and
+ * PassThroughCellIds to be on, and is not done for the surfaces that
+ * introduce new points, such as subdivided nonlinear cells.
  */
 
 #ifndef vtkPVGeometryFilter_h
@@ -14,6 +22,9 @@
 #include "vtkDataObjectAlgorithm.h"
 #include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for export macro
 
+#include <memory> // for std::unique_ptr
+#include <vector> // for std::vector
+
 class vtkCallbackCommand;
 class vtkCellGrid;
 class vtkDataSet;
@@ -124,6 +135,16 @@ public:
   vtkGetMacro(MatchBoundariesIgnoringCellOrder, int);
   ///@}
 
+  ///@{
+  /**
+   * When set, the leaves of composite datasets other than AMR are processed
+   * concurrently using vtkSMPTools. The output does not depend on this setting.
+   * Default is true.
+   */
+  static void SetUseSMPBlockExecution(bool);
+  static bool GetUseSMPBlockExecution();
+  ///@}
+
   ///@{
   /**
    * Set and get the controller.
@@ -191,6 +212,28 @@ public:
   vtkBooleanMacro(UseNonOverlappingAMRMetaDataForOutlines, bool);
   ///@}
 
+  ///@{
+  /**
+   * When set to true (default), the surfaces extracted for the leaves of
+   * composite datasets are cached so that only the attributes are updated when
+   * the geometry of a leaf did not change. See class documentation.
+   */
+  vtkSetMacro(CacheSurfaces, bool);
+  vtkGetMacro(CacheSurfaces, bool);
+  vtkBooleanMacro(CacheSurfaces, bool);
+  ///@}
+
+  /**
+   * Release the cached surfaces.
+   */
+  void ClearSurfaceCache();
+
+  /**
+   * Return the number of leaves whose surface was reused from the cache during
+   * the last execution.
+   */
+  vtkGetMacro(NumberOfReusedSurfaces, vtkIdType);
+
   // These keys are put in the output composite-data metadata for multipieces
   // since this filter merges multipieces together.
   static vtkInformationIntegerVectorKey* POINT_OFFSETS();
@@ -309,6 +352,8 @@ protected:
   bool HideInternalAMRFaces;
   bool UseNonOverlappingAMRMetaDataForOutlines;
   bool GenerateFeatureEdges;
+  bool CacheSurfaces;
+  vtkIdType NumberOfReusedSurfaces;
 
 private:
   vtkPVGeometryFilter(const vtkPVGeometryFilter&) = delete;
@@ -342,6 +387,26 @@ private:
    * vtkPolydata.
    */
   void GenerateProcessIdsArrays(vtkPolyData* output);
+
+  /**
+   * Configure a filter used to process the leaves of a composite dataset
+   * in another thread as this one.
+   */
+  void CopyBlockExecutionSettings(vtkPVGeometryFilter* worker);
+
+  ///@{
+  /**
+   * Manage the cache of leaf surfaces. PrepareSurfaceCache() keeps and creates
+   * the entries for the given flat indices only, so that ReuseSurface() and
+   * StoreSurface() can then be called concurrently for different leaves.
+   */
+  void PrepareSurfaceCache(const std::vector<unsigned int>& indices);
+  bool ReuseSurface(vtkDataObject* input, unsigned int index, vtkPolyData* output);
+  void StoreSurface(vtkDataObject* input, unsigned int index, vtkPolyData* output);
+  ///@}
+
+  class vtkSurfaceCache;
+  std::unique_ptr<vtkSurfaceCache> SurfaceCache;
 };
 
 #endif
@@ -18,14 +18,17 @@
 #include "vtkMath.h"
 #include "vtkMinimalStandardRandomSequence.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPartitionedDataSet.h"
 #include "vtkSmartPointer.h"
+#include "vtkSplitColumnComponents.h"
 #include "vtkStringArray.h"
 #include "vtkTable.h"
 #include "vtkUnsignedIntArray.h"
 
 #include <algorithm>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -34,6 +37,25 @@
 
 using std::ostringstream;
 
+namespace
+{
+bool UseSampleSort = true;
+
+// MTime of the partitioned dataset and of all its partitions.
+vtkMTimeType GetInputMTime(vtkPartitionedDataSet* ptd)
+{
+  vtkMTimeType mtime = ptd->GetMTime();
+  for (unsigned int cc = 0, max = ptd->GetNumberOfPartitions(); cc < max; ++cc)
+  {
+    if (auto dobj = ptd->GetPartitionAsDataObject(cc))
+    {
+      mtime = std::max(mtime, dobj->GetMTime());
+    }
+  }
+  return mtime;
+}
+}
+
 //****************************************************************************
 class vtkSortedTableStreamer::InternalsBase
 {
@@ -601,6 +623,8 @@ public:
     // Default values
     this->SelectedComponent = 0;
     this->NeedToBuildCache = true;
+    this->Sortable = -1;
+    this->GlobalSize = 0;
     this->DataToSort = dataToSort;
 
     this->InputMTime = input->GetMTime();
@@ -628,6 +652,18 @@ public:
 
   // --------------------------------------------------------------------------
   bool IsSortable() override
+  {
+    // The answer only depends on the array to sort and on the selected
+    // component, so keep it until the cache is invalidated.
+    if (this->Sortable == -1)
+    {
+      this->Sortable = this->ComputeSortable() ? 1 : 0;
+    }
+    return this->Sortable == 1;
+  }
+
+  // --------------------------------------------------------------------------
+  bool ComputeSortable()
   {
     // See if one process is able to sort the table,
     // if not then just say NOT sortable
@@ -889,6 +925,11 @@ public:
   int Compute(vtkTable* input, vtkTable* output, vtkIdType block, vtkIdType blockSize,
     bool revertOrder) override
   {
+    if (UseSampleSort)
+    {
+      return this->ComputeFromGlobalOrder(input, output, block, blockSize, revertOrder);
+    }
+
     // ------------------------------------------------------------------------
     // Make sure that the Cache is built
     //    This will sort the local array, that's why we don't want to do it
@@ -1014,6 +1055,285 @@ public:
     return 1;
   }
 
+  // --------------------------------------------------------------------------
+  // Sample sort based global ordering. Once computed, each process knows the
+  // global index of each of its locally sorted rows, so any block can be
+  // extracted without looking at the other processes.
+  // The global order sorts by value, then by process id and then by local
+  // sorted index, which keeps it consistent with every local order.
+  void BuildGlobalOrder(bool invertOrder)
+  {
+    // We are building the cache so no need to build it next time
+    this->NeedToBuildCache = false;
+
+    vtkIdType localSize = 0;
+    if (this->DataToSort)
+    {
+      localSize = this->DataToSort->GetNumberOfTuples();
+      this->LocalSorter->Update(static_cast<T*>(this->DataToSort->GetVoidPointer(0)), localSize,
+        this->DataToSort->GetNumberOfComponents(), this->SelectedComponent, HISTOGRAM_SIZE,
+        this->CommonRange, invertOrder);
+    }
+    else
+    {
+      this->LocalSorter->Clear();
+      this->LocalSorter->ArraySize = 0;
+    }
+    this->GlobalPositions.resize(localSize);
+
+    if (this->NumProcs == 1)
+    {
+      std::iota(this->GlobalPositions.begin(), this->GlobalPositions.end(), 0);
+      this->GlobalSize = localSize;
+      return;
+    }
+
+    const SortableArrayItem* items = this->LocalSorter->Array;
+    auto valueLess = [invertOrder](const T& a, const T& b) { return invertOrder ? b < a : a < b; };
+    auto keyLess = [&valueLess](const T& aValue, int aPid, vtkIdType aIdx, const T& bValue,
+                     int bPid, vtkIdType bIdx) {
+      if (valueLess(aValue, bValue))
+      {
+        return true;
+      }
+      if (valueLess(bValue, aValue))
+      {
+        return false;
+      }
+      return aPid < bPid || (aPid == bPid && aIdx < bIdx);
+    };
+
+    // ------------------------------------------------------------------------
+    // Gather regular samples from every process and choose the splitters
+    // ------------------------------------------------------------------------
+    const vtkIdType nbSamples =
+      std::min(localSize, static_cast<vtkIdType>(SAMPLE_SORT_OVERSAMPLING) * this->NumProcs);
+    std::vector<T> sampleValues(nbSamples);
+    std::vector<vtkIdType> sampleIndices(nbSamples);
+    for (vtkIdType cc = 0; cc < nbSamples; ++cc)
+    {
+      sampleIndices[cc] = (cc * localSize) / nbSamples;
+      sampleValues[cc] = items[sampleIndices[cc]].Value;
+    }
+
+    std::vector<vtkIdType> sampleCounts(this->NumProcs);
+    std::vector<vtkIdType> sampleOffsets(this->NumProcs, 0);
+    this->MPI->AllGather(&nbSamples, sampleCounts.data(), 1);
+    std::partial_sum(sampleCounts.begin(), sampleCounts.end() - 1, sampleOffsets.begin() + 1);
+    const vtkIdType totalSamples = sampleOffsets.back() + sampleCounts.back();
+    if (totalSamples == 0)
+    {
+      // Nothing to sort anywhere
+      this->GlobalSize = 0;
+      return;
+    }
+
+    std::vector<T> allSampleValues(totalSamples);
+    std::vector<vtkIdType> allSampleIndices(totalSamples);
+    std::vector<int> allSamplePids(totalSamples);
+    this->MPI->AllGatherV(sampleValues.data(), allSampleValues.data(), nbSamples,
+      sampleCounts.data(), sampleOffsets.data());
+    this->MPI->AllGatherV(sampleIndices.data(), allSampleIndices.data(), nbSamples,
+      sampleCounts.data(), sampleOffsets.data());
+    for (int pid = 0; pid < this->NumProcs; ++pid)
+    {
+      std::fill_n(allSamplePids.begin() + sampleOffsets[pid], sampleCounts[pid], pid);
+    }
+
+    std::vector<vtkIdType> samples(totalSamples);
+    std::iota(samples.begin(), samples.end(), 0);
+    std::sort(samples.begin(), samples.end(), [&](vtkIdType a, vtkIdType b) {
+      return keyLess(allSampleValues[a], allSamplePids[a], allSampleIndices[a],
+        allSampleValues[b], allSamplePids[b], allSampleIndices[b]);
+    });
+
+    // ------------------------------------------------------------------------
+    // Split the local sorted array into one bucket per process
+    // ------------------------------------------------------------------------
+    std::vector<vtkIdType> bucketBounds(this->NumProcs + 1, 0);
+    bucketBounds[this->NumProcs] = localSize;
+    for (int bucket = 1; bucket < this->NumProcs; ++bucket)
+    {
+      const vtkIdType splitter = samples[(bucket * totalSamples) / this->NumProcs];
+      // Binary search for the first local item that is not before the splitter
+      vtkIdType first = bucketBounds[bucket - 1];
+      vtkIdType count = localSize - first;
+      while (count > 0)
+      {
+        const vtkIdType step = count / 2;
+        const vtkIdType idx = first + step;
+        if (keyLess(items[idx].Value, this->Me, idx, allSampleValues[splitter],
+              allSamplePids[splitter], allSampleIndices[splitter]))
+        {
+          first = idx + 1;
+          count -= step + 1;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+      bucketBounds[bucket] = first;
+    }
+
+    std::vector<vtkIdType> localCounts(this->NumProcs);
+    std::vector<vtkIdType> allCounts(this->NumProcs * this->NumProcs);
+    for (int bucket = 0; bucket < this->NumProcs; ++bucket)
+    {
+      localCounts[bucket] = bucketBounds[bucket + 1] - bucketBounds[bucket];
+    }
+    this->MPI->AllGather(localCounts.data(), allCounts.data(), this->NumProcs);
+
+    // ------------------------------------------------------------------------
+    // Each process merges one bucket and sends back the global indices
+    // ------------------------------------------------------------------------
+    vtkIdType bucketOffset = 0;
+    std::vector<vtkIdType> bucketCounts(this->NumProcs);
+    std::vector<vtkIdType> bucketOffsets(this->NumProcs);
+    for (int bucket = 0; bucket < this->NumProcs; ++bucket)
+    {
+      vtkIdType bucketSize = 0;
+      for (int pid = 0; pid < this->NumProcs; ++pid)
+      {
+        bucketCounts[pid] = allCounts[pid * this->NumProcs + bucket];
+        bucketOffsets[pid] = bucketSize;
+        bucketSize += bucketCounts[pid];
+      }
+
+      std::vector<T> sendValues(localCounts[bucket]);
+      for (vtkIdType cc = 0; cc < localCounts[bucket]; ++cc)
+      {
+        sendValues[cc] = items[bucketBounds[bucket] + cc].Value;
+      }
+
+      std::vector<T> bucketValues;
+      std::vector<vtkIdType> bucketPositions;
+      if (this->Me == bucket)
+      {
+        bucketValues.resize(bucketSize);
+        bucketPositions.resize(bucketSize);
+      }
+      this->MPI->GatherV(sendValues.data(), bucketValues.data(), localCounts[bucket],
+        bucketCounts.data(), bucketOffsets.data(), bucket);
+
+      if (this->Me == bucket)
+      {
+        // Values are received ordered by process id and then by local index,
+        // so a stable sort on the value gives the global order.
+        std::vector<vtkIdType> order(bucketSize);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](vtkIdType a, vtkIdType b) {
+          return valueLess(bucketValues[a], bucketValues[b]);
+        });
+        for (vtkIdType cc = 0; cc < bucketSize; ++cc)
+        {
+          bucketPositions[order[cc]] = bucketOffset + cc;
+        }
+      }
+
+      this->MPI->ScatterV(bucketPositions.data(),
+        this->GlobalPositions.data() + bucketBounds[bucket], bucketCounts.data(),
+        bucketOffsets.data(), localCounts[bucket], bucket);
+      bucketOffset += bucketSize;
+    }
+    this->GlobalSize = bucketOffset;
+  }
+
+  // --------------------------------------------------------------------------
+  // Extract a block using the cached global order. Only the rows of the block
+  // are exchanged, and the merging process puts them in place using their
+  // global index, without any sorting.
+  int ComputeFromGlobalOrder(
+    vtkTable* input, vtkTable* output, vtkIdType block, vtkIdType blockSize, bool revertOrder)
+  {
+    if (this->NeedToBuildCache)
+    {
+      this->BuildGlobalOrder(revertOrder);
+    }
+
+    // ------------------------------------------------------------------------
+    // Local rows of the block are contiguous in the local sorted array
+    // ------------------------------------------------------------------------
+    const vtkIdType lower = std::min(block * blockSize, this->GlobalSize);
+    const vtkIdType upper = std::min(lower + blockSize, this->GlobalSize);
+    const auto first =
+      std::lower_bound(this->GlobalPositions.begin(), this->GlobalPositions.end(), lower);
+    const auto last = std::lower_bound(first, this->GlobalPositions.end(), upper);
+    const vtkIdType localOffset = first - this->GlobalPositions.begin();
+    const vtkIdType localSize = last - first;
+
+    vtkSmartPointer<vtkTable> localSubset;
+    localSubset.TakeReference(
+      this->NewSubsetTable(input, this->LocalSorter, localOffset, localSize));
+
+    vtkNew<vtkIdTypeArray> positions;
+    positions->SetName(GLOBAL_POSITIONS_NAME);
+    positions->SetNumberOfTuples(localSize);
+    for (vtkIdType cc = 0; cc < localSize; ++cc)
+    {
+      positions->SetValue(cc, first[cc] - lower);
+    }
+    localSubset->GetRowData()->AddArray(positions);
+
+    // ------------------------------------------------------------------------
+    // Find the process that will merge all subset table
+    // ------------------------------------------------------------------------
+    int mergePid = GetMergingProcessId(localSubset.GetPointer());
+
+    if (this->Me != mergePid)
+    {
+      this->MPI->Send(localSubset.GetPointer(), mergePid, VTK_TABLE_EXCHANGE_TAG);
+
+      // Ask other processes to provide metadata for table decoration
+      this->DecorateTable(input, nullptr, mergePid);
+      return 1;
+    }
+
+    if (this->NumProcs > 1)
+    {
+      vtkNew<vtkIdTypeArray> processIdArray;
+      processIdArray->SetName("vtkOriginalProcessIds");
+      processIdArray->SetNumberOfComponents(1);
+      processIdArray->Allocate(blockSize);
+      for (vtkIdType idx = 0; idx < localSubset->GetNumberOfRows(); idx++)
+      {
+        processIdArray->InsertNextTuple1(mergePid);
+      }
+      localSubset->GetRowData()->AddArray(processIdArray);
+
+      vtkSmartPointer<vtkTable> tmp = vtkSmartPointer<vtkTable>::New();
+      for (int i = 0; i < this->NumProcs; i++)
+      {
+        if (i == mergePid)
+          continue;
+
+        this->MPI->Receive(tmp.GetPointer(), i, VTK_TABLE_EXCHANGE_TAG);
+        this->MergeTable(i, tmp.GetPointer(), localSubset.GetPointer(), blockSize);
+      }
+    }
+
+    // Put each row at its place in the block
+    vtkIdTypeArray* mergedPositions =
+      vtkIdTypeArray::SafeDownCast(localSubset->GetColumnByName(GLOBAL_POSITIONS_NAME));
+    const vtkIdType nbRows = localSubset->GetNumberOfRows();
+    ArraySorter sorter;
+    sorter.FillArray(nbRows);
+    for (vtkIdType idx = 0; idx < nbRows; ++idx)
+    {
+      sorter.Array[mergedPositions->GetValue(idx)].OriginalIndex = idx;
+    }
+    localSubset->RemoveColumnByName(GLOBAL_POSITIONS_NAME);
+    localSubset.TakeReference(
+      this->NewSubsetTable(localSubset.GetPointer(), &sorter, 0, nbRows));
+
+    // Add extra information such as structured indices, block number...
+    this->DecorateTable(input, localSubset.GetPointer(), mergePid);
+
+    // ShallowCopy it to the output
+    output->ShallowCopy(localSubset.GetPointer());
+    return 1;
+  }
+
   // --------------------------------------------------------------------------
   // nbGlobalToSkip is the number of elements that should be skipped at the end
   // if you exactly want to reach the searchedGlobalIndex.
@@ -1144,7 +1464,11 @@ public:
   }
 
   // --------------------------------------------------------------------------
-  void InvalidateCache() override { this->NeedToBuildCache = true; }
+  void InvalidateCache() override
+  {
+    this->NeedToBuildCache = true;
+    this->Sortable = -1;
+  }
 
   // --------------------------------------------------------------------------
   bool IsInvalid(vtkTable* input, vtkDataArray* dataToProcess) override
@@ -1364,6 +1688,11 @@ private:
   int SelectedComponent;      // Component used to sort array
   bool NeedToBuildCache;
   bool Debug;
+  int Sortable; // Cached result of IsSortable, -1 when unknown
+
+  // Global index of each item of the LocalSorter (sample sort)
+  std::vector<vtkIdType> GlobalPositions;
+  vtkIdType GlobalSize; // Number of sorted items across processes
 
   const static int VTK_TABLE_EXCHANGE_TAG = 50;
   // HISTOGRAM_SIZE could be computed dynamically based on the type of the
@@ -1373,6 +1702,10 @@ private:
   // Maybe make some test on huge cluster to see which histogram size is
   // the best.
   const static int HISTOGRAM_SIZE = 256;
+  // Number of samples per process and per bucket used to choose the
+  // splitters of the sample sort.
+  const static int SAMPLE_SORT_OVERSAMPLING = 64;
+  static constexpr const char* GLOBAL_POSITIONS_NAME = "__vtkSortedTableStreamerGlobalPositions__";
 };
 //****************************************************************************
 vtkStandardNewMacro(vtkSortedTableStreamer);
@@ -1617,48 +1950,23 @@ int vtkSortedTableStreamer::RequestData(vtkInformation* vtkNotUsed(request),
   // Manage multiblock dataset by merging data into a single vtkTable
   auto inputPTD = vtkPartitionedDataSet::GetData(inputVector[0], 0);
 
-  vtkSmartPointer<vtkTable> input = this->MergeBlocks(inputPTD);
-  if (this->ShowFieldData)
-  {
-    this->PopulateFieldDataArrays(inputPTD, input);
-  }
-  int hasCompositeIds = vtkDataTabulator::HasInputCompositeIds(inputPTD);
+  // The merged table is kept as long as the input is not modified so that
+  // the sorting cache stays valid when only the requested block changes.
+  int needMerge = !this->MergedInput || this->MergedInputMTime != ::GetInputMTime(inputPTD) ||
+    this->MergedInputShowFieldData != this->ShowFieldData;
   if (this->Controller && this->Controller->GetNumberOfProcesses() > 1)
   {
-    int globalHasCompositeIds;
-    this->Controller->AllReduce(
-      &hasCompositeIds, &globalHasCompositeIds, 1, vtkCommunicator::MAX_OP);
-    hasCompositeIds = globalHasCompositeIds;
+    int globalNeedMerge;
+    this->Controller->AllReduce(&needMerge, &globalNeedMerge, 1, vtkCommunicator::MAX_OP);
+    needMerge = globalNeedMerge;
   }
-  if (hasCompositeIds)
+  if (needMerge)
   {
-    if (input->GetColumnByName("vtkCompositeIndexArray") == nullptr)
-    {
-      auto array = this->GenerateCompositeIndexArray(inputPTD, input->GetNumberOfRows());
-      input->GetRowData()->AddArray(array);
-    }
-    int hasBlockNames = input->GetFieldData()->GetAbstractArray("vtkBlockNames") != nullptr;
-    if (this->Controller && this->Controller->GetNumberOfProcesses() > 1)
-    {
-      int globalHasBlockNames;
-      this->Controller->AllReduce(&hasBlockNames, &globalHasBlockNames, 1, vtkCommunicator::MIN_OP);
-      hasBlockNames = globalHasBlockNames;
-    }
-    if (!hasBlockNames)
-    {
-      // add name array.
-      auto blockNamesArray = this->GenerateBlockNameArray(inputPTD);
-      input->GetFieldData()->AddArray(blockNamesArray);
-    }
-    if (!input->GetColumnByName("vtkBlockNameIndices"))
-    {
-      // add name indices array.
-      auto blockIndicesArray = this->GenerateBlockIndicesArray(inputPTD,
-        vtkStringArray::SafeDownCast(input->GetFieldData()->GetAbstractArray("vtkBlockNames")),
-        input->GetNumberOfRows());
-      input->GetRowData()->AddArray(blockIndicesArray);
-    }
+    this->MergedInput = this->PrepareInput(inputPTD);
+    this->MergedInputMTime = ::GetInputMTime(inputPTD);
+    this->MergedInputShowFieldData = this->ShowFieldData;
   }
+  vtkTable* input = this->MergedInput;
 
   // Get input data
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
@@ -1689,14 +1997,26 @@ int vtkSortedTableStreamer::RequestData(vtkInformation* vtkNotUsed(request),
   this->Internal->SetSelectedComponent(realComponent);
 
   // Manage custom case where sorting occur on a virtual array (process id)
-  if (!this->Internal->IsSortable() ||
-    (this->GetColumnToSort() && (strcmp("vtkOriginalProcessIds", this->GetColumnToSort()) == 0)))
+  const bool sort = this->Internal->IsSortable() &&
+    !(this->GetColumnToSort() && (strcmp("vtkOriginalProcessIds", this->GetColumnToSort()) == 0));
+
+  // Only the columns that are not left out are extracted, the sorting cache
+  // stays valid since it depends on the merged input only. The histogram path
+  // sorts the merged rows again, so it keeps the column to sort until then.
+  vtkDataArray* sortColumn = sort && !::UseSampleSort ? arrayToProcess : nullptr;
+  vtkSmartPointer<vtkTable> projected = this->ProjectInput(input, sortColumn);
+
+  if (!sort)
   {
-    this->Internal->Extract(input, output, this->Block, this->BlockSize, orderInverted);
+    this->Internal->Extract(projected, output, this->Block, this->BlockSize, orderInverted);
   }
   else
   {
-    this->Internal->Compute(input, output, this->Block, this->BlockSize, orderInverted);
+    this->Internal->Compute(projected, output, this->Block, this->BlockSize, orderInverted);
+    if (sortColumn && projected != input && this->IsColumnSkipped(sortColumn))
+    {
+      output->RemoveColumnByName(sortColumn->GetName());
+    }
   }
 
   if (auto names = input->GetFieldData()->GetAbstractArray("vtkBlockNames"))
@@ -1706,12 +2026,142 @@ int vtkSortedTableStreamer::RequestData(vtkInformation* vtkNotUsed(request),
   return 1;
 }
 
+//----------------------------------------------------------------------------
+void vtkSortedTableStreamer::AddColumnToSkip(const char* name)
+{
+  if (name && this->ColumnsToSkip.insert(name).second)
+  {
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSortedTableStreamer::AddArrayToSkip(const char* name)
+{
+  if (name && this->ArraysToSkip.insert(name).second)
+  {
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSortedTableStreamer::RemoveAllColumnsToSkip()
+{
+  if (!this->ColumnsToSkip.empty() || !this->ArraysToSkip.empty())
+  {
+    this->ColumnsToSkip.clear();
+    this->ArraysToSkip.clear();
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkSortedTableStreamer::IsColumnSkipped(vtkAbstractArray* column) const
+{
+  const std::string name = column->GetName() ? column->GetName() : "";
+  if (this->ColumnsToSkip.count(name) > 0)
+  {
+    return true;
+  }
+  vtkInformation* info = column->GetInformation();
+  const bool isComponent = info->Has(vtkSplitColumnComponents::ORIGINAL_ARRAY_NAME()) &&
+    info->Has(vtkSplitColumnComponents::ORIGINAL_COMPONENT_NUMBER()) &&
+    info->Get(vtkSplitColumnComponents::ORIGINAL_COMPONENT_NUMBER()) >= 0;
+  return this->ArraysToSkip.count(
+           isComponent ? info->Get(vtkSplitColumnComponents::ORIGINAL_ARRAY_NAME()) : name) > 0;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkTable> vtkSortedTableStreamer::ProjectInput(
+  vtkTable* input, vtkAbstractArray* columnToKeep)
+{
+  if (this->ColumnsToSkip.empty() && this->ArraysToSkip.empty())
+  {
+    return input;
+  }
+
+  auto projected = vtkSmartPointer<vtkTable>::New();
+  projected->SetFieldData(input->GetFieldData());
+  for (vtkIdType cc = 0; cc < input->GetNumberOfColumns(); ++cc)
+  {
+    vtkAbstractArray* column = input->GetColumn(cc);
+    if (column && (column == columnToKeep || !this->IsColumnSkipped(column)))
+    {
+      projected->GetRowData()->AddArray(column);
+    }
+  }
+  // the number of rows is given by the columns, keep them all if none is left.
+  return projected->GetNumberOfColumns() > 0 ? projected : vtkSmartPointer<vtkTable>(input);
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkTable> vtkSortedTableStreamer::PrepareInput(vtkPartitionedDataSet* inputPTD)
+{
+  vtkSmartPointer<vtkTable> input = this->MergeBlocks(inputPTD);
+  if (this->ShowFieldData)
+  {
+    this->PopulateFieldDataArrays(inputPTD, input);
+  }
+  int hasCompositeIds = vtkDataTabulator::HasInputCompositeIds(inputPTD);
+  if (this->Controller && this->Controller->GetNumberOfProcesses() > 1)
+  {
+    int globalHasCompositeIds;
+    this->Controller->AllReduce(
+      &hasCompositeIds, &globalHasCompositeIds, 1, vtkCommunicator::MAX_OP);
+    hasCompositeIds = globalHasCompositeIds;
+  }
+  if (hasCompositeIds)
+  {
+    if (input->GetColumnByName("vtkCompositeIndexArray") == nullptr)
+    {
+      auto array = this->GenerateCompositeIndexArray(inputPTD, input->GetNumberOfRows());
+      input->GetRowData()->AddArray(array);
+    }
+    int hasBlockNames = input->GetFieldData()->GetAbstractArray("vtkBlockNames") != nullptr;
+    if (this->Controller && this->Controller->GetNumberOfProcesses() > 1)
+    {
+      int globalHasBlockNames;
+      this->Controller->AllReduce(&hasBlockNames, &globalHasBlockNames, 1, vtkCommunicator::MIN_OP);
+      hasBlockNames = globalHasBlockNames;
+    }
+    if (!hasBlockNames)
+    {
+      // add name array.
+      auto blockNamesArray = this->GenerateBlockNameArray(inputPTD);
+      input->GetFieldData()->AddArray(blockNamesArray);
+    }
+    if (!input->GetColumnByName("vtkBlockNameIndices"))
+    {
+      // add name indices array.
+      auto blockIndicesArray = this->GenerateBlockIndicesArray(inputPTD,
+        vtkStringArray::SafeDownCast(input->GetFieldData()->GetAbstractArray("vtkBlockNames")),
+        input->GetNumberOfRows());
+      input->GetRowData()->AddArray(blockIndicesArray);
+    }
+  }
+  return input;
+}
+
 //----------------------------------------------------------------------------
 void vtkSortedTableStreamer::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Sorting column: " << (this->ColumnToSort ? this->ColumnToSort : "(none)")
      << endl;
+  os << indent << "Columns to skip: " << this->ColumnsToSkip.size() << endl;
+  os << indent << "Arrays to skip: " << this->ArraysToSkip.size() << endl;
+}
+
+//----------------------------------------------------------------------------
+void vtkSortedTableStreamer::SetUseSampleSort(bool value)
+{
+  ::UseSampleSort = value;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSortedTableStreamer::GetUseSampleSort()
+{
+  return ::UseSampleSort;
 }
 
 //----------------------------------------------------------------------------
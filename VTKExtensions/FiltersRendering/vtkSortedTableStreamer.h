@@ -17,8 +17,11 @@
 #include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for export macro
 #include "vtkSmartPointer.h"                          // for vtkSmartPointer
 #include "vtkTableAlgorithm.h"
+#include <set>     // for std::set
+#include <string>  // for std::string
 #include <utility> // for std::pair
 
+class vtkAbstractArray;
 class vtkDataArray;
 class vtkIdTypeArray;
 class vtkMultiProcessController;
@@ -107,6 +110,34 @@ public:
   void SetInvertOrder(int newValue);
   vtkGetMacro(InvertOrder, int);
 
+  ///@{
+  /**
+   * When enabled (default), the global order of the rows is computed once
+   * using a distributed sample sort and cached, so that requesting another
+   * block only exchanges the rows of that block. Otherwise, each request
+   * narrows down global histograms until the rows of the block are found.
+   * The cache is invalidated when the input, the column, the component or
+   * the order changes.
+   */
+  static void SetUseSampleSort(bool);
+  static bool GetUseSampleSort();
+  ///@}
+
+  ///@{
+  /**
+   * Columns to leave out of the output, e.g. the columns hidden in a view, so
+   * that they are neither extracted nor sent. `AddColumnToSkip` leaves out the
+   * column with the given name. `AddArrayToSkip` leaves out the components
+   * split out of the array with the given name (see vtkSplitColumnComponents),
+   * or the column with that name if it is not such a component. Leaving out
+   * the column to sort by does not prevent sorting by it. Nothing is left out
+   * by default.
+   */
+  void AddColumnToSkip(const char* name);
+  void AddArrayToSkip(const char* name);
+  void RemoveAllColumnsToSkip();
+  ///@}
+
 protected:
   vtkSortedTableStreamer();
   ~vtkSortedTableStreamer() override;
@@ -139,6 +170,31 @@ private:
 
   vtkSmartPointer<vtkTable> MergeBlocks(vtkPartitionedDataSet* cd);
 
+  /**
+   * Returns true if the column is to be left out of the output.
+   */
+  bool IsColumnSkipped(vtkAbstractArray* column) const;
+
+  /**
+   * Returns a table sharing the columns of the input that are not left out,
+   * and `columnToKeep` if any, or the input itself if no column is left out.
+   */
+  vtkSmartPointer<vtkTable> ProjectInput(
+    vtkTable* input, vtkAbstractArray* columnToKeep = nullptr);
+
+  std::set<std::string> ColumnsToSkip;
+  std::set<std::string> ArraysToSkip;
+
+  /**
+   * Merge the blocks and add the composite, block name and field data columns.
+   */
+  vtkSmartPointer<vtkTable> PrepareInput(vtkPartitionedDataSet* cd);
+
+  // Merged input table, kept as long as the input is unchanged.
+  vtkSmartPointer<vtkTable> MergedInput;
+  vtkMTimeType MergedInputMTime = 0;
+  bool MergedInputShowFieldData = false;
+
   /**
    * Add field data columns defined by block to the output table.
    */
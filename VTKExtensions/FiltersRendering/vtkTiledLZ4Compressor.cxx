@@ -0,0 +1,362 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkTiledLZ4Compressor.h"
+
+#include "vtkMultiProcessStream.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkTypeTraits.h"
+#include "vtkUnsignedCharArray.h"
+
+#include "vtk_lz4.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <sstream>
+
+namespace
+{
+// Layout of the compressed stream:
+//   StreamHeader,
+//   vtkTypeUInt32 compressed tile sizes[NumberOfTiles] (0 for unchanged tiles),
+//   compressed tiles.
+struct StreamHeader
+{
+  vtkTypeUInt32 Magic;
+  vtkTypeUInt32 Flags;
+  vtkTypeUInt32 TileSize;
+  vtkTypeUInt32 NumberOfTiles;
+  vtkTypeUInt64 FrameSize;
+};
+
+constexpr vtkTypeUInt32 STREAM_MAGIC = 0x345a4c54; // "TLZ4"
+
+enum StreamFlags : vtkTypeUInt32
+{
+  // Unchanged tiles are to be copied from the previous frame.
+  DELTA_FRAME = 0x1,
+  // The frame must be kept as the reference for the next one.
+  KEEP_REFERENCE = 0x2,
+};
+
+const unsigned char CompressMasks[6][4] = { { 0xFF, 0xFF, 0xFF, 0xFF },
+  { 0xFE, 0xFF, 0xFE, 0xFE }, { 0xFC, 0xFE, 0xFC, 0xFC }, { 0xF8, 0xFC, 0xF8, 0xF8 },
+  { 0xF0, 0xF8, 0xF0, 0xF0 }, { 0xE0, 0xF0, 0xE0, 0xE0 } };
+}
+
+vtkStandardNewMacro(vtkTiledLZ4Compressor);
+//----------------------------------------------------------------------------
+vtkTiledLZ4Compressor::vtkTiledLZ4Compressor()
+  : Quality(3)
+  , DeltaMode(false)
+  , TileSize(128 * 1024)
+{
+}
+
+//----------------------------------------------------------------------------
+vtkTiledLZ4Compressor::~vtkTiledLZ4Compressor() = default;
+
+//----------------------------------------------------------------------------
+void vtkTiledLZ4Compressor::ResetReferenceFrame()
+{
+  this->ReferenceFrame.clear();
+  this->ReferenceFrame.shrink_to_fit();
+}
+
+//----------------------------------------------------------------------------
+int vtkTiledLZ4Compressor::Compress()
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot compress, empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  const int compressLevel = this->LossLessMode ? 0 : this->Quality;
+  assert(compressLevel >= 0 && compressLevel <= 5);
+  const bool applyMask = compressLevel > 0 && this->Input->GetNumberOfComponents() == 4;
+  const unsigned char* mask = CompressMasks[compressLevel];
+
+  const unsigned char* input = this->Input->GetPointer(0);
+  const size_t frameSize =
+    static_cast<size_t>(this->Input->GetNumberOfTuples()) * this->Input->GetNumberOfComponents();
+  // keep tiles aligned on pixels for the color mask.
+  const size_t tileSize = static_cast<size_t>(this->TileSize - this->TileSize % 4);
+  const size_t numTiles = (frameSize + tileSize - 1) / tileSize;
+  if (numTiles > vtkTypeTraits<vtkTypeUInt32>::Max())
+  {
+    vtkErrorMacro("Image too large for the tile size " << tileSize << ".");
+    return VTK_ERROR;
+  }
+
+  StreamHeader header;
+  header.Magic = STREAM_MAGIC;
+  header.Flags = this->DeltaMode ? KEEP_REFERENCE : 0;
+  header.TileSize = static_cast<vtkTypeUInt32>(tileSize);
+  header.NumberOfTiles = static_cast<vtkTypeUInt32>(numTiles);
+  header.FrameSize = static_cast<vtkTypeUInt64>(frameSize);
+  if (!this->DeltaMode)
+  {
+    this->ResetReferenceFrame();
+  }
+  else if (this->ReferenceFrame.size() == frameSize)
+  {
+    header.Flags |= DELTA_FRAME;
+  }
+  else
+  {
+    this->ReferenceFrame.resize(frameSize);
+  }
+  const bool deltaFrame = (header.Flags & DELTA_FRAME) != 0;
+
+  this->TileBuffers.resize(numTiles);
+  std::vector<vtkTypeUInt32> compressedSizes(numTiles, 0);
+  std::atomic<bool> failed(false);
+  vtkSMPThreadLocal<std::vector<unsigned char>> maskedTiles;
+  vtkSMPTools::For(0, static_cast<vtkIdType>(numTiles), 1, [&](vtkIdType begin, vtkIdType end) {
+    auto& masked = maskedTiles.Local();
+    for (vtkIdType tile = begin; tile < end; ++tile)
+    {
+      const size_t offset = tile * tileSize;
+      const size_t length = std::min(tileSize, frameSize - offset);
+      const unsigned char* source = input + offset;
+      if (applyMask)
+      {
+        masked.resize(length);
+        for (size_t cc = 0; cc < length; ++cc)
+        {
+          masked[cc] = source[cc] & mask[cc % 4];
+        }
+        source = masked.data();
+      }
+
+      if (this->DeltaMode)
+      {
+        unsigned char* reference = this->ReferenceFrame.data() + offset;
+        if (deltaFrame && std::memcmp(reference, source, length) == 0)
+        {
+          // unchanged tile, nothing to send.
+          continue;
+        }
+        std::memcpy(reference, source, length);
+      }
+
+      auto& buffer = this->TileBuffers[tile];
+      const int bound = LZ4_compressBound(static_cast<int>(length));
+      buffer.resize(bound);
+      const int compressedSize = LZ4_compress_fast(reinterpret_cast<const char*>(source),
+        buffer.data(), static_cast<int>(length), bound, 16);
+      if (compressedSize <= 0)
+      {
+        failed = true;
+      }
+      compressedSizes[tile] = static_cast<vtkTypeUInt32>(std::max(compressedSize, 0));
+    }
+  });
+  if (failed)
+  {
+    this->ResetReferenceFrame();
+    return VTK_ERROR;
+  }
+
+  // assemble the stream.
+  std::vector<size_t> offsets(numTiles + 1);
+  offsets[0] = sizeof(StreamHeader) + numTiles * sizeof(vtkTypeUInt32);
+  for (size_t tile = 0; tile < numTiles; ++tile)
+  {
+    offsets[tile + 1] = offsets[tile] + compressedSizes[tile];
+  }
+
+  this->Output->SetNumberOfComponents(1);
+  this->Output->SetNumberOfTuples(static_cast<vtkIdType>(offsets[numTiles]));
+  unsigned char* output = this->Output->GetPointer(0);
+  std::memcpy(output, &header, sizeof(StreamHeader));
+  if (numTiles > 0)
+  {
+    std::memcpy(output + sizeof(StreamHeader), compressedSizes.data(),
+      numTiles * sizeof(vtkTypeUInt32));
+  }
+  vtkSMPTools::For(0, static_cast<vtkIdType>(numTiles), [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType tile = begin; tile < end; ++tile)
+    {
+      std::memcpy(output + offsets[tile], this->TileBuffers[tile].data(), compressedSizes[tile]);
+    }
+  });
+  return VTK_OK;
+}
+
+//----------------------------------------------------------------------------
+int vtkTiledLZ4Compressor::Decompress()
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot decompress, empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  const unsigned char* input = this->Input->GetPointer(0);
+  const size_t inputSize =
+    static_cast<size_t>(this->Input->GetNumberOfTuples()) * this->Input->GetNumberOfComponents();
+  StreamHeader header;
+  if (inputSize < sizeof(StreamHeader))
+  {
+    vtkErrorMacro("Invalid compressed stream.");
+    return VTK_ERROR;
+  }
+  std::memcpy(&header, input, sizeof(StreamHeader));
+  const size_t numTiles = header.NumberOfTiles;
+  const size_t tileSize = header.TileSize;
+  const size_t frameSize = static_cast<size_t>(header.FrameSize);
+  if (header.Magic != STREAM_MAGIC || tileSize == 0 ||
+    numTiles != (frameSize + tileSize - 1) / tileSize ||
+    inputSize < sizeof(StreamHeader) + numTiles * sizeof(vtkTypeUInt32))
+  {
+    vtkErrorMacro("Invalid compressed stream.");
+    return VTK_ERROR;
+  }
+
+  const size_t outputSize =
+    static_cast<size_t>(this->Output->GetNumberOfTuples()) * this->Output->GetNumberOfComponents();
+  if (outputSize != frameSize)
+  {
+    vtkErrorMacro("Output size (" << outputSize << ") does not match the compressed frame size ("
+                                  << frameSize << ").");
+    return VTK_ERROR;
+  }
+
+  const bool deltaFrame = (header.Flags & DELTA_FRAME) != 0;
+  const bool keepReference = (header.Flags & KEEP_REFERENCE) != 0;
+  if (deltaFrame && this->ReferenceFrame.size() != frameSize)
+  {
+    vtkErrorMacro("Received a delta frame without a matching reference frame.");
+    return VTK_ERROR;
+  }
+  if (!keepReference)
+  {
+    this->ResetReferenceFrame();
+  }
+  else
+  {
+    this->ReferenceFrame.resize(frameSize);
+  }
+
+  std::vector<vtkTypeUInt32> compressedSizes(numTiles);
+  std::vector<size_t> offsets(numTiles + 1);
+  if (numTiles > 0)
+  {
+    std::memcpy(
+      compressedSizes.data(), input + sizeof(StreamHeader), numTiles * sizeof(vtkTypeUInt32));
+  }
+  offsets[0] = sizeof(StreamHeader) + numTiles * sizeof(vtkTypeUInt32);
+  for (size_t tile = 0; tile < numTiles; ++tile)
+  {
+    offsets[tile + 1] = offsets[tile] + compressedSizes[tile];
+  }
+  if (offsets[numTiles] > inputSize)
+  {
+    vtkErrorMacro("Truncated compressed stream.");
+    return VTK_ERROR;
+  }
+
+  unsigned char* output = this->Output->GetPointer(0);
+  std::atomic<bool> failed(false);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(numTiles), 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType tile = begin; tile < end; ++tile)
+    {
+      const size_t offset = tile * tileSize;
+      const size_t length = std::min(tileSize, frameSize - offset);
+      if (compressedSizes[tile] == 0)
+      {
+        if (!deltaFrame)
+        {
+          failed = true;
+          continue;
+        }
+        std::memcpy(output + offset, this->ReferenceFrame.data() + offset, length);
+        continue;
+      }
+
+      const int decompressedSize =
+        LZ4_decompress_safe(reinterpret_cast<const char*>(input + offsets[tile]),
+          reinterpret_cast<char*>(output + offset), static_cast<int>(compressedSizes[tile]),
+          static_cast<int>(length));
+      if (decompressedSize != static_cast<int>(length))
+      {
+        failed = true;
+        continue;
+      }
+      if (keepReference)
+      {
+        std::memcpy(this->ReferenceFrame.data() + offset, output + offset, length);
+      }
+    }
+  });
+  if (failed)
+  {
+    // the reference is no longer in sync with the compressor's.
+    this->ResetReferenceFrame();
+    return VTK_ERROR;
+  }
+  return VTK_OK;
+}
+
+//-----------------------------------------------------------------------------
+void vtkTiledLZ4Compressor::SaveConfiguration(vtkMultiProcessStream* stream)
+{
+  this->Superclass::SaveConfiguration(stream);
+  *stream << this->Quality << (this->DeltaMode ? 1 : 0);
+}
+
+//-----------------------------------------------------------------------------
+bool vtkTiledLZ4Compressor::RestoreConfiguration(vtkMultiProcessStream* stream)
+{
+  if (this->Superclass::RestoreConfiguration(stream))
+  {
+    int quality, deltaMode;
+    *stream >> quality >> deltaMode;
+    this->SetQuality(quality);
+    this->SetDeltaMode(deltaMode != 0);
+    this->ResetReferenceFrame();
+    return true;
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+const char* vtkTiledLZ4Compressor::SaveConfiguration()
+{
+  std::ostringstream oss;
+  oss << this->Superclass::SaveConfiguration() << " " << this->Quality << " "
+      << (this->DeltaMode ? 1 : 0);
+  this->SetConfiguration(oss.str().c_str());
+  return this->Configuration;
+}
+
+//-----------------------------------------------------------------------------
+const char* vtkTiledLZ4Compressor::RestoreConfiguration(const char* stream)
+{
+  stream = this->Superclass::RestoreConfiguration(stream);
+  if (stream)
+  {
+    std::istringstream iss(stream);
+    int quality, deltaMode;
+    iss >> quality >> deltaMode;
+    this->SetQuality(quality);
+    this->SetDeltaMode(deltaMode != 0);
+    this->ResetReferenceFrame();
+    return stream + iss.tellg();
+  }
+  return nullptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkTiledLZ4Compressor::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Quality: " << this->Quality << endl;
+  os << indent << "DeltaMode: " << this->DeltaMode << endl;
+  os << indent << "TileSize: " << this->TileSize << endl;
+}
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkTiledLZ4Compressor
+ * @brief   Image compressor/decompressor
+ * that uses LZ4 on independent tiles, in parallel.
+ *
+ * vtkTiledLZ4Compressor splits the image into tiles of TileSize bytes and
+ * compresses (resp. decompresses) them independently using LZ4 and
+ * vtkSMPTools. The resulting stream is self-describing: the decompressor does
+ * not need to know the tile size used by the compressor.
+ *
+ * When DeltaMode is enabled, the compressor keeps a copy of the last frame it
+ * sent and only sends the tiles that changed since. The decompressor keeps the
+ * last frame it received to fill the unchanged tiles. This requires every
+ * compressed frame to be decompressed, in order, by a single decompressor,
+ * which is the case for vtkPVClientServerSynchronizedRenderers. A full frame
+ * is sent whenever the image size changes or the configuration is restored.
+ *
+ * The Quality measure is the same as the one used by vtkLZ4Compressor.
+ */
+
+#ifndef vtkTiledLZ4Compressor_h
+#define vtkTiledLZ4Compressor_h
+
+#include "vtkImageCompressor.h"
+#include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for exports
+
+#include <vector> // for std::vector
+
+class vtkMultiProcessStream;
+
+class VTKPVVTKEXTENSIONSFILTERSRENDERING_EXPORT vtkTiledLZ4Compressor : public vtkImageCompressor
+{
+public:
+  static vtkTiledLZ4Compressor* New();
+  vtkTypeMacro(vtkTiledLZ4Compressor, vtkImageCompressor);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set the quality measure. The value can be between 0 and 5. 0 means preserve
+   * input image quality while 5 means improve compression at the cost of image
+   * quality. For quality values  > 1, we use a color mask on the input colors
+   * similar to vtkSquirtCompressor.
+   */
+  vtkSetClampMacro(Quality, int, 0, 5);
+  vtkGetMacro(Quality, int);
+  ///@}
+
+  ///@{
+  /**
+   * When set, only the tiles that changed since the previous frame are sent.
+   * Default is false.
+   */
+  vtkSetMacro(DeltaMode, bool);
+  vtkGetMacro(DeltaMode, bool);
+  vtkBooleanMacro(DeltaMode, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Set the size of a tile, in bytes, used when compressing. Default is 128 KiB.
+   * This is not part of the configuration since the tile size is saved in the
+   * compressed stream.
+   */
+  vtkSetClampMacro(TileSize, int, 4096, VTK_INT_MAX);
+  vtkGetMacro(TileSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * Compress/Decompress data array on the objects input with results
+   * in the objects output. See also Set/GetInput/Output.
+   */
+  int Compress() override;
+  int Decompress() override;
+  ///@}
+
+  /**
+   * Discard the reference frame so that the next compressed frame is a full
+   * frame.
+   */
+  void ResetReferenceFrame();
+
+  ///@{
+  /**
+   * Serialize/Restore compressor configuration (but not the data) into the stream.
+   * Restoring the configuration resets the reference frame.
+   */
+  void SaveConfiguration(vtkMultiProcessStream* stream) override;
+  bool RestoreConfiguration(vtkMultiProcessStream* stream) override;
+  const char* SaveConfiguration() override;
+  const char* RestoreConfiguration(const char* stream) override;
+  ///@}
+
+protected:
+  vtkTiledLZ4Compressor();
+  ~vtkTiledLZ4Compressor() override;
+
+  int Quality;
+  bool DeltaMode;
+  int TileSize;
+
+private:
+  vtkTiledLZ4Compressor(const vtkTiledLZ4Compressor&) = delete;
+  void operator=(const vtkTiledLZ4Compressor&) = delete;
+
+  // Last frame sent (when compressing) or received (when decompressing).
+  std::vector<unsigned char> ReferenceFrame;
+  // Per-tile scratch buffers used when compressing.
+  std::vector<std::vector<char>> TileBuffers;
+};
+
+#endif
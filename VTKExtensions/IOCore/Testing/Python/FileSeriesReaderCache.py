@@ -0,0 +1,81 @@
+from paraview.simple import *
+import sys
+import time
+from paraview import smtesting
+import os
+import shutil
+
+smtesting.ProcessCommandLineArguments()
+
+# write a file series with a different number of points per file.
+path = smtesting.TempDir + '/FileSeriesReaderCache/'
+if os.path.exists(path):
+    shutil.rmtree(path)
+os.makedirs(path)
+numFiles = 6
+fileNames = []
+for i in range(numFiles):
+    sphere = Sphere(ThetaResolution=8 + i, PhiResolution=8)
+    fileName = path + 'sphere_%d.vtp' % i
+    SaveData(fileName, proxy=sphere)
+    fileNames.append(fileName)
+    Delete(sphere)
+
+reader = XMLPolyDataReader(FileName=fileNames, CacheSize=64, PrefetchCount=2)
+seriesReader = reader.GetClientSideObject()
+
+def statistic(name):
+    reader.UpdatePropertyInformation()
+    return reader.GetPropertyValue(name)
+
+def numberOfPoints(step):
+    reader.UpdatePipeline(reader.TimestepValues[step])
+    return reader.GetDataInformation().GetNumberOfPoints()
+
+def waitForPrefetch(count):
+    for i in range(100):
+        if statistic("NumberOfCachedOutputs") >= count:
+            return
+        time.sleep(0.1)
+
+expected = [numberOfPoints(i) for i in range(numFiles)]
+if len(set(expected)) != numFiles:
+    print("Unexpected number of points:", expected)
+    sys.exit(1)
+
+# play backward, going back must be served from the cache.
+seriesReader.ResetCacheStatistics()
+for i in reversed(range(numFiles)):
+    if numberOfPoints(i) != expected[i]:
+        print("Wrong output for file %d read from the cache." % i)
+        sys.exit(1)
+if statistic("CacheMisses") != 0 or statistic("CacheHits") != numFiles:
+    print("Expected %d cache hits, got %d hits and %d misses." %
+          (numFiles, statistic("CacheHits"), statistic("CacheMisses")))
+    sys.exit(1)
+
+# once the cache is cleared, the next files are prefetched in the
+# playback direction.
+seriesReader.ClearCache()
+seriesReader.ResetCacheStatistics()
+numberOfPoints(0)
+numberOfPoints(1)
+waitForPrefetch(4)
+if numberOfPoints(2) != expected[2] or numberOfPoints(3) != expected[3]:
+    print("Wrong output for prefetched files.")
+    sys.exit(1)
+if statistic("NumberOfPrefetchedOutputs") < 2 or statistic("CacheHits") < 2:
+    print("Expected prefetched files, got %d prefetches and %d hits." %
+          (statistic("NumberOfPrefetchedOutputs"), statistic("CacheHits")))
+    sys.exit(1)
+
+# modifying the reader invalidates the cache. Prefetching is running at this
+# point: the property is pushed to the internal reader only once it stopped.
+numberOfPoints(0)
+reader.PointArrayStatus = []
+numberOfPoints(2)
+if statistic("CacheMisses") < 3:
+    print("The cache was not invalidated when modifying the reader.")
+    sys.exit(1)
+
+print("success")
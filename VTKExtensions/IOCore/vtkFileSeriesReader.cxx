@@ -7,6 +7,7 @@
 #include "vtkClientServerInterpreter.h"
 #include "vtkClientServerInterpreterInitializer.h"
 #include "vtkClientServerStream.h"
+#include "vtkDataObject.h"
 #include "vtkFileSeriesUtilities.h"
 #include "vtkGenericDataObjectReader.h"
 #include "vtkInformation.h"
@@ -15,6 +16,7 @@
 #include "vtkInformationVector.h"
 #include "vtkLogger.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
@@ -26,10 +28,17 @@
 #define VTK_CREATE(type, name) vtkSmartPointer<type> name = vtkSmartPointer<type>::New()
 
 #include <algorithm>
+#include <atomic>
 #include <cctype> // for isprint().
+#include <condition_variable>
+#include <deque>
+#include <list>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <vector>
 
 #include "vtk_jsoncpp.h"
@@ -48,6 +57,7 @@ public:
   void AddTimeRange(int index, vtkInformation* srcInfo);
   int GetAggregateTimeInfo(vtkInformation* outInfo);
   int GetInputTimeInfo(int index, vtkInformation* outInfo);
+  int GetNumberOfTimeSteps(int index);
   int GetIndexForTime(double time);
   int ChooseInput(vtkInformation* outInfo);
   std::vector<double> GetTimesForInput(int inputId, vtkInformation* outInfo);
@@ -206,6 +216,18 @@ int vtkFileSeriesReaderTimeRanges::GetInputTimeInfo(int index, vtkInformation* o
   }
 }
 
+//-----------------------------------------------------------------------------
+int vtkFileSeriesReaderTimeRanges::GetNumberOfTimeSteps(int index)
+{
+  auto iter = this->InputLookup.find(index);
+  if (iter == this->InputLookup.end() ||
+    !iter->second->Has(vtkStreamingDemandDrivenPipeline::TIME_STEPS()))
+  {
+    return 0;
+  }
+  return iter->second->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+}
+
 //-----------------------------------------------------------------------------
 int vtkFileSeriesReaderTimeRanges::GetIndexForTime(double time)
 {
@@ -368,6 +390,103 @@ struct vtkFileSeriesReaderInternals
   std::vector<double> TimeValues;
   bool FileNameIsSet;
   vtkFileSeriesReaderTimeRanges* TimeRanges;
+  int RequestedFileIndex = -1;
+
+  // Cache of outputs, indexed by file index and requested piece, in
+  // least-recently-used order.
+  typedef std::tuple<int, int, int, int> CacheKeyType;
+  typedef std::list<std::pair<CacheKeyType, vtkSmartPointer<vtkDataObject>>> CacheListType;
+  CacheListType Cache;
+  std::map<CacheKeyType, CacheListType::iterator> CacheLookup;
+  vtkMTimeType CacheMTime = 0;
+
+  // Statistics, read without waiting for the prefetching thread.
+  std::atomic<unsigned long> CacheMemorySize{ 0 };
+  std::atomic<int> NumberOfCachedOutputs{ 0 };
+  std::atomic<vtkIdType> CacheHits{ 0 };
+  std::atomic<vtkIdType> CacheMisses{ 0 };
+  std::atomic<vtkIdType> Prefetches{ 0 };
+
+  // Prefetching state. The mutex protects the reader and everything above while
+  // the prefetching thread runs. The thread holds it while it reads a file and
+  // checks StopPrefetch before each file.
+  std::recursive_mutex Mutex;
+  std::condition_variable_any PrefetchCondition;
+  std::thread PrefetchThread;
+  std::atomic<bool> StopPrefetch{ false };
+  std::deque<int> PrefetchQueue;
+  vtkSmartPointer<vtkInformation> PrefetchInfo;
+  vtkSmartPointer<vtkClientServerInterpreter> PrefetchInterpreter;
+
+  // Set by the prefetching thread while the internal reader is on another
+  // file, with the MTime to report in the meantime.
+  std::mutex MTimeMutex;
+  bool Prefetching = false;
+  vtkMTimeType PrefetchMTime = 0;
+  int LastIndex = -1;
+  int Direction = 1;
+
+  static CacheKeyType MakeKey(int index, vtkInformation* outInfo)
+  {
+    auto get = [outInfo](vtkInformationIntegerKey* key, int defaultValue) {
+      return outInfo->Has(key) ? outInfo->Get(key) : defaultValue;
+    };
+    return CacheKeyType(index, get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(), 0),
+      get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(), 1),
+      get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS(), 0));
+  }
+
+  void ValidateCache(vtkMTimeType mtime)
+  {
+    if (mtime != this->CacheMTime)
+    {
+      this->ClearCache();
+      this->CacheMTime = mtime;
+    }
+  }
+
+  vtkDataObject* FindInCache(const CacheKeyType& key)
+  {
+    auto iter = this->CacheLookup.find(key);
+    if (iter == this->CacheLookup.end())
+    {
+      return nullptr;
+    }
+    this->Cache.splice(this->Cache.begin(), this->Cache, iter->second);
+    return iter->second->second;
+  }
+
+  void AddToCache(const CacheKeyType& key, vtkDataObject* output, unsigned long budget)
+  {
+    if (this->CacheLookup.find(key) == this->CacheLookup.end())
+    {
+      this->Cache.emplace_front(key, output);
+      this->CacheLookup[key] = this->Cache.begin();
+      this->CacheMemorySize += output->GetActualMemorySize();
+      this->NumberOfCachedOutputs = static_cast<int>(this->Cache.size());
+    }
+    this->TrimCache(budget);
+  }
+
+  void TrimCache(unsigned long budget)
+  {
+    while (this->CacheMemorySize > budget && !this->Cache.empty())
+    {
+      this->CacheMemorySize -= this->Cache.back().second->GetActualMemorySize();
+      this->CacheLookup.erase(this->Cache.back().first);
+      this->Cache.pop_back();
+    }
+    this->NumberOfCachedOutputs = static_cast<int>(this->Cache.size());
+  }
+
+  void ClearCache()
+  {
+    this->Cache.clear();
+    this->CacheLookup.clear();
+    this->CacheMemorySize = 0;
+    this->NumberOfCachedOutputs = 0;
+    this->PrefetchQueue.clear();
+  }
 };
 
 //=============================================================================
@@ -384,11 +503,15 @@ vtkFileSeriesReader::vtkFileSeriesReader()
   this->UseJsonMetaFile = false;
 
   this->IgnoreReaderTime = false;
+
+  this->CacheSize = 0;
+  this->PrefetchCount = 0;
 }
 
 //-----------------------------------------------------------------------------
 vtkFileSeriesReader::~vtkFileSeriesReader()
 {
+  this->StopPrefetching();
   delete this->Internal->TimeRanges;
   delete this->Internal;
 }
@@ -491,6 +614,8 @@ int vtkFileSeriesReader::CanReadFile(const char* filename)
 int vtkFileSeriesReader::ProcessRequest(
   vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
 {
+  // The reader is shared with the prefetching thread.
+  std::lock_guard<std::recursive_mutex> lock(this->Internal->Mutex);
   vtkEnsureMTime check(this);
 
   this->UpdateMetaData();
@@ -679,6 +804,7 @@ int vtkFileSeriesReader::RequestUpdateExtent(vtkInformation* request,
   outputVector->GetInformationObject(requestFromPort)
     ->Set(FILE_SERIES_CURRENT_FILE_NUMBER(), index);
   this->RequestInformationForInput(index);
+  this->Internal->RequestedFileIndex = index;
 
 // I commented out the following block because it is probably not important
 // and it is causing a crash in some circumstances (bug #7253).
@@ -710,9 +836,49 @@ int vtkFileSeriesReader::RequestData(
   // readers (e.g. the Exodus reader) reuse this array to get time indices.
   // Just in case, restore the vector.
   vtkInformation* outInfo = outputVector->GetInformationObject(requestFromPort);
-  this->Internal->TimeRanges->GetInputTimeInfo(this->_FileIndex, outInfo);
+  auto& internal = *this->Internal;
+  if (internal.RequestedFileIndex >= 0 && internal.RequestedFileIndex != this->_FileIndex)
+  {
+    // the prefetching thread moved the reader to another file.
+    this->RequestInformationForInput(internal.RequestedFileIndex);
+  }
+  const int index = this->_FileIndex;
+  internal.TimeRanges->GetInputTimeInfo(index, outInfo);
 
-  int retVal = this->Reader->ProcessRequest(request, inputVector, outputVector);
+  int retVal;
+  vtkDataObject* output = vtkDataObject::GetData(outInfo);
+  if (this->CacheSize > 0 && output && this->GetNumberOfFileNames() > 0 &&
+    internal.TimeRanges->GetNumberOfTimeSteps(index) <= 1)
+  {
+    // BeforeFileNameMTime is the MTime reported outside of ProcessRequest.
+    internal.ValidateCache(this->BeforeFileNameMTime);
+    const auto key = vtkFileSeriesReaderInternals::MakeKey(index, outInfo);
+    if (vtkDataObject* cached = internal.FindInCache(key))
+    {
+      vtkLogF(TRACE, "%s: cache hit for file %d", vtkLogIdentifier(this), index);
+      ++internal.CacheHits;
+      output->ShallowCopy(cached);
+      retVal = 1;
+    }
+    else
+    {
+      vtkLogF(TRACE, "%s: cache miss for file %d", vtkLogIdentifier(this), index);
+      ++internal.CacheMisses;
+      vtkSmartPointer<vtkDataObject> result;
+      result.TakeReference(this->ReadOutput(index, request, outInfo));
+      retVal = result != nullptr;
+      if (result)
+      {
+        output->ShallowCopy(result);
+        internal.AddToCache(key, result, static_cast<unsigned long>(this->CacheSize) * 1024);
+      }
+    }
+    this->SchedulePrefetch(index, outInfo);
+  }
+  else
+  {
+    retVal = this->Reader->ProcessRequest(request, inputVector, outputVector);
+  }
 
   if (this->GetNumberOfFileNames() > 0)
   {
@@ -723,6 +889,279 @@ int vtkFileSeriesReader::RequestData(
   return retVal;
 }
 
+//-----------------------------------------------------------------------------
+vtkDataObject* vtkFileSeriesReader::ReadOutput(
+  int index, vtkInformation* request, vtkInformation* outInfo)
+{
+  vtkDataObject* output = vtkDataObject::GetData(outInfo)->NewInstance();
+  vtkNew<vtkInformation> info;
+  info->Copy(outInfo);
+  info->Set(vtkDataObject::DATA_OBJECT(), output);
+  info->Set(FILE_SERIES_CURRENT_FILE_NUMBER(), index);
+  vtkNew<vtkInformationVector> outputVector;
+  outputVector->Append(info);
+  if (!this->Reader->ProcessRequest(request, (vtkInformationVector**)nullptr, outputVector))
+  {
+    output->Delete();
+    return nullptr;
+  }
+  return output;
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::SchedulePrefetch(int index, vtkInformation* outInfo)
+{
+  auto& internal = *this->Internal;
+  if (internal.LastIndex >= 0 && index != internal.LastIndex)
+  {
+    internal.Direction = index > internal.LastIndex ? 1 : -1;
+  }
+  internal.LastIndex = index;
+  internal.PrefetchQueue.clear();
+  if (!this->FileNameMethod)
+  {
+    return;
+  }
+
+  const int numFiles = static_cast<int>(this->GetNumberOfFileNames());
+  for (int cc = 1; cc <= this->PrefetchCount; ++cc)
+  {
+    const int next = index + cc * internal.Direction;
+    if (next < 0 || next >= numFiles)
+    {
+      break;
+    }
+    if (internal.TimeRanges->GetNumberOfTimeSteps(next) <= 1 &&
+      internal.CacheLookup.find(vtkFileSeriesReaderInternals::MakeKey(next, outInfo)) ==
+        internal.CacheLookup.end())
+    {
+      internal.PrefetchQueue.push_back(next);
+    }
+  }
+  if (internal.PrefetchQueue.empty())
+  {
+    return;
+  }
+
+  internal.PrefetchInfo = vtkSmartPointer<vtkInformation>::New();
+  internal.PrefetchInfo->Copy(outInfo);
+  if (!internal.PrefetchThread.joinable())
+  {
+    // the global interpreter must not be used from another thread.
+    internal.PrefetchInterpreter.TakeReference(
+      vtkClientServerInterpreterInitializer::GetInitializer()->NewInterpreter());
+    internal.StopPrefetch = false;
+    internal.PrefetchThread = std::thread(&vtkFileSeriesReader::PrefetchLoop, this);
+  }
+  internal.PrefetchCondition.notify_one();
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::PrefetchLoop()
+{
+  auto& internal = *this->Internal;
+  while (true)
+  {
+    // the reader is released between two files, e.g. for LockReader().
+    std::this_thread::yield();
+    std::unique_lock<std::recursive_mutex> lock(internal.Mutex);
+    internal.PrefetchCondition.wait(
+      lock, [&internal]() { return internal.StopPrefetch || !internal.PrefetchQueue.empty(); });
+    if (internal.StopPrefetch)
+    {
+      return;
+    }
+    const int index = internal.PrefetchQueue.front();
+    internal.PrefetchQueue.pop_front();
+    const auto key = vtkFileSeriesReaderInternals::MakeKey(index, internal.PrefetchInfo);
+    if (internal.CacheLookup.find(key) != internal.CacheLookup.end())
+    {
+      continue;
+    }
+
+    // As in ProcessRequest, changing the file name of the reader must not
+    // change the MTime. Until we are done, GetMTime() reports PrefetchMTime.
+    {
+      std::lock_guard<std::mutex> mtimeLock(internal.MTimeMutex);
+      this->BeforeFileNameMTime = this->Superclass::GetMTime();
+      internal.PrefetchMTime = this->BeforeFileNameMTime;
+      internal.Prefetching = true;
+    }
+    internal.ValidateCache(this->BeforeFileNameMTime);
+
+    vtkClientServerStream stream;
+    stream << vtkClientServerStream::Invoke << this->Reader << this->FileNameMethod
+           << this->GetFileName(index) << vtkClientServerStream::End;
+    internal.PrefetchInterpreter->ProcessStream(stream);
+    this->_FileIndex = index;
+
+    vtkNew<vtkInformation> infoRequest;
+    infoRequest->Set(vtkDemandDrivenPipeline::REQUEST_INFORMATION());
+    vtkNew<vtkInformationVector> infoVector;
+    infoVector->Append(vtkSmartPointer<vtkInformation>::New());
+    const int success =
+      this->Reader->ProcessRequest(infoRequest, (vtkInformationVector**)nullptr, infoVector);
+    const vtkMTimeType fileNameMTime = this->Reader->GetMTime();
+
+    vtkSmartPointer<vtkDataObject> output;
+    if (success)
+    {
+      vtkInformation* info = internal.PrefetchInfo;
+      internal.TimeRanges->GetInputTimeInfo(index, info);
+      if (info->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS()) == 1)
+      {
+        info->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(),
+          info->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS())[0]);
+      }
+      vtkNew<vtkInformation> dataRequest;
+      dataRequest->Set(vtkDemandDrivenPipeline::REQUEST_DATA());
+      output.TakeReference(this->ReadOutput(index, dataRequest, info));
+    }
+
+    {
+      std::lock_guard<std::mutex> mtimeLock(internal.MTimeMutex);
+      this->FileNameMTime = fileNameMTime;
+      internal.Prefetching = false;
+    }
+    if (this->Reader->GetMTime() != fileNameMTime)
+    {
+      // the reader was modified while we were reading: let the pipeline see
+      // it and discard what was read.
+      internal.ClearCache();
+      continue;
+    }
+    if (!output)
+    {
+      internal.PrefetchQueue.clear();
+      continue;
+    }
+
+    vtkLogF(TRACE, "%s: prefetched file %d", vtkLogIdentifier(this), index);
+    ++internal.Prefetches;
+    const unsigned long budget = static_cast<unsigned long>(this->CacheSize) * 1024;
+    internal.AddToCache(key, output, budget);
+    if (internal.CacheLookup.find(key) == internal.CacheLookup.end() ||
+      internal.CacheMemorySize + output->GetActualMemorySize() > budget)
+    {
+      // the cache is full, reading further would evict what was prefetched.
+      internal.PrefetchQueue.clear();
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::StopPrefetching()
+{
+  auto& internal = *this->Internal;
+  // Set before locking: the thread holds the mutex while it reads a file and
+  // checks the flag before the next one.
+  internal.StopPrefetch = true;
+  {
+    std::lock_guard<std::recursive_mutex> lock(internal.Mutex);
+    internal.PrefetchQueue.clear();
+  }
+  internal.PrefetchCondition.notify_all();
+  if (internal.PrefetchThread.joinable())
+  {
+    internal.PrefetchThread.join();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::SetCacheSize(int size)
+{
+  size = std::max(size, 0);
+  if (size == this->CacheSize)
+  {
+    return;
+  }
+  this->StopPrefetching();
+  std::lock_guard<std::recursive_mutex> lock(this->Internal->Mutex);
+  this->CacheSize = size;
+  this->Internal->TrimCache(static_cast<unsigned long>(size) * 1024);
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::SetPrefetchCount(int count)
+{
+  count = std::max(count, 0);
+  if (count == this->PrefetchCount)
+  {
+    return;
+  }
+  this->StopPrefetching();
+  this->PrefetchCount = count;
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::LockReader()
+{
+  this->Internal->Mutex.lock();
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::UnlockReader()
+{
+  this->Internal->Mutex.unlock();
+}
+
+//-----------------------------------------------------------------------------
+vtkMTimeType vtkFileSeriesReader::GetMTime()
+{
+  std::lock_guard<std::mutex> lock(this->Internal->MTimeMutex);
+  if (this->Internal->Prefetching)
+  {
+    // the prefetching thread changed the file name of the reader.
+    return this->Internal->PrefetchMTime;
+  }
+  return this->Superclass::GetMTime();
+}
+
+//-----------------------------------------------------------------------------
+vtkIdType vtkFileSeriesReader::GetCacheHits()
+{
+  return this->Internal->CacheHits;
+}
+
+//-----------------------------------------------------------------------------
+vtkIdType vtkFileSeriesReader::GetCacheMisses()
+{
+  return this->Internal->CacheMisses;
+}
+
+//-----------------------------------------------------------------------------
+vtkIdType vtkFileSeriesReader::GetNumberOfPrefetchedOutputs()
+{
+  return this->Internal->Prefetches;
+}
+
+//-----------------------------------------------------------------------------
+int vtkFileSeriesReader::GetNumberOfCachedOutputs()
+{
+  return this->Internal->NumberOfCachedOutputs;
+}
+
+//-----------------------------------------------------------------------------
+unsigned long vtkFileSeriesReader::GetCacheMemorySize()
+{
+  return this->Internal->CacheMemorySize;
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::ResetCacheStatistics()
+{
+  this->Internal->CacheHits = 0;
+  this->Internal->CacheMisses = 0;
+  this->Internal->Prefetches = 0;
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::ClearCache()
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Internal->Mutex);
+  this->Internal->ClearCache();
+}
+
 //-----------------------------------------------------------------------------
 int vtkFileSeriesReader::RequestInformationForInput(
   int index, vtkInformation* request, vtkInformationVector* outputVector)
@@ -975,6 +1414,8 @@ void vtkFileSeriesReader::PrintSelf(ostream& os, vtkIndent indent)
      << endl;
   os << indent << "UseMetaFile: " << this->UseMetaFile << endl;
   os << indent << "IgnoreReaderTime: " << this->IgnoreReaderTime << endl;
+  os << indent << "CacheSize: " << this->CacheSize << endl;
+  os << indent << "PrefetchCount: " << this->PrefetchCount << endl;
 }
 
 //-----------------------------------------------------------------------------
@@ -55,6 +55,17 @@
  * with SetMetaFileName in this case. Do not use the AddFileName() method when
  * using SetMetaFileName() as names set with AddFileName() will be ignored.
  *
+ * When CacheSize is non-zero, the outputs are kept in a least-recently-used
+ * cache and a request for a cached output is served without touching the
+ * internal reader. When PrefetchCount is non-zero as well, the next files in the
+ * playback direction are read ahead on a background thread, between pipeline
+ * updates, using the same internal reader. The internal reader must then be
+ * safe to use from another thread and must not communicate with other ranks.
+ * Only files providing at most one time step are cached. Prefetching must be
+ * stopped with StopPrefetching() before the internal reader is modified
+ * directly, and the reader must be locked with LockReader() while it is
+ * queried directly.
+ *
 */
 
 #ifndef vtkFileSeriesReader_h
@@ -133,6 +144,72 @@ public:
   vtkBooleanMacro(IgnoreReaderTime, bool);
   ///@}
 
+  ///@{
+  /**
+   * Memory budget, in MiB, of the cache of outputs. 0 (default) disables the
+   * cache, and prefetching with it. Changing it does not modify the reader:
+   * outputs already cached remain valid.
+   */
+  void SetCacheSize(int);
+  vtkGetMacro(CacheSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * Number of files to read ahead, in the playback direction, on a background
+   * thread after each update. 0 (default) disables prefetching. Prefetching
+   * stops early when the cache is full. Changing it does not modify the reader.
+   */
+  void SetPrefetchCount(int);
+  vtkGetMacro(PrefetchCount, int);
+  ///@}
+
+  ///@{
+  /**
+   * Cache statistics, for diagnosis. Hits and misses count the requests for
+   * files that can be cached, prefetches count the outputs read in the
+   * background. The memory size of the cache is in KiB.
+   */
+  vtkIdType GetCacheHits();
+  vtkIdType GetCacheMisses();
+  vtkIdType GetNumberOfPrefetchedOutputs();
+  int GetNumberOfCachedOutputs();
+  unsigned long GetCacheMemorySize();
+  void ResetCacheStatistics();
+  ///@}
+
+  /**
+   * Release all cached outputs.
+   */
+  void ClearCache();
+
+  /**
+   * Stop the prefetching thread, waiting for it to finish the file it is
+   * reading. The internal reader must not be modified outside of the pipeline,
+   * e.g. to change its properties, while prefetching is running.
+   * vtkSIMetaReaderProxy calls this before pushing properties to the meta
+   * reader or to the internal reader. Prefetching resumes on the next update.
+   */
+  void StopPrefetching();
+
+  ///@{
+  /**
+   * Keep the prefetching thread off the internal reader, waiting for it to
+   * finish the file it is reading, until UnlockReader() is called. Unlike
+   * StopPrefetching(), the files left to prefetch are read afterwards.
+   * vtkSIMetaReaderProxy locks the reader while the properties of the internal
+   * reader are pulled.
+   */
+  void LockReader();
+  void UnlockReader();
+  ///@}
+
+  /**
+   * Overridden to report the MTime from before the prefetching thread changed
+   * the file name of the internal reader, until it is done with the file.
+   */
+  vtkMTimeType GetMTime() override;
+
   // Expose number of files, first filename and current file number as
   // information keys for potential use in the internal reader
   static vtkInformationIntegerKey* FILE_SERIES_NUMBER_OF_FILES();
@@ -215,10 +292,28 @@ protected:
 
   int ChooseInput(vtkInformation*);
 
+  int CacheSize;
+  int PrefetchCount;
+
 private:
   vtkFileSeriesReader(const vtkFileSeriesReader&) = delete;
   void operator=(const vtkFileSeriesReader&) = delete;
 
+  /**
+   * Read the file with the given index into a new data object, using outInfo as
+   * template for the output information. Must be called with the reader locked.
+   */
+  vtkDataObject* ReadOutput(int index, vtkInformation* request, vtkInformation* outInfo);
+
+  ///@{
+  /**
+   * Schedule the files following `index` for prefetching and the loop run by
+   * the prefetching thread.
+   */
+  void SchedulePrefetch(int index, vtkInformation* outInfo);
+  void PrefetchLoop();
+  ///@}
+
   vtkFileSeriesReaderInternals* Internal;
 };
 
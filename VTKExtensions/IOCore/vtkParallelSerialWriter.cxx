@@ -9,6 +9,7 @@
 #include "vtkCompositeDataSet.h"
 #include "vtkConvertToPartitionedDataSetCollection.h"
 #include "vtkDataSet.h"
+#include "vtkErrorCode.h"
 #include "vtkFileSeriesWriter.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -20,11 +21,13 @@
 #include "vtkReductionFilter.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkWriter.h"
 
 #include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <vector>
 #include <vtksys/SystemTools.hxx>
 
 // clang-format off
@@ -58,6 +61,7 @@ vtkParallelSerialWriter::vtkParallelSerialWriter()
   , RankAssignmentMode(vtkParallelSerialWriter::ASSIGNMENT_MODE_CONTIGUOUS)
   , Controller(nullptr)
   , SubController(nullptr)
+  , WriteAsynchronously(false)
 {
   this->SetNumberOfOutputPorts(0);
 
@@ -86,6 +90,7 @@ vtkParallelSerialWriter::vtkParallelSerialWriter()
 //-----------------------------------------------------------------------------
 vtkParallelSerialWriter::~vtkParallelSerialWriter()
 {
+  this->WaitForPendingWrite();
   this->SetWriter(nullptr);
   this->SetFileNameMethod(nullptr);
   this->SetFileName(nullptr);
@@ -369,12 +374,74 @@ void vtkParallelSerialWriter::WriteAFile(const std::string& filename_arg, vtkDat
     }
   }
 
+  // the writer is still in use by the previous asynchronous write.
+  this->WaitForPendingWrite();
+
+  vtkSmartPointer<vtkWriter> writer = vtkWriter::SafeDownCast(this->Writer);
+  if (this->WriteAsynchronously && writer && this->FileNameMethod)
+  {
+    // the gathered data may be the output of the post-gather helper, which is
+    // reused by the next write.
+    auto copy = vtk::TakeSmartPointer(input->NewInstance());
+    copy->ShallowCopy(input);
+    this->Writer->SetInputDataObject(copy);
+    this->SetWriterFileName(filename.c_str());
+    this->PendingFileName = filename;
+    this->PendingWrite = this->GetCallbackQueue()->Push([writer]() {
+      return writer->Write() && writer->GetErrorCode() == vtkErrorCode::NoError ? 1 : 0;
+    });
+    return;
+  }
+
   this->Writer->SetInputDataObject(input);
   this->SetWriterFileName(filename.c_str());
   this->WriteInternal();
   this->Writer->RemoveAllInputConnections(0);
 }
 
+//----------------------------------------------------------------------------
+int vtkParallelSerialWriter::WaitForPendingWrite()
+{
+  if (!this->PendingWrite)
+  {
+    return 1;
+  }
+
+  const int status = this->CallbackQueue->Get(this->PendingWrite);
+  this->PendingWrite = nullptr;
+  if (this->Writer)
+  {
+    this->Writer->RemoveAllInputConnections(0);
+  }
+  if (!status)
+  {
+    vtkErrorMacro("Failed to write '" << this->PendingFileName << "'.");
+  }
+  this->PendingFileName.clear();
+  return status;
+}
+
+//----------------------------------------------------------------------------
+void vtkParallelSerialWriter::SetCallbackQueue(vtkThreadedCallbackQueue* queue)
+{
+  if (this->CallbackQueue != queue)
+  {
+    this->WaitForPendingWrite();
+    this->CallbackQueue = queue;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkThreadedCallbackQueue* vtkParallelSerialWriter::GetCallbackQueue()
+{
+  if (!this->CallbackQueue)
+  {
+    this->CallbackQueue = vtkSmartPointer<vtkThreadedCallbackQueue>::New();
+  }
+  return this->CallbackQueue;
+}
+
 //----------------------------------------------------------------------------
 // Overload standard modified time function. If the internal reader is
 // modified, then this object is modified as well.
@@ -435,4 +502,5 @@ void vtkParallelSerialWriter::SetWriterFileName(const char* fname)
 void vtkParallelSerialWriter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "WriteAsynchronously: " << this->WriteAsynchronously << endl;
 }
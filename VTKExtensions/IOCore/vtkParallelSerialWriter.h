@@ -13,6 +13,13 @@
  *
  * This also makes it possible to write time-series for temporal datasets using
  * simple non-time-aware writers.
+ *
+ * When WriteAsynchronously is enabled, the ranks doing the IO hand the gathered
+ * data to a vtkThreadedCallbackQueue and return without waiting for the file
+ * to be written. The next write waits for the previous one to complete and
+ * reports its failure, if any. The internal writer is in use until then, so
+ * its properties must not be changed before calling WaitForPendingWrite();
+ * vtkSIWriterProxy does so before pushing properties.
  */
 
 #ifndef vtkParallelSerialWriter_h
@@ -21,6 +28,7 @@
 #include "vtkDataObjectAlgorithm.h"
 #include "vtkPVVTKExtensionsIOCoreModule.h" //needed for exports
 #include "vtkSmartPointer.h"                // needed for vtkSmartPointer
+#include "vtkThreadedCallbackQueue.h"       // needed for SharedFutureType
 #include <string>                           // for std::string
 
 class vtkClientServerInterpreter;
@@ -189,6 +197,35 @@ public:
   vtkGetObjectMacro(Controller, vtkMultiProcessController);
   ///@}
 
+  ///@{
+  /**
+   * When set, files are written on a background thread of the callback queue.
+   * The gathered data is shallow copied, so the next update of the input does
+   * not change what is written. This is only supported for internal writers
+   * that are subclasses of vtkWriter, other writers always write synchronously.
+   * Off by default.
+   */
+  vtkSetMacro(WriteAsynchronously, bool);
+  vtkGetMacro(WriteAsynchronously, bool);
+  vtkBooleanMacro(WriteAsynchronously, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the callback queue used for asynchronous writes. vtkSIWriterProxy
+   * sets the one of the process module. If none is set, a queue with a single
+   * thread is created when needed.
+   */
+  void SetCallbackQueue(vtkThreadedCallbackQueue* queue);
+  vtkThreadedCallbackQueue* GetCallbackQueue();
+  ///@}
+
+  /**
+   * Wait for the pending asynchronous write, if any, to complete. Returns 0 if
+   * the internal writer failed to write the file, 1 otherwise.
+   */
+  int WaitForPendingWrite();
+
 protected:
   vtkParallelSerialWriter();
   ~vtkParallelSerialWriter() override;
@@ -237,6 +274,11 @@ private:
   vtkMultiProcessController* Controller;
   vtkSmartPointer<vtkMultiProcessController> SubController;
   int SubControllerColor;
+
+  bool WriteAsynchronously;
+  vtkSmartPointer<vtkThreadedCallbackQueue> CallbackQueue;
+  vtkThreadedCallbackQueue::SharedFutureType<int> PendingWrite;
+  std::string PendingFileName;
 };
 
 #endif
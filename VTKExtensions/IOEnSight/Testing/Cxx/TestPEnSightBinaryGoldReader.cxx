@@ -3,17 +3,18 @@
 #include "vtkCellTypes.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkNew.h"
+#include "vtkPEnSightGoldBinaryReader.h"
 #include "vtkPGenericEnSightReader.h"
 #include "vtkTestUtilities.h"
 #include "vtkUnstructuredGrid.h"
 
-int TestPEnSightBinaryGoldReader(int argc, char* argv[])
+namespace
+{
+int TestReader(const char* fname, int ioBackend, vtkIdType& nbPoints, vtkIdType& nbCells)
 {
-  char* fname =
-    vtkTestUtilities::ExpandDataFileName(argc, argv, "Testing/Data/EnSight/TEST_bin.case");
-
   vtkNew<vtkPGenericEnSightReader> reader;
   reader->SetCaseFileName(fname);
+  reader->SetIOBackend(ioBackend);
   reader->Update();
   vtkMultiBlockDataSet* mb = reader->GetOutput();
   vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(mb->GetBlock(0));
@@ -44,5 +45,40 @@ int TestPEnSightBinaryGoldReader(int argc, char* argv[])
     }
   }
 
+  nbPoints = ug->GetNumberOfPoints();
+  nbCells = ug->GetNumberOfCells();
   return EXIT_SUCCESS;
 }
+}
+
+int TestPEnSightBinaryGoldReader(int argc, char* argv[])
+{
+  char* fname =
+    vtkTestUtilities::ExpandDataFileName(argc, argv, "Testing/Data/EnSight/TEST_bin.case");
+
+  vtkIdType nbPoints = 0;
+  vtkIdType nbCells = 0;
+  int result = TestReader(fname, vtkPEnSightGoldBinaryReader::IO_BACKEND_STREAM, nbPoints, nbCells);
+
+  // Other backends must read the same data.
+  for (int ioBackend : { vtkPEnSightGoldBinaryReader::IO_BACKEND_MEMORY_MAP,
+         vtkPEnSightGoldBinaryReader::IO_BACKEND_BLOCK })
+  {
+    vtkIdType backendNbPoints = 0;
+    vtkIdType backendNbCells = 0;
+    if (result == EXIT_SUCCESS)
+    {
+      result = TestReader(fname, ioBackend, backendNbPoints, backendNbCells);
+    }
+    if (result == EXIT_SUCCESS && (backendNbPoints != nbPoints || backendNbCells != nbCells))
+    {
+      std::cerr << "IOBackend " << ioBackend << " read " << backendNbPoints << " points and "
+                << backendNbCells << " cells instead of " << nbPoints << " and " << nbCells << "."
+                << std::endl;
+      result = EXIT_FAILURE;
+    }
+  }
+
+  delete[] fname;
+  return result;
+}
@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPEnSightGoldBinaryReader.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+
+namespace
+{
+// Gives access to the offsets and to the index file methods.
+class vtkTestEnSightReader : public vtkPEnSightGoldBinaryReader
+{
+public:
+  static vtkTestEnSightReader* New();
+  vtkTypeMacro(vtkTestEnSightReader, vtkPEnSightGoldBinaryReader);
+
+  using vtkPEnSightGoldBinaryReader::FileOffsets;
+  using vtkPEnSightGoldBinaryReader::GetOffsetIndexFileName;
+  using vtkPEnSightGoldBinaryReader::LoadOffsetIndex;
+  using vtkPEnSightGoldBinaryReader::SaveOffsetIndex;
+};
+vtkStandardNewMacro(vtkTestEnSightReader);
+
+bool WriteDataFile(const std::string& fileName, const std::string& content)
+{
+  vtksys::ofstream file(fileName.c_str(), ios::out | ios::binary);
+  file << content;
+  return static_cast<bool>(file);
+}
+
+vtkSmartPointer<vtkTestEnSightReader> NewReader(const std::string& directory)
+{
+  auto reader = vtkSmartPointer<vtkTestEnSightReader>::New();
+  reader->SetFilePath(directory.c_str());
+  reader->SetCaseFileName("offsets.case");
+  return reader;
+}
+}
+
+int TestPEnSightOffsetIndex(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string directory = tempDir;
+  delete[] tempDir;
+
+  const std::string geometry = directory + "/offsets.geo";
+  const std::string variable = directory + "/offsets.scl";
+  if (!WriteDataFile(geometry, std::string(4096, 'g')) ||
+    !WriteDataFile(variable, std::string(2048, 's')))
+  {
+    cerr << "ERROR: cannot write data files in " << directory << endl;
+    return EXIT_FAILURE;
+  }
+
+  const std::map<int, long> geometryOffsets = { { 0, 80 }, { 1, 1104 }, { 2, 2128 } };
+  const std::map<int, long> variableOffsets = { { 0, 80 }, { 1, 1080 } };
+
+  auto writer = NewReader(directory);
+  const std::string indexFileName = writer->GetOffsetIndexFileName();
+  if (indexFileName != directory + "/offsets.pvidx")
+  {
+    cerr << "ERROR: unexpected index file name " << indexFileName << endl;
+    return EXIT_FAILURE;
+  }
+  vtksys::SystemTools::RemoveFile(indexFileName);
+  writer->FileOffsets["offsets.geo"] = geometryOffsets;
+  writer->FileOffsets["offsets.scl"] = variableOffsets;
+  writer->SaveOffsetIndex(indexFileName);
+  if (!vtksys::SystemTools::FileExists(indexFileName) ||
+    vtksys::SystemTools::FileExists(indexFileName + ".tmp"))
+  {
+    cerr << "ERROR: index file was not written." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Round trip.
+  auto reader = NewReader(directory);
+  reader->LoadOffsetIndex(indexFileName);
+  if (reader->FileOffsets.size() != 2 || reader->FileOffsets["offsets.geo"] != geometryOffsets ||
+    reader->FileOffsets["offsets.scl"] != variableOffsets)
+  {
+    cerr << "ERROR: offsets loaded from the index differ from the saved ones." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // A data file whose size changed is not indexed anymore.
+  if (!WriteDataFile(geometry, std::string(4097, 'g')))
+  {
+    cerr << "ERROR: cannot write " << geometry << endl;
+    return EXIT_FAILURE;
+  }
+  reader = NewReader(directory);
+  reader->LoadOffsetIndex(indexFileName);
+  if (reader->FileOffsets.count("offsets.geo") != 0 ||
+    reader->FileOffsets["offsets.scl"] != variableOffsets)
+  {
+    cerr << "ERROR: offsets of a resized data file were used." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Neither is a data file rewritten with the same size later on. The
+  // modification time has a resolution of one second.
+  std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+  if (!WriteDataFile(variable, std::string(2048, 't')))
+  {
+    cerr << "ERROR: cannot write " << variable << endl;
+    return EXIT_FAILURE;
+  }
+  reader = NewReader(directory);
+  reader->LoadOffsetIndex(indexFileName);
+  if (!reader->FileOffsets.empty())
+  {
+    cerr << "ERROR: offsets of a modified data file were used." << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtksys::SystemTools::RemoveFile(indexFileName);
+  vtksys::SystemTools::RemoveFile(geometry);
+  vtksys::SystemTools::RemoveFile(variable);
+  return EXIT_SUCCESS;
+}
@@ -17,11 +17,368 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include "vtksys/Encoding.hxx"
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
+#include <algorithm>
 #include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <streambuf>
 #include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include "vtkWindows.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+// Size of the blocks read by the block backend.
+constexpr std::streamsize BLOCK_SIZE = 4 << 20;
+// Number of file mappings kept by a reader.
+constexpr std::size_t MAXIMUM_MAPPED_FILES = 8;
+
+//----------------------------------------------------------------------------
+// Read-only mapping of a whole file.
+class MappedFile
+{
+public:
+  ~MappedFile()
+  {
+#ifdef _WIN32
+    UnmapViewOfFile(this->Data);
+    CloseHandle(this->Mapping);
+#else
+    munmap(const_cast<char*>(this->Data), this->Size);
+#endif
+  }
+
+  static std::shared_ptr<MappedFile> Map(const char* filename, std::size_t size)
+  {
+    void* data = nullptr;
+#ifdef _WIN32
+    HANDLE file = CreateFileW(vtksys::Encoding::ToWide(filename).c_str(), GENERIC_READ,
+      FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+      return nullptr;
+    }
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+    {
+      return nullptr;
+    }
+    data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data)
+    {
+      CloseHandle(mapping);
+      return nullptr;
+    }
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+      return nullptr;
+    }
+    data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+      return nullptr;
+    }
+#endif
+    std::shared_ptr<MappedFile> result(new MappedFile());
+    result->Data = static_cast<const char*>(data);
+    result->Size = size;
+#ifdef _WIN32
+    result->Mapping = mapping;
+#endif
+    return result;
+  }
+
+  const char* Data = nullptr;
+  std::size_t Size = 0;
+
+private:
+  MappedFile() = default;
+#ifdef _WIN32
+  HANDLE Mapping = nullptr;
+#endif
+};
+
+//----------------------------------------------------------------------------
+// Stream buffer reading directly from a file mapping, so that seeking and
+// reading do not need any I/O call.
+class MappedStreamBuffer : public std::streambuf
+{
+public:
+  explicit MappedStreamBuffer(std::shared_ptr<MappedFile> file)
+    : File(std::move(file))
+  {
+    char* begin = const_cast<char*>(this->File->Data);
+    this->setg(begin, begin, begin + this->File->Size);
+  }
+
+protected:
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+  {
+    if (!(which & std::ios_base::in))
+    {
+      return pos_type(off_type(-1));
+    }
+    const off_type size = this->egptr() - this->eback();
+    off_type pos = off;
+    if (dir == std::ios_base::cur)
+    {
+      pos += this->gptr() - this->eback();
+    }
+    else if (dir == std::ios_base::end)
+    {
+      pos += size;
+    }
+    if (pos < 0 || pos > size)
+    {
+      return pos_type(off_type(-1));
+    }
+    this->setg(this->eback(), this->eback() + pos, this->egptr());
+    return pos_type(pos);
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+  {
+    return this->seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+
+  std::streamsize xsgetn(char* s, std::streamsize n) override
+  {
+    n = std::min<std::streamsize>(n, this->egptr() - this->gptr());
+    std::memcpy(s, this->gptr(), n);
+    this->setg(this->eback(), this->gptr() + n, this->egptr());
+    return n;
+  }
+
+private:
+  std::shared_ptr<MappedFile> File;
+};
+
+//----------------------------------------------------------------------------
+// Stream buffer reading the file by large aligned blocks. Seeking inside the
+// current block does not need any I/O call, and the next block is read ahead
+// by the system when possible.
+class BlockStreamBuffer : public std::streambuf
+{
+public:
+  BlockStreamBuffer(FILE* file, long long fileSize)
+    : File(file)
+    , FileSize(fileSize)
+    , Buffer(BLOCK_SIZE)
+  {
+    // We do our own buffering.
+    setvbuf(this->File, nullptr, _IONBF, 0);
+#if defined(__linux__)
+    posix_fadvise(fileno(this->File), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    this->setg(this->Buffer.data(), this->Buffer.data(), this->Buffer.data());
+  }
+
+  ~BlockStreamBuffer() override { fclose(this->File); }
+
+protected:
+  int_type underflow() override
+  {
+    if (this->gptr() < this->egptr() || this->LoadBlock(this->GetPosition()))
+    {
+      return traits_type::to_int_type(*this->gptr());
+    }
+    return traits_type::eof();
+  }
+
+  std::streamsize xsgetn(char* s, std::streamsize n) override
+  {
+    std::streamsize done = 0;
+    while (done < n)
+    {
+      if (this->gptr() == this->egptr())
+      {
+        const long long pos = this->GetPosition();
+        if (n - done >= BLOCK_SIZE)
+        {
+          // Large reads go directly to the destination.
+          const std::size_t count = this->Seek(pos)
+            ? fread(s + done, 1, static_cast<std::size_t>(n - done), this->File)
+            : 0;
+          done += count;
+          this->ResetBlock(pos + count);
+          break;
+        }
+        if (!this->LoadBlock(pos))
+        {
+          break;
+        }
+      }
+      const std::streamsize count =
+        std::min<std::streamsize>(n - done, this->egptr() - this->gptr());
+      std::memcpy(s + done, this->gptr(), count);
+      this->setg(this->eback(), this->gptr() + count, this->egptr());
+      done += count;
+    }
+    return done;
+  }
+
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+  {
+    if (!(which & std::ios_base::in))
+    {
+      return pos_type(off_type(-1));
+    }
+    long long pos = off;
+    if (dir == std::ios_base::cur)
+    {
+      pos += this->GetPosition();
+    }
+    else if (dir == std::ios_base::end)
+    {
+      pos += this->FileSize;
+    }
+    if (pos < 0)
+    {
+      return pos_type(off_type(-1));
+    }
+    if (pos >= this->BlockStart && pos <= this->BlockStart + (this->egptr() - this->eback()))
+    {
+      this->setg(this->eback(), this->eback() + (pos - this->BlockStart), this->egptr());
+    }
+    else
+    {
+      this->ResetBlock(pos);
+    }
+    return pos_type(off_type(pos));
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+  {
+    return this->seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+
+private:
+  long long GetPosition() const { return this->BlockStart + (this->gptr() - this->eback()); }
+
+  // Empty the buffer, the next read starts at pos.
+  void ResetBlock(long long pos)
+  {
+    this->BlockStart = pos;
+    this->setg(this->Buffer.data(), this->Buffer.data(), this->Buffer.data());
+  }
+
+  bool Seek(long long pos)
+  {
+#ifdef _WIN32
+    return _fseeki64(this->File, pos, SEEK_SET) == 0;
+#else
+    return fseeko(this->File, static_cast<off_t>(pos), SEEK_SET) == 0;
+#endif
+  }
+
+  // Read the block containing pos.
+  bool LoadBlock(long long pos)
+  {
+    const long long blockStart = pos - pos % BLOCK_SIZE;
+    const std::size_t count =
+      this->Seek(blockStart) ? fread(this->Buffer.data(), 1, this->Buffer.size(), this->File) : 0;
+    if (blockStart + static_cast<long long>(count) <= pos)
+    {
+      this->ResetBlock(pos);
+      return false;
+    }
+    this->BlockStart = blockStart;
+    char* begin = this->Buffer.data();
+    this->setg(begin, begin + (pos - blockStart), begin + count);
+#if defined(__linux__)
+    posix_fadvise(fileno(this->File), blockStart + BLOCK_SIZE, BLOCK_SIZE, POSIX_FADV_WILLNEED);
+#endif
+    return true;
+  }
+
+  FILE* File;
+  long long FileSize;
+  std::vector<char> Buffer;
+  long long BlockStart = 0; // File position of the beginning of the buffer
+};
+
+//----------------------------------------------------------------------------
+// istream owning its stream buffer.
+class BufferedInputStream : public std::istream
+{
+public:
+  explicit BufferedInputStream(std::streambuf* buffer)
+    : std::istream(buffer)
+    , Buffer(buffer)
+  {
+  }
+
+private:
+  std::unique_ptr<std::streambuf> Buffer;
+};
+}
+
+//----------------------------------------------------------------------------
+// Keep the mappings of the recently used files.
+class vtkPEnSightGoldBinaryReader::MappedFileCache
+{
+public:
+  std::shared_ptr<MappedFile> Get(
+    const std::string& filename, const vtksys::SystemTools::Stat_t& fs)
+  {
+    auto iter = this->Files.find(filename);
+    if (iter != this->Files.end() && iter->second.MTime == static_cast<long long>(fs.st_mtime) &&
+      iter->second.File->Size == static_cast<std::size_t>(fs.st_size))
+    {
+      iter->second.LastUse = ++this->Counter;
+      return iter->second.File;
+    }
+    if (iter != this->Files.end())
+    {
+      // The file changed.
+      this->Files.erase(iter);
+    }
+
+    auto file = MappedFile::Map(filename.c_str(), static_cast<std::size_t>(fs.st_size));
+    if (!file)
+    {
+      return nullptr;
+    }
+    if (this->Files.size() >= MAXIMUM_MAPPED_FILES)
+    {
+      auto oldest = std::min_element(this->Files.begin(), this->Files.end(),
+        [](const std::pair<const std::string, Entry>& a,
+          const std::pair<const std::string, Entry>& b) {
+          return a.second.LastUse < b.second.LastUse;
+        });
+      this->Files.erase(oldest);
+    }
+    this->Files[filename] = Entry{ file, static_cast<long long>(fs.st_mtime), ++this->Counter };
+    return file;
+  }
+
+private:
+  struct Entry
+  {
+    std::shared_ptr<MappedFile> File;
+    long long MTime;
+    unsigned long LastUse;
+  };
+  std::map<std::string, Entry> Files;
+  unsigned long Counter = 0;
+};
 
 vtkStandardNewMacro(vtkPEnSightGoldBinaryReader);
 
@@ -33,6 +390,9 @@ vtkPEnSightGoldBinaryReader::vtkPEnSightGoldBinaryReader()
 {
   this->IFile = nullptr;
   this->FileSize = 0;
+  this->IOBackend = IO_BACKEND_STREAM;
+  this->UseOffsetIndexFile = false;
+  this->MappedFiles = new MappedFileCache();
   this->Fortran = 0;
   this->NodeIdsListed = 0;
   this->ElementIdsListed = 0;
@@ -52,12 +412,191 @@ vtkPEnSightGoldBinaryReader::vtkPEnSightGoldBinaryReader()
 vtkPEnSightGoldBinaryReader::~vtkPEnSightGoldBinaryReader()
 {
   delete this->IFile;
+  delete this->MappedFiles;
   delete[] this->FloatBuffer[2];
   delete[] this->FloatBuffer[1];
   delete[] this->FloatBuffer[0];
   free(this->FloatBuffer);
 }
 
+//----------------------------------------------------------------------------
+int vtkPEnSightGoldBinaryReader::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  if (!this->UseOffsetIndexFile)
+  {
+    return this->Superclass::RequestData(request, inputVector, outputVector);
+  }
+
+  const std::string indexFileName = this->GetOffsetIndexFileName();
+  if (indexFileName != this->LoadedOffsetIndexFile)
+  {
+    this->LoadOffsetIndex(indexFileName);
+    this->LoadedOffsetIndexFile = indexFileName;
+  }
+
+  auto countOffsets = [this]() {
+    std::size_t count = 0;
+    for (const auto& fileOffsets : this->FileOffsets)
+    {
+      count += fileOffsets.second.size();
+    }
+    return count;
+  };
+  const std::size_t numberOfOffsets = countOffsets();
+
+  const int result = this->Superclass::RequestData(request, inputVector, outputVector);
+
+  // Save the offsets found while reading.
+  if (countOffsets() != numberOfOffsets && this->GetMultiProcessLocalProcessId() <= 0)
+  {
+    this->SaveOffsetIndex(indexFileName);
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkPEnSightGoldBinaryReader::GetFullFileName(const std::string& fileName)
+{
+  if (!this->FilePath)
+  {
+    return fileName;
+  }
+  std::string fullFileName = this->FilePath;
+  if (!fullFileName.empty() && fullFileName.back() != '/')
+  {
+    fullFileName += "/";
+  }
+  return fullFileName + fileName;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkPEnSightGoldBinaryReader::GetOffsetIndexFileName()
+{
+  if (!this->CaseFileName)
+  {
+    return std::string();
+  }
+  const std::string caseFileName = this->GetFullFileName(this->CaseFileName);
+  std::string path = vtksys::SystemTools::GetFilenamePath(caseFileName);
+  if (!path.empty())
+  {
+    path += "/";
+  }
+  return path + vtksys::SystemTools::GetFilenameWithoutLastExtension(caseFileName) + ".pvidx";
+}
+
+//----------------------------------------------------------------------------
+// The offset index file is a text file:
+//   vtkPEnSightOffsetIndex <version>
+//   <number of files>
+// then for each file:
+//   <file name>
+//   <file size> <file modification time> <number of offsets>
+//   <time step> <offset> (one line per offset)
+void vtkPEnSightGoldBinaryReader::LoadOffsetIndex(const std::string& indexFileName)
+{
+  vtksys::ifstream file(indexFileName.c_str(), ios::in);
+  if (indexFileName.empty() || !file)
+  {
+    return;
+  }
+
+  std::string magic;
+  int version = 0;
+  std::size_t numberOfFiles = 0;
+  if (!(file >> magic >> version >> numberOfFiles) || magic != "vtkPEnSightOffsetIndex" ||
+    version != 1)
+  {
+    vtkWarningMacro("Ignoring invalid offset index file " << indexFileName);
+    return;
+  }
+
+  for (std::size_t cc = 0; cc < numberOfFiles; ++cc)
+  {
+    std::string fileName;
+    long long size, mtime;
+    std::size_t numberOfOffsets;
+    file >> std::ws;
+    std::getline(file, fileName);
+    if (!(file >> size >> mtime >> numberOfOffsets))
+    {
+      vtkWarningMacro("Ignoring truncated offset index file " << indexFileName);
+      return;
+    }
+    std::map<int, long> offsets;
+    for (std::size_t kk = 0; kk < numberOfOffsets; ++kk)
+    {
+      int timeStep;
+      long offset;
+      if (!(file >> timeStep >> offset))
+      {
+        vtkWarningMacro("Ignoring truncated offset index file " << indexFileName);
+        return;
+      }
+      offsets[timeStep] = offset;
+    }
+
+    // Only use the offsets if the file did not change.
+    vtksys::SystemTools::Stat_t fs;
+    if (vtksys::SystemTools::Stat(this->GetFullFileName(fileName).c_str(), &fs) == 0 &&
+      static_cast<long long>(fs.st_size) == size && static_cast<long long>(fs.st_mtime) == mtime)
+    {
+      this->FileOffsets[fileName].insert(offsets.begin(), offsets.end());
+    }
+    else
+    {
+      vtkDebugMacro("Ignoring outdated offsets of " << fileName);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightGoldBinaryReader::SaveOffsetIndex(const std::string& indexFileName)
+{
+  if (indexFileName.empty())
+  {
+    return;
+  }
+
+  // Write to a temporary file first so that readers never see a partial index.
+  const std::string tmpFileName = indexFileName + ".tmp";
+  {
+    vtksys::ofstream file(tmpFileName.c_str(), ios::out);
+    if (!file)
+    {
+      vtkDebugMacro("Cannot write offset index file " << indexFileName);
+      return;
+    }
+    file << "vtkPEnSightOffsetIndex 1\n" << this->FileOffsets.size() << "\n";
+    for (const auto& fileOffsets : this->FileOffsets)
+    {
+      vtksys::SystemTools::Stat_t fs;
+      long long size = -1, mtime = -1;
+      if (vtksys::SystemTools::Stat(this->GetFullFileName(fileOffsets.first).c_str(), &fs) == 0)
+      {
+        size = static_cast<long long>(fs.st_size);
+        mtime = static_cast<long long>(fs.st_mtime);
+      }
+      file << fileOffsets.first << "\n"
+           << size << " " << mtime << " " << fileOffsets.second.size() << "\n";
+      for (const auto& offset : fileOffsets.second)
+      {
+        file << offset.first << " " << offset.second << "\n";
+      }
+    }
+    if (!file)
+    {
+      vtkDebugMacro("Cannot write offset index file " << indexFileName);
+      return;
+    }
+  }
+  if (!vtksys::SystemTools::RenameFile(tmpFileName, indexFileName))
+  {
+    vtksys::SystemTools::RemoveFile(tmpFileName);
+  }
+}
+
 //----------------------------------------------------------------------------
 int vtkPEnSightGoldBinaryReader::OpenFile(const char* filename)
 {
@@ -79,11 +618,32 @@ int vtkPEnSightGoldBinaryReader::OpenFile(const char* filename)
     // Find out how big the file is.
     this->FileSize = (long)(fs.st_size);
 
+    if (this->IOBackend == IO_BACKEND_MEMORY_MAP && fs.st_size > 0)
+    {
+      if (auto mapped = this->MappedFiles->Get(filename, fs))
+      {
+        this->IFile = new BufferedInputStream(new MappedStreamBuffer(mapped));
+      }
+      else
+      {
+        vtkDebugMacro(<< "Could not map " << filename << ", using block reads instead.");
+      }
+    }
+    if (!this->IFile && this->IOBackend != IO_BACKEND_STREAM)
+    {
+      if (FILE* file = vtksys::SystemTools::Fopen(filename, "rb"))
+      {
+        this->IFile = new BufferedInputStream(new BlockStreamBuffer(file, fs.st_size));
+      }
+    }
+    if (!this->IFile)
+    {
 #ifdef _WIN32
-    this->IFile = new vtksys::ifstream(filename, ios::in | ios::binary);
+      this->IFile = new vtksys::ifstream(filename, ios::in | ios::binary);
 #else
-    this->IFile = new vtksys::ifstream(filename, ios::in);
+      this->IFile = new vtksys::ifstream(filename, ios::in);
 #endif
+    }
   }
   else
   {
@@ -4514,4 +5074,6 @@ void vtkPEnSightGoldBinaryReader::UpdateFloatBuffer()
 void vtkPEnSightGoldBinaryReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "IOBackend: " << this->IOBackend << endl;
+  os << indent << "UseOffsetIndexFile: " << this->UseOffsetIndexFile << endl;
 }
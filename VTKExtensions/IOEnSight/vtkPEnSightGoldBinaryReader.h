@@ -7,6 +7,20 @@
  *
  * Parallel vtkEnSightGoldBinaryReader.
  *
+ * The IOBackend option chooses how the files are accessed. The default uses
+ * a regular file stream. The memory mapped backend maps each file once and
+ * keeps the mappings of the recently used files, so that geometry files
+ * shared across timesteps are not read again and skipping parts does not
+ * cost any I/O call. The block backend reads the files by large aligned
+ * blocks and asks the system to read the next block ahead. When a file
+ * cannot be mapped, the block backend is used instead.
+ *
+ * For single-file transient data, the offset of each timestep in the files
+ * is found by scanning the file and kept in memory. When UseOffsetIndexFile
+ * is set, these offsets are also saved to a `<case>.pvidx` file next to the
+ * case file and loaded from it when the case is read again, so that a
+ * timestep can be read without scanning the previous ones.
+ *
  * \verbatim
  * This file has been developed as part of the CARRIOCAS (Distributed
  * computation over ultra high optical internet network ) project (
@@ -24,6 +38,8 @@
 #include "vtkPEnSightReader.h"
 #include "vtkPVVTKExtensionsIOEnSightModule.h" //needed for exports
 
+#include <string> // for std::string
+
 class vtkMultiBlockDataSet;
 class vtkUnstructuredGrid;
 class vtkPoints;
@@ -35,10 +51,39 @@ public:
   vtkTypeMacro(vtkPEnSightGoldBinaryReader, vtkPEnSightReader);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  enum IOBackendType
+  {
+    IO_BACKEND_STREAM = 0,
+    IO_BACKEND_MEMORY_MAP = 1,
+    IO_BACKEND_BLOCK = 2
+  };
+
+  ///@{
+  /**
+   * Set/Get how the files are accessed. Default is IO_BACKEND_STREAM.
+   */
+  vtkSetClampMacro(IOBackend, int, IO_BACKEND_STREAM, IO_BACKEND_BLOCK);
+  vtkGetMacro(IOBackend, int);
+  ///@}
+
+  ///@{
+  /**
+   * When set, the timestep offsets of single-file transient data are saved
+   * to and loaded from a `<case>.pvidx` file next to the case file. Offsets
+   * of a data file are only used if its size and modification time did not
+   * change since they were saved. Default is false.
+   */
+  vtkSetMacro(UseOffsetIndexFile, bool);
+  vtkGetMacro(UseOffsetIndexFile, bool);
+  vtkBooleanMacro(UseOffsetIndexFile, bool);
+  ///@}
+
 protected:
   vtkPEnSightGoldBinaryReader();
   ~vtkPEnSightGoldBinaryReader() override;
 
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
   // Returns 1 if successful.  Sets file size as a side action.
   int OpenFile(const char* filename);
 
@@ -197,6 +242,27 @@ protected:
   // The size of the file could be used to choose byte order.
   long FileSize;
 
+  int IOBackend;
+  bool UseOffsetIndexFile;
+
+  ///@{
+  /**
+   * Load/Save the FileOffsets from/to the offset index file. Only the first
+   * process saves the file.
+   */
+  std::string GetOffsetIndexFileName();
+  void LoadOffsetIndex(const std::string& indexFileName);
+  void SaveOffsetIndex(const std::string& indexFileName);
+  ///@}
+
+  /**
+   * Return the path of a file of the data set, relative to FilePath.
+   */
+  std::string GetFullFileName(const std::string& fileName);
+
+  // Offset index file loaded in FileOffsets, if any.
+  std::string LoadedOffsetIndexFile;
+
   // Float Vector Buffer utils
   void GetVectorFromFloatBuffer(vtkIdType i, float* vector);
   void UpdateFloatBuffer();
@@ -213,6 +279,9 @@ protected:
   vtkIdType FloatBufferNumberOfVectors;
 
 private:
+  class MappedFileCache;
+  MappedFileCache* MappedFiles;
+
   vtkPEnSightGoldBinaryReader(const vtkPEnSightGoldBinaryReader&) = delete;
   void operator=(const vtkPEnSightGoldBinaryReader&) = delete;
 };
@@ -87,6 +87,9 @@ int vtkPGenericEnSightReader::RequestInformation(
     {
       this->Reader = vtkPEnSightGoldBinaryReader::New();
     }
+    auto binaryReader = static_cast<vtkPEnSightGoldBinaryReader*>(this->Reader);
+    binaryReader->SetIOBackend(this->IOBackend);
+    binaryReader->SetUseOffsetIndexFile(this->UseOffsetIndexFile);
   }
   else
   {
@@ -190,4 +193,6 @@ void vtkPGenericEnSightReader::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "MultiProcessLocalProcessId: " << this->MultiProcessLocalProcessId << endl;
   os << indent << "MultiProcessNumberOfProcesses: " << this->MultiProcessNumberOfProcesses << endl;
+  os << indent << "IOBackend: " << this->IOBackend << endl;
+  os << indent << "UseOffsetIndexFile: " << this->UseOffsetIndexFile << endl;
 }
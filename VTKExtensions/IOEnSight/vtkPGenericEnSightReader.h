@@ -27,6 +27,28 @@ public:
   vtkTypeMacro(vtkPGenericEnSightReader, vtkGenericEnSightReader);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  ///@{
+  /**
+   * Set/Get how the binary EnSight Gold files are accessed when reading in
+   * parallel. See vtkPEnSightGoldBinaryReader::IOBackendType.
+   * Default is 0 (regular file stream).
+   */
+  vtkSetClampMacro(IOBackend, int, 0, 2);
+  vtkGetMacro(IOBackend, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get whether the timestep offsets of single-file transient binary
+   * EnSight Gold files are saved to and loaded from a `<case>.pvidx` file
+   * when reading in parallel. See vtkPEnSightGoldBinaryReader.
+   * Default is false.
+   */
+  vtkSetMacro(UseOffsetIndexFile, bool);
+  vtkGetMacro(UseOffsetIndexFile, bool);
+  vtkBooleanMacro(UseOffsetIndexFile, bool);
+  ///@}
+
 protected:
   vtkPGenericEnSightReader();
   ~vtkPGenericEnSightReader() override;
@@ -44,6 +66,8 @@ protected:
 
   int MultiProcessLocalProcessId;
   int MultiProcessNumberOfProcesses;
+  int IOBackend = 0;
+  bool UseOffsetIndexFile = false;
 
 private:
   vtkPGenericEnSightReader(const vtkPGenericEnSightReader&) = delete;
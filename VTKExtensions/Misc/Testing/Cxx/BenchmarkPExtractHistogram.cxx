@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkDoubleArray.h"
+#include "vtkMPIController.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPExtractHistogram.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkTable.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+
+namespace
+{
+vtkSmartPointer<vtkTable> Histogram(vtkPolyData* input, bool direct, double& time)
+{
+  vtkPExtractHistogram::SetUseDirectReduction(direct);
+  vtkNew<vtkPExtractHistogram> histogram;
+  histogram->SetInputData(input);
+  histogram->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "scalars");
+  histogram->SetBinCount(256);
+  histogram->SetCalculateAverages(true);
+
+  vtkMultiProcessController::GetGlobalController()->Barrier();
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  histogram->Update();
+  timer->StopTimer();
+  time = timer->GetElapsedTime();
+  return histogram->GetOutput();
+}
+}
+
+// Times vtkPExtractHistogram gathering the local histograms to reduce them,
+// and reducing them directly.
+int BenchmarkPExtractHistogram(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+  const int rank = controller->GetLocalProcessId();
+
+  int numValues = 10000000;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument("--values", argT::EQUAL_ARGUMENT, &numValues, "Number of values per rank.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    controller->Finalize();
+    return EXIT_FAILURE;
+  }
+
+  // ranks get values in different ranges so that the range reduction matters.
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(rank + 1);
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("scalars");
+  scalars->SetNumberOfTuples(numValues);
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("vectors");
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(numValues);
+  for (vtkIdType cc = 0; cc < numValues; ++cc)
+  {
+    scalars->SetValue(cc, random->GetNextRangeValue(-rank, 10 + 2 * rank));
+    for (int comp = 0; comp < 3; ++comp)
+    {
+      vectors->SetTypedComponent(cc, comp, random->GetNextRangeValue(0, 1));
+    }
+  }
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numValues);
+  for (vtkIdType cc = 0; cc < numValues; ++cc)
+  {
+    points->SetPoint(cc, 0, 0, 0);
+  }
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+  input->GetPointData()->AddArray(scalars);
+  input->GetPointData()->AddArray(vectors);
+
+  const bool prevUseDirect = vtkPExtractHistogram::GetUseDirectReduction();
+  double gatherTime, directTime;
+  Histogram(input, false, gatherTime);
+  Histogram(input, true, directTime);
+  vtkPExtractHistogram::SetUseDirectReduction(prevUseDirect);
+
+  if (rank == 0)
+  {
+    cout << "Values per rank: " << numValues << endl;
+    cout << "Gather and reduce: " << gatherTime << "s, direct reduction: " << directTime << "s"
+         << endl;
+  }
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return EXIT_SUCCESS;
+}
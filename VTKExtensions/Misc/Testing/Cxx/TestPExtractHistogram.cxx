@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkDoubleArray.h"
+#include "vtkMPIController.h"
+#include "vtkMathUtilities.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPExtractHistogram.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkTable.h"
+
+namespace
+{
+vtkSmartPointer<vtkTable> Histogram(vtkPolyData* input, bool direct)
+{
+  vtkPExtractHistogram::SetUseDirectReduction(direct);
+  vtkNew<vtkPExtractHistogram> histogram;
+  histogram->SetInputData(input);
+  histogram->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "scalars");
+  histogram->SetBinCount(256);
+  histogram->SetCalculateAverages(true);
+  histogram->Update();
+  return histogram->GetOutput();
+}
+
+bool Compare(vtkTable* expected, vtkTable* actual)
+{
+  if (expected->GetNumberOfColumns() != actual->GetNumberOfColumns() ||
+    expected->GetNumberOfRows() != actual->GetNumberOfRows())
+  {
+    cerr << "ERROR: histogram layouts differ." << endl;
+    return false;
+  }
+  for (vtkIdType col = 0; col < expected->GetNumberOfColumns(); ++col)
+  {
+    vtkDataArray* earray = vtkDataArray::SafeDownCast(expected->GetColumn(col));
+    vtkDataArray* aarray = vtkDataArray::SafeDownCast(actual->GetColumnByName(earray->GetName()));
+    if (!aarray || aarray->GetNumberOfValues() != earray->GetNumberOfValues())
+    {
+      cerr << "ERROR: missing or invalid array '" << earray->GetName() << "'." << endl;
+      return false;
+    }
+    for (vtkIdType cc = 0; cc < earray->GetNumberOfValues(); ++cc)
+    {
+      const double evalue = earray->GetComponent(cc / earray->GetNumberOfComponents(),
+        static_cast<int>(cc % earray->GetNumberOfComponents()));
+      const double avalue = aarray->GetComponent(cc / aarray->GetNumberOfComponents(),
+        static_cast<int>(cc % aarray->GetNumberOfComponents()));
+      if (evalue != avalue && !vtkMathUtilities::FuzzyCompare(evalue, avalue, 1e-9))
+      {
+        cerr << "ERROR: '" << earray->GetName() << "' differs at " << cc << ": expected "
+             << evalue << ", got " << avalue << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestPExtractHistogram(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+  const int rank = controller->GetLocalProcessId();
+
+  const vtkIdType numValues = 100000;
+
+  // ranks get values in different ranges so that the range reduction matters.
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(rank + 1);
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("scalars");
+  scalars->SetNumberOfTuples(numValues);
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("vectors");
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(numValues);
+  for (vtkIdType cc = 0; cc < numValues; ++cc)
+  {
+    scalars->SetValue(cc, random->GetNextRangeValue(-rank, 10 + 2 * rank));
+    for (int comp = 0; comp < 3; ++comp)
+    {
+      vectors->SetTypedComponent(cc, comp, random->GetNextRangeValue(0, 1));
+    }
+  }
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numValues);
+  for (vtkIdType cc = 0; cc < numValues; ++cc)
+  {
+    points->SetPoint(cc, 0, 0, 0);
+  }
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+  input->GetPointData()->AddArray(scalars);
+  input->GetPointData()->AddArray(vectors);
+
+  const bool prevUseDirect = vtkPExtractHistogram::GetUseDirectReduction();
+  auto gathered = Histogram(input, false);
+  auto reduced = Histogram(input, true);
+  vtkPExtractHistogram::SetUseDirectReduction(prevUseDirect);
+
+  int success = 1;
+  if (rank == 0)
+  {
+    success = Compare(gathered, reduced);
+    vtkDataArray* counts = vtkDataArray::SafeDownCast(reduced->GetColumnByName("bin_values"));
+    double total = 0;
+    for (vtkIdType cc = 0; counts && cc < counts->GetNumberOfTuples(); ++cc)
+    {
+      total += counts->GetTuple1(cc);
+    }
+    if (total != static_cast<double>(numValues) * controller->GetNumberOfProcesses())
+    {
+      cerr << "ERROR: wrong total bin count " << total << endl;
+      success = 0;
+    }
+  }
+  else if (reduced->GetNumberOfRows() != 0)
+  {
+    cerr << "ERROR: only the root process must have the histogram." << endl;
+    success = 0;
+  }
+
+  int allSuccess = 0;
+  controller->AllReduce(&success, &allSuccess, 1, vtkCommunicator::LOGICAL_AND_OP);
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return allSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
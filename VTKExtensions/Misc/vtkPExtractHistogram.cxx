@@ -18,11 +18,32 @@
 #include "vtkSmartPointer.h"
 #include "vtkTable.h"
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <string>
+#include <vector>
 #include <vtksys/RegularExpression.hxx>
 
+namespace
+{
+bool UseDirectReduction = true;
+}
+
 vtkStandardNewMacro(vtkPExtractHistogram);
 vtkCxxSetObjectMacro(vtkPExtractHistogram, Controller, vtkMultiProcessController);
+//-----------------------------------------------------------------------------
+void vtkPExtractHistogram::SetUseDirectReduction(bool value)
+{
+  UseDirectReduction = value;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkPExtractHistogram::GetUseDirectReduction()
+{
+  return UseDirectReduction;
+}
+
 //-----------------------------------------------------------------------------
 vtkPExtractHistogram::vtkPExtractHistogram()
 {
@@ -50,12 +71,16 @@ bool vtkPExtractHistogram::GetInputArrayRange(vtkInformationVector** inputVector
   // return value in this call.
   this->Superclass::GetInputArrayRange(inputVector, local_range);
 
-  if (!this->Controller->AllReduce(&local_range[0], &range[0], 1, vtkCommunicator::MIN_OP) ||
-    !this->Controller->AllReduce(&local_range[1], &range[1], 1, vtkCommunicator::MAX_OP))
+  // reduce the minimum and the maximum at once, as maximums.
+  double local_values[2] = { -local_range[0], local_range[1] };
+  double values[2];
+  if (!this->Controller->AllReduce(local_values, values, 2, vtkCommunicator::MAX_OP))
   {
     vtkErrorMacro("Parallel communication error. Could not reduce ranges.");
     return false;
   }
+  range[0] = -values[0];
+  range[1] = values[1];
 
   return true;
 }
@@ -95,64 +120,39 @@ int vtkPExtractHistogram::RequestData(
       // Nothing to do if there is no data
       return 1;
     }
-    // Now we need to collect and reduce data from all nodes on the root.
-    vtkSmartPointer<vtkReductionFilter> reduceFilter = vtkSmartPointer<vtkReductionFilter>::New();
-    reduceFilter->SetController(this->Controller);
-
-    if (isRoot)
+    if (!(UseDirectReduction && this->ReduceBins(output)) &&
+      !this->GatherAndReduceBins(output))
     {
-      // PostGatherHelper needs to be set only on the root node.
-      vtkSmartPointer<vtkAttributeDataReductionFilter> rf =
-        vtkSmartPointer<vtkAttributeDataReductionFilter>::New();
-      rf->SetAttributeType(vtkAttributeDataReductionFilter::ROW_DATA);
-      rf->SetReductionType(vtkAttributeDataReductionFilter::ADD);
-      reduceFilter->SetPostGatherHelper(rf);
+      return 0;
     }
-
-    vtkSmartPointer<vtkTable> copy = vtkSmartPointer<vtkTable>::New();
-    copy->ShallowCopy(output);
-    reduceFilter->SetInputData(copy);
-    reduceFilter->Update();
-    if (isRoot)
+    if (!isRoot)
     {
-      // We save the old bin extents and then revert to be restored later since
-      // the reduction reduces the bin extents as well.
-      output->ShallowCopy(reduceFilter->GetOutput());
-      if (output->GetRowData()->GetNumberOfArrays() == 0)
-      {
-        vtkErrorMacro(<< "Reduced data has 0 arrays");
-        return 0;
-      }
-      output->GetRowData()->GetArray(this->BinExtentsArrayName)->DeepCopy(oldExtents);
-      if (this->CalculateAverages)
+      output->Initialize();
+    }
+    else if (this->CalculateAverages)
+    {
+      vtkDataArray* bin_values = output->GetRowData()->GetArray(this->BinValuesArrayName);
+      vtksys::RegularExpression reg_ex("^(.*)_average$");
+      int numArrays = output->GetRowData()->GetNumberOfArrays();
+      for (int i = 0; i < numArrays; i++)
       {
-        vtkDataArray* bin_values = output->GetRowData()->GetArray(this->BinValuesArrayName);
-        vtksys::RegularExpression reg_ex("^(.*)_average$");
-        int numArrays = output->GetRowData()->GetNumberOfArrays();
-        for (int i = 0; i < numArrays; i++)
+        vtkDataArray* array = output->GetRowData()->GetArray(i);
+        if (array && reg_ex.find(array->GetName()))
         {
-          vtkDataArray* array = output->GetRowData()->GetArray(i);
-          if (array && reg_ex.find(array->GetName()))
+          int numComps = array->GetNumberOfComponents();
+          std::string name = reg_ex.match(1) + "_total";
+          vtkDataArray* tarray = output->GetRowData()->GetArray(name.c_str());
+          for (vtkIdType idx = 0; idx < this->BinCount; idx++)
           {
-            int numComps = array->GetNumberOfComponents();
-            std::string name = reg_ex.match(1) + "_total";
-            vtkDataArray* tarray = output->GetRowData()->GetArray(name.c_str());
-            for (vtkIdType idx = 0; idx < this->BinCount; idx++)
+            for (int j = 0; j < numComps; j++)
             {
-              for (int j = 0; j < numComps; j++)
-              {
-                array->SetComponent(
-                  idx, j, tarray->GetComponent(idx, j) / bin_values->GetTuple1(idx));
-              }
+              array->SetComponent(
+                idx, j, tarray->GetComponent(idx, j) / bin_values->GetTuple1(idx));
             }
           }
         }
       }
     }
-    else
-    {
-      output->Initialize();
-    }
   }
 
   if (isRoot)
@@ -170,6 +170,110 @@ int vtkPExtractHistogram::RequestData(
   return 1;
 }
 
+//-----------------------------------------------------------------------------
+bool vtkPExtractHistogram::ReduceBins(vtkTable* output)
+{
+  // All the arrays but the bin extents are summed, as done by
+  // vtkAttributeDataReductionFilter in GatherAndReduceBins.
+  vtkDataSetAttributes* rowData = output->GetRowData();
+  std::vector<vtkDataArray*> arrays;
+  std::string layout;
+  vtkIdType numValues = 0;
+  for (int i = 0; i < rowData->GetNumberOfArrays(); i++)
+  {
+    vtkDataArray* array = rowData->GetArray(i);
+    if (!array || (array->GetName() && this->BinExtentsArrayName &&
+                    strcmp(array->GetName(), this->BinExtentsArrayName) == 0))
+    {
+      continue;
+    }
+    arrays.push_back(array);
+    numValues += array->GetNumberOfValues();
+    layout += std::string(array->GetName() ? array->GetName() : "") + ":" +
+      std::to_string(array->GetNumberOfValues()) + ";";
+  }
+
+  // Check that the layout is the same everywhere with a single reduction: the
+  // maximums of the hash and of its complement are only both equal to the
+  // local values if all hashes are the same.
+  const vtkTypeUInt64 hash = static_cast<vtkTypeUInt64>(std::hash<std::string>{}(layout));
+  vtkTypeUInt64 local_hashes[2] = { hash, ~hash };
+  vtkTypeUInt64 hashes[2];
+  if (!this->Controller->AllReduce(local_hashes, hashes, 2, vtkCommunicator::MAX_OP) ||
+    hashes[0] != local_hashes[0] || hashes[1] != local_hashes[1])
+  {
+    return false;
+  }
+
+  // Bin counts are exact as doubles up to 2^53.
+  std::vector<double> values(numValues);
+  double* iter = values.data();
+  for (vtkDataArray* array : arrays)
+  {
+    const auto range = vtk::DataArrayValueRange(array);
+    iter = std::copy(range.begin(), range.end(), iter);
+  }
+  std::vector<double> sums(this->Controller->GetLocalProcessId() == 0 ? numValues : 0);
+  if (!this->Controller->Reduce(values.data(), sums.data(), numValues, vtkCommunicator::SUM_OP, 0))
+  {
+    vtkErrorMacro("Parallel communication error. Could not reduce bins.");
+    return false;
+  }
+
+  if (this->Controller->GetLocalProcessId() == 0)
+  {
+    const double* sum = sums.data();
+    for (vtkDataArray* array : arrays)
+    {
+      auto range = vtk::DataArrayValueRange(array);
+      std::copy(sum, sum + range.size(), range.begin());
+      sum += range.size();
+      array->Modified();
+    }
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkPExtractHistogram::GatherAndReduceBins(vtkTable* output)
+{
+  bool isRoot = this->Controller->GetLocalProcessId() == 0;
+  vtkSmartPointer<vtkDataArray> oldExtents =
+    output->GetRowData()->GetArray(this->BinExtentsArrayName);
+
+  // Now we need to collect and reduce data from all nodes on the root.
+  vtkSmartPointer<vtkReductionFilter> reduceFilter = vtkSmartPointer<vtkReductionFilter>::New();
+  reduceFilter->SetController(this->Controller);
+
+  if (isRoot)
+  {
+    // PostGatherHelper needs to be set only on the root node.
+    vtkSmartPointer<vtkAttributeDataReductionFilter> rf =
+      vtkSmartPointer<vtkAttributeDataReductionFilter>::New();
+    rf->SetAttributeType(vtkAttributeDataReductionFilter::ROW_DATA);
+    rf->SetReductionType(vtkAttributeDataReductionFilter::ADD);
+    reduceFilter->SetPostGatherHelper(rf);
+  }
+
+  vtkSmartPointer<vtkTable> copy = vtkSmartPointer<vtkTable>::New();
+  copy->ShallowCopy(output);
+  reduceFilter->SetInputData(copy);
+  reduceFilter->Update();
+  if (isRoot)
+  {
+    // We save the old bin extents and then revert to be restored later since
+    // the reduction reduces the bin extents as well.
+    output->ShallowCopy(reduceFilter->GetOutput());
+    if (output->GetRowData()->GetNumberOfArrays() == 0)
+    {
+      vtkErrorMacro(<< "Reduced data has 0 arrays");
+      return false;
+    }
+    output->GetRowData()->GetArray(this->BinExtentsArrayName)->DeepCopy(oldExtents);
+  }
+  return true;
+}
+
 //-----------------------------------------------------------------------------
 void vtkPExtractHistogram::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -6,7 +6,17 @@
  * @brief   Extract histogram for parallel dataset.
  *
  * vtkPExtractHistogram is vtkExtractHistogram subclass for parallel datasets.
- * It gathers the histogram data on the root node.
+ * It reduces the histogram data on the root node.
+ *
+ * By default, the bins of all processes are summed on the root node with a
+ * single reduction of the raw bin arrays. When the histogram tables do not have
+ * the same layout on all processes, or when UseDirectReduction is off, the
+ * tables are gathered on the root node and summed there instead.
+ *
+ * The local bins are computed by vtkExtractHistogram, serially. Only the
+ * reduction across processes is specialized here: the binning rules (selected
+ * component or magnitude, ghost cells, bins centered on the range, averages)
+ * belong to the superclass and are not duplicated.
  */
 
 #ifndef vtkPExtractHistogram_h
@@ -16,6 +26,7 @@
 #include "vtkPVVTKExtensionsMiscModule.h" //needed for exports
 
 class vtkMultiProcessController;
+class vtkTable;
 
 class VTKPVVTKEXTENSIONSMISC_EXPORT vtkPExtractHistogram : public vtkExtractHistogram
 {
@@ -33,6 +44,15 @@ public:
   vtkGetObjectMacro(Controller, vtkMultiProcessController);
   ///@}
 
+  ///@{
+  /**
+   * When set, the bins are summed with a single reduction of the raw bin arrays
+   * instead of gathering the histogram tables on the root node. Default is true.
+   */
+  static void SetUseDirectReduction(bool);
+  static bool GetUseDirectReduction();
+  ///@}
+
 protected:
   vtkPExtractHistogram();
   ~vtkPExtractHistogram() override;
@@ -51,6 +71,18 @@ protected:
 private:
   vtkPExtractHistogram(const vtkPExtractHistogram&) = delete;
   void operator=(const vtkPExtractHistogram&) = delete;
+
+  /**
+   * Sum the bin arrays, but the bin extents, on the root node with a single
+   * reduction. Returns false, without reducing anything, if the arrays do not
+   * have the same layout on all processes.
+   */
+  bool ReduceBins(vtkTable* output);
+
+  /**
+   * Gather the histogram tables on the root node and sum them there.
+   */
+  bool GatherAndReduceBins(vtkTable* output);
 };
 
 #endif
@@ -13,7 +13,9 @@
 #include "vtkTestUtilities.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <cfloat>
+#include <vector>
 // ----------------------------------------------------------------------------
 void fillArray(vtkDoubleArray* array, double* dataPointer, int dataSize, const char* name)
 {
@@ -153,6 +155,58 @@ int sortMagnitudeOnUnsignedCharVector()
   return EXIT_SUCCESS;
 }
 
+// ----------------------------------------------------------------------------
+// Request every block of a table using the cached global order
+int sortByBlocks(bool invertOrder, bool debug)
+{
+  const int size = 1000;
+  const int blockSize = 64;
+  std::vector<double> dataArray(size);
+  for (int i = 0; i < size; i++)
+  {
+    dataArray[i] = (i * 37) % 101; // many similar values
+  }
+  std::vector<double> sortedArray(dataArray);
+  std::sort(sortedArray.begin(), sortedArray.end());
+  if (invertOrder)
+  {
+    std::reverse(sortedArray.begin(), sortedArray.end());
+  }
+
+  vtkSmartPointer<vtkDoubleArray> dataToSort = vtkSmartPointer<vtkDoubleArray>::New();
+  fillArray(dataToSort.GetPointer(), dataArray.data(), size, "data");
+
+  vtkSmartPointer<vtkTable> input = vtkSmartPointer<vtkTable>::New();
+  input->AddColumn(dataToSort);
+
+  const bool prevUseSampleSort = vtkSortedTableStreamer::GetUseSampleSort();
+  vtkSortedTableStreamer::SetUseSampleSort(true);
+
+  vtkSmartPointer<vtkSortedTableStreamer> sortingfilter =
+    vtkSmartPointer<vtkSortedTableStreamer>::New();
+  sortingfilter->SetInputData(input.GetPointer());
+  sortingfilter->SetSelectedComponent(0);
+  sortingfilter->SetColumnNameToSort("data");
+  sortingfilter->SetInvertOrder(invertOrder ? 1 : 0);
+  sortingfilter->SetBlockSize(blockSize);
+
+  int result = EXIT_SUCCESS;
+  for (int block = 0; block * blockSize < size && result == EXIT_SUCCESS; block++)
+  {
+    sortingfilter->SetBlock(block);
+    sortingfilter->Update();
+    const int expectedSize = std::min(blockSize, size - block * blockSize);
+    if (!compareArray(sortingfilter->GetOutput(), "data", sortedArray.data() + block * blockSize,
+          expectedSize, debug))
+    {
+      result = EXIT_FAILURE;
+    }
+  }
+
+  vtkSortedTableStreamer::SetUseSampleSort(prevUseSampleSort);
+  return result;
+}
+
 // ----------------------------------------------------------------------------
 int TestSortingTable(int vtkNotUsed(argc), char** vtkNotUsed(argv))
 {
@@ -172,6 +226,11 @@ int TestSortingTable(int vtkNotUsed(argc), char** vtkNotUsed(argv))
   cout << "Testing sorting with magnitude on unsigned char: "
        << ((result += sortMagnitudeOnUnsignedCharVector()) ? "FAILED" : "SUCCESS") << endl;
   // --------------------------------------------------------------------------
+  cout << "Testing sorting by blocks: "
+       << ((result += sortByBlocks(false, debug)) ? "FAILED" : "SUCCESS") << endl;
+  // --------------------------------------------------------------------------
+  cout << "Testing sorting by blocks in inverted order: "
+       << ((result += sortByBlocks(true, debug)) ? "FAILED" : "SUCCESS") << endl;
   // --------------------------------------------------------------------------
 
   // Delete Fake MPI controller
@@ -2156,15 +2156,22 @@ def SaveState(filename, location=vtkPVSession.CLIENT):
     pm.SaveState(filename, location)
 
 
-def LoadState(filename, connection=None, location=vtkPVSession.CLIENT):
+def LoadState(filename, connection=None, location=vtkPVSession.CLIENT, transactional=False):
     """Given a state filename and an optional connection, loads the server
-    manager state."""
+    manager state. When transactional is True, the messages sent to the
+    server while loading the state are batched, see
+    vtkSMStateLoader::SetTransactionalLoad()."""
     if not connection:
         connection = ActiveConnection
     if not connection:
         raise RuntimeError("Cannot load state without a connection")
     pm = ProxyManager()
-    pm.LoadState(filename, None, location)
+    loader = None
+    if transactional:
+        loader = vtkSMStateLoader()
+        loader.SetSessionProxyManager(pm.SMProxyManager)
+        loader.SetTransactionalLoad(True)
+    pm.LoadState(filename, loader, location)
     views = GetRenderViews()
     for view in views:
         # Make sure that the client window size matches the